@@ -0,0 +1,285 @@
+#include "../Repositories/include/AirportRepository.hpp"
+#include "../Utils/include/DatabasePathResolver.hpp"
+#include "../Utils/include/JSONManager.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @file AirportSearchBenchmark.cpp
+ * @brief Measures airport suggestions on a generated table of every three-letter code.
+ *
+ * The benchmark replaces airports.json in its own copy of the database (see
+ * BUILD_BENCHMARKS in CMakeLists.txt) with one airport for each of the 17,576 IATA codes,
+ * named after generated cities, before AirportRepository loads it. Prefix and typo
+ * searches are then timed against the scans they avoid: a prefix search against reading
+ * every term, and the typo search, which walks the sorted terms as a trie and skips every
+ * term under a prefix that is already too far from the query, against computing the edits
+ * of every term on its own, as it did before. Both scans return the same airports in the
+ * same order, which is checked for every query.
+ */
+
+static constexpr std::size_t PREFIX_QUERIES = 200;
+static constexpr std::size_t TYPO_QUERIES = 50;
+static constexpr std::size_t SUGGESTION_LIMIT = 10;
+static const std::vector<std::string> SYLLABLES = {
+    "ba", "ka", "lo", "ri", "mon", "ta", "vel", "shi", "dor", "na",
+    "pe", "qua", "zen", "tor", "li", "sa", "mar", "gu", "ven", "ro"
+};
+static const std::vector<std::string> AIRPORT_KINDS = {"International Airport", "Regional Airport", "Municipal Airport", "Airfield"};
+
+using SearchTerms = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Lower-cases a text, as the repository normalizes its terms and queries.
+ */
+static std::string toLower(std::string text) {
+    for (char& c : text) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return text;
+}
+
+/**
+ * @brief Makes a capitalized word of two to four random syllables.
+ */
+static std::string makeWord(std::mt19937& random) {
+    std::uniform_int_distribution<std::size_t> syllableCount(2, 4);
+    std::uniform_int_distribution<std::size_t> syllable(0, SYLLABLES.size() - 1);
+    std::string word;
+    for (std::size_t i = syllableCount(random); i > 0; i--) {
+        word += SYLLABLES[syllable(random)];
+    }
+    word[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(word[0])));
+    return word;
+}
+
+/**
+ * @brief Writes an airport for every three-letter code into the database and returns its search terms.
+ *
+ * The terms are built like AirportRepository builds them: the code, the city, the name
+ * and every word of them, lower-cased, each once per airport, sorted.
+ *
+ * @param cities Receives the city of every airport.
+ * @return SearchTerms The sorted (term, code) pairs of the generated airports.
+ */
+static SearchTerms writeAirports(std::vector<std::string>& cities) {
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> twoWords(0, 9);
+    std::uniform_int_distribution<std::size_t> kind(0, AIRPORT_KINDS.size() - 1);
+    JSON airports = JSON::array();
+    SearchTerms terms;
+    std::string code = "AAA";
+    for (code[0] = 'A'; code[0] <= 'Z'; code[0]++) {
+        for (code[1] = 'A'; code[1] <= 'Z'; code[1]++) {
+            for (code[2] = 'A'; code[2] <= 'Z'; code[2]++) {
+                std::string city = makeWord(random);
+                if (twoWords(random) < 3) {
+                    city += " " + makeWord(random);
+                }
+                std::string name = city + " " + AIRPORT_KINDS[kind(random)];
+                airports.push_back(JSON{{"id", code}, {"city", city}, {"name", name}});
+                cities.push_back(city);
+
+                std::unordered_set<std::string> airportTerms = {toLower(code), toLower(city), toLower(name)};
+                std::istringstream words(name);
+                std::string word;
+                while (words >> word) {
+                    airportTerms.insert(toLower(word));
+                }
+                for (const auto& term : airportTerms) {
+                    terms.emplace_back(term, code);
+                }
+            }
+        }
+    }
+    std::ofstream file(DatabasePathResolver::getDatabasePath() + "airports.json");
+    if (!file) {
+        throw std::runtime_error("Failed to write the generated airports.");
+    }
+    file << airports.dump();
+    std::sort(terms.begin(), terms.end());
+    return terms;
+}
+
+/**
+ * @brief Finds the airports with a term starting with a prefix by reading every term.
+ */
+static std::vector<std::string> scanPrefix(const SearchTerms& terms, const std::string& prefix, std::size_t limit) {
+    std::vector<std::string> codes;
+    std::unordered_set<std::string> seen;
+    std::string upperCode = prefix;
+    for (char& c : upperCode) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    // Every code exists, so a three-letter prefix is also the code of the first airport
+    if (upperCode.size() == 3) {
+        codes.push_back(upperCode);
+        seen.insert(upperCode);
+    }
+    for (const auto& [term, code] : terms) {
+        if (codes.size() < limit && term.compare(0, prefix.size(), prefix) == 0 && seen.insert(code).second) {
+            codes.push_back(code);
+        }
+    }
+    return codes;
+}
+
+/**
+ * @brief Returns the fewest edits turning a query into a prefix of a term, or std::nullopt
+ *        if it takes more than maxEdits; the per-term computation the typo search used before.
+ */
+static std::optional<std::size_t> countPrefixEdits(const std::string& query, const std::string& term, std::size_t maxEdits) {
+    const std::size_t columns = term.size() + 1;
+    std::vector<std::size_t> beforePrevious(columns), previous(columns), current(columns);
+    for (std::size_t j = 0; j < columns; j++) {
+        previous[j] = j;
+    }
+    for (std::size_t i = 1; i <= query.size(); i++) {
+        current[0] = i;
+        std::size_t rowMinimum = current[0];
+        for (std::size_t j = 1; j < columns; j++) {
+            std::size_t cost = (query[i - 1] == term[j - 1]) ? 0 : 1;
+            current[j] = std::min({previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost});
+            if (i > 1 && j > 1 && query[i - 1] == term[j - 2] && query[i - 2] == term[j - 1]) {
+                current[j] = std::min(current[j], beforePrevious[j - 2] + 1);
+            }
+            rowMinimum = std::min(rowMinimum, current[j]);
+        }
+        if (rowMinimum > maxEdits) {
+            return std::nullopt;
+        }
+        std::swap(beforePrevious, previous);
+        std::swap(previous, current);
+    }
+    std::size_t edits = *std::min_element(previous.begin(), previous.end());
+    if (edits > maxEdits) {
+        return std::nullopt;
+    }
+    return edits;
+}
+
+/**
+ * @brief Finds the airports a typo query is closest to by computing the edits of every term.
+ */
+static std::vector<std::string> scanTypo(const SearchTerms& terms, const std::string& query, std::size_t limit) {
+    const std::size_t maxEdits = (query.size() <= 4) ? 1 : 2;
+    std::unordered_map<std::string, std::size_t> closest;
+    for (const auto& [term, code] : terms) {
+        auto edits = countPrefixEdits(query, term, maxEdits);
+        if (edits.has_value()) {
+            auto it = closest.find(code);
+            if (it == closest.end() || edits.value() < it -> second) {
+                closest[code] = edits.value();
+            }
+        }
+    }
+    std::vector<std::pair<std::size_t, std::string>> ranked;
+    for (const auto& [code, edits] : closest) {
+        ranked.emplace_back(edits, code);
+    }
+    std::sort(ranked.begin(), ranked.end());
+    std::vector<std::string> codes;
+    for (std::size_t i = 0; i < ranked.size() && i < limit; i++) {
+        codes.push_back(ranked[i].second);
+    }
+    return codes;
+}
+
+/**
+ * @brief Returns the codes of a list of airports.
+ */
+static std::vector<std::string> codesOf(const std::vector<std::shared_ptr<const AirportModel>>& airports) {
+    std::vector<std::string> codes;
+    for (const auto& airport : airports) {
+        codes.push_back(airport -> getCode());
+    }
+    return codes;
+}
+
+/**
+ * @brief Times a search over every query, checks it against its scan and prints both times per query.
+ *
+ * @param label The name of the search.
+ * @param queries The queries.
+ * @param search The repository search, returning airport codes.
+ * @param scan The scan it is compared with, returning airport codes.
+ */
+template <typename Search, typename Scan>
+static void compareSearches(const std::string& label, const std::vector<std::string>& queries, Search&& search, Scan&& scan) {
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    Microseconds searchTime{0};
+    Microseconds scanTime{0};
+    std::size_t matches = 0;
+    for (const auto& query : queries) {
+        auto start = std::chrono::steady_clock::now();
+        auto found = search(query);
+        auto searched = std::chrono::steady_clock::now();
+        auto scanned = scan(query);
+        searchTime += searched - start;
+        scanTime += std::chrono::steady_clock::now() - searched;
+        if (found != scanned) {
+            throw std::runtime_error(label + " and its scan disagree on \"" + query + "\".");
+        }
+        matches += found.size();
+    }
+    const double count = static_cast<double>(queries.size());
+    std::cout << label << ": " << searchTime.count() / count << " us per query, scanning every term "
+              << scanTime.count() / count << " us (" << static_cast<double>(matches) / count << " airports per query)" << std::endl;
+}
+
+int main() {
+    try {
+        std::vector<std::string> cities;
+        const SearchTerms terms = writeAirports(cities);
+        auto loadStart = std::chrono::steady_clock::now();
+        auto repository = AirportRepository::getInstance();
+        std::chrono::duration<double, std::milli> loadTime = std::chrono::steady_clock::now() - loadStart;
+        std::cout << cities.size() << " airports, " << terms.size() << " search terms, loaded and indexed in "
+                  << loadTime.count() << " ms" << std::endl;
+
+        std::mt19937 random(11);
+        std::uniform_int_distribution<std::size_t> anyCity(0, cities.size() - 1);
+        std::uniform_int_distribution<std::size_t> prefixLength(3, 5);
+        std::vector<std::string> prefixes;
+        while (prefixes.size() < PREFIX_QUERIES) {
+            std::string city = toLower(cities[anyCity(random)]);
+            city = city.substr(0, city.find(' '));
+            prefixes.push_back(city.substr(0, std::min(city.size(), prefixLength(random))));
+        }
+        // Swapping two letters inside a city is one of the edits the typo search forgives
+        std::vector<std::string> typos;
+        while (typos.size() < TYPO_QUERIES) {
+            std::string city = toLower(cities[anyCity(random)]);
+            city = city.substr(0, city.find(' '));
+            if (city.size() < 5) {
+                continue;
+            }
+            std::swap(city[2], city[3]);
+            typos.push_back(city);
+        }
+
+        compareSearches("Prefix search", prefixes,
+            [&](const std::string& prefix) { return codesOf(repository -> findAirportsByPrefix(prefix, SUGGESTION_LIMIT)); },
+            [&](const std::string& prefix) { return scanPrefix(terms, prefix, SUGGESTION_LIMIT); });
+        compareSearches("Typo search", typos,
+            [&](const std::string& query) { return codesOf(repository -> findAirportsByApproximateName(query, SUGGESTION_LIMIT)); },
+            [&](const std::string& query) { return scanTypo(terms, query, SUGGESTION_LIMIT); });
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include "../Model/include/FlightModelBuilder.hpp"
+#include "../Model/include/ReservationModelBuilder.hpp"
+#include "../Repositories/include/FlightRepository.hpp"
+#include "../Repositories/include/ReservationRepository.hpp"
+#include "../Services/include/FlightService.hpp"
+#include "../Services/include/PaymentService.hpp"
+#include "../Services/include/UserManagementService.hpp"
+#include "../Utils/include/DateTime.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file BuilderAllocationBenchmark.cpp
+ * @brief Counts the heap allocations made while building and storing flights and reservations.
+ *
+ * The benchmark runs against its own copy of the database (see BUILD_BENCHMARKS in
+ * CMakeLists.txt). The global operator new is replaced so that every allocation made by
+ * the main thread is counted while a counter is armed. Each model is built and stored
+ * twice over: once the way the services do it, with std::move(builder).build() and
+ * emplaceFlight/emplaceReservation, and once through the copying path, with build() on
+ * an lvalue builder and addFlight/addReservation. Both paths run the same constructor
+ * checks, so the difference per model is what the moves and the emplace path save.
+ * Short IDs fit in the small string buffer and copy without allocating; the crew list
+ * and the seat map do not.
+ */
+
+static constexpr std::size_t FLIGHTS_PER_PATH = 200;
+static constexpr std::size_t RESERVATIONS_PER_PATH = 1000;
+static const std::string AIRCRAFT_ID = "AC-61737";
+static const std::vector<std::string> CREW_MEMBER_IDS = {"CM-1006", "CM-1005", "CM-1004"};
+
+static thread_local bool counting = false;
+static std::size_t allocations = 0;
+static std::size_t allocatedBytes = 0;
+
+void* operator new(std::size_t size) {
+    if (counting) {
+        allocations++;
+        allocatedBytes += size;
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief The allocations and time spent in one step of a path, summed over every model.
+ */
+struct StepCount {
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+    double microseconds = 0;
+};
+
+/**
+ * @brief Runs a step with the allocation counter armed and adds its cost to a count.
+ */
+template <typename Step>
+static auto countStep(StepCount& count, Step&& step) {
+    const std::size_t allocationsBefore = allocations;
+    const std::size_t bytesBefore = allocatedBytes;
+    auto start = std::chrono::steady_clock::now();
+    counting = true;
+    auto result = step();
+    counting = false;
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    count.allocations += allocations - allocationsBefore;
+    count.bytes += allocatedBytes - bytesBefore;
+    count.microseconds += elapsed.count();
+    return result;
+}
+
+/**
+ * @brief Prints the average cost of a step per model.
+ */
+static void printStep(const std::string& label, const StepCount& count, std::size_t models) {
+    const double perModel = static_cast<double>(models);
+    std::cout << "  " << label << ": " << static_cast<double>(count.allocations) / perModel << " allocations, "
+              << static_cast<double>(count.bytes) / perModel << " bytes, "
+              << count.microseconds / perModel << " us per model" << std::endl;
+}
+
+/**
+ * @brief Builds and stores flights through one path and prints what each step allocated.
+ *
+ * @param moving true for std::move(builder).build() and emplaceFlight, false for build() and addFlight.
+ * @param firstDay The day offset of the first flight, so the two paths add distinct flights.
+ */
+static void runFlights(bool moving, int firstDay) {
+    auto flightRepository = FlightRepository::getInstance();
+    const DateTime departure(2032, 1, 1, 10, 0);
+    const DateTime arrival(2032, 1, 1, 14, 0);
+    StepCount build;
+    StepCount store;
+    for (std::size_t i = 0; i < FLIGHTS_PER_PATH; i++) {
+        int day = firstDay + static_cast<int>(i);
+        FlightModelBuilder builder;
+        builder.setOrigin("CAI")
+        .setDestination("DXB")
+        .setDepartureTime(departure.addDays(day))
+        .setArrivalTime(arrival.addDays(day))
+        .setAircraftId(AIRCRAFT_ID)
+        .setCrewMemberIds(CREW_MEMBER_IDS);
+        auto flight = countStep(build, [&] { return moving ? std::move(builder).build() : builder.build(); });
+        bool stored = countStep(store, [&] { return moving ? flightRepository -> emplaceFlight(flight) : flightRepository -> addFlight(*flight); });
+        if (!stored) {
+            throw std::runtime_error("Failed to store a benchmark flight.");
+        }
+    }
+    std::cout << (moving ? "Flights, std::move(builder).build() + emplaceFlight" : "Flights, builder.build() + addFlight") << std::endl;
+    printStep("build", build, FLIGHTS_PER_PATH);
+    printStep("store", store, FLIGHTS_PER_PATH);
+}
+
+/**
+ * @brief Builds and stores reservations through one path and prints what each step allocated.
+ *
+ * Every reservation has its own payment, created before the counter is armed.
+ *
+ * @param moving true for std::move(builder).build() and emplaceReservation, false for build() and addReservation.
+ * @param flightId The flight the reservations are made on.
+ * @param passengerId The passenger the reservations are made for.
+ */
+static void runReservations(bool moving, const std::string& flightId, const std::string& passengerId) {
+    auto reservationRepository = ReservationRepository::getInstance();
+    StepCount build;
+    StepCount store;
+    for (std::size_t i = 0; i < RESERVATIONS_PER_PATH; i++) {
+        auto payment = PaymentService::createPayment(passengerId, 100.0f, "cash", JSON::object());
+        if (!payment.has_value()) {
+            throw std::runtime_error("Failed to add a benchmark payment.");
+        }
+        ReservationModelBuilder builder;
+        builder.setFlightId(flightId)
+        .setPassengerId(passengerId)
+        .setPaymentId(payment.value() -> getPaymentId());
+        auto reservation = countStep(build, [&] { return moving ? std::move(builder).build() : builder.build(); });
+        bool stored = countStep(store, [&] {
+            return moving ? reservationRepository -> emplaceReservation(reservation) : reservationRepository -> addReservation(*reservation);
+        });
+        if (!stored) {
+            throw std::runtime_error("Failed to store a benchmark reservation.");
+        }
+    }
+    std::cout << (moving ? "Reservations, std::move(builder).build() + emplaceReservation" : "Reservations, builder.build() + addReservation") << std::endl;
+    printStep("build", build, RESERVATIONS_PER_PATH);
+    printStep("store", store, RESERVATIONS_PER_PATH);
+}
+
+int main() {
+    try {
+        auto passenger = UserManagementService::createUser(
+            "benchmark_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()),
+            "benchmark",
+            UserModel::UserType::Passenger
+        );
+        if (!passenger.has_value()) {
+            throw std::runtime_error("Failed to add the benchmark passenger.");
+        }
+        auto flight = FlightService::addFlight("CAI", "DXB", DateTime(2031, 12, 1, 10, 0), DateTime(2031, 12, 1, 14, 0), AIRCRAFT_ID);
+        if (!flight.has_value()) {
+            throw std::runtime_error("Failed to add the benchmark flight.");
+        }
+
+        std::cout << FLIGHTS_PER_PATH << " flights and " << RESERVATIONS_PER_PATH << " reservations per path" << std::endl;
+        runFlights(false, 0);
+        runFlights(true, static_cast<int>(FLIGHTS_PER_PATH));
+        runReservations(false, flight.value() -> getFlightId(), passenger.value() -> getUserId());
+        runReservations(true, flight.value() -> getFlightId(), passenger.value() -> getUserId());
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
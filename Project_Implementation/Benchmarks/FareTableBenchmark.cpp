@@ -0,0 +1,148 @@
+#include "../Model/include/FareRules.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file FareTableBenchmark.cpp
+ * @brief Measures seat pricing from the compile-time fare tables against the branching rules they replaced.
+ *
+ * The seats of a 30-row, six-abreast flight are priced in a shuffled order, as bookings
+ * arrive, so the branches of the old rules cannot be learned from the order of the seats.
+ * Four pricers are timed:
+ * - the base fare of the old FareRules::getBaseFare, copied below, branching on the cabin and column;
+ * - FareRules::getBaseFare, which picks the fare table of the row width;
+ * - the six-abreast FareTable called directly, as the compiler sees it when inlined;
+ * - the seat price as ReservationService::getSeatPrice computes it from a seat number,
+ *   with the old base fare and with the current one.
+ * The base fare pricers are called through a function pointer, so neither side is inlined
+ * into the loop. Every result is summed and printed, so no call can be dropped.
+ */
+
+static constexpr std::size_t ROWS = 30;
+static constexpr std::size_t SEATS_PER_ROW = 6;
+static constexpr std::size_t PRICINGS_PER_RUN = 20000000;
+static constexpr std::size_t SEAT_NUMBER_PRICINGS_PER_RUN = 2000000;
+
+using SingleAisleFareTable = FareTable<SEATS_PER_ROW, FareRules::FIRST_CLASS_ROWS, FareRules::BUSINESS_CLASS_ROWS>;
+using BaseFarePricer = float (*)(std::size_t row, std::size_t column, std::size_t seatsPerRow);
+
+/**
+ * @brief The base fare of a seat as FareRules::getBaseFare computed it before the fare tables.
+ */
+static float legacyBaseFare(std::size_t row, std::size_t column, std::size_t) {
+    float baseFare;
+    if (row < 5) {
+        baseFare = 200.0f;
+    }
+    else {
+        baseFare = (row < 15) ? 150.0f : 100.0f;
+    }
+
+    // Window seat premium (columns A or F)
+    if (column == 0 || column == 5) baseFare += 20.0f;
+    // Aisle seat premium (columns C or D)
+    else if (column == 2 || column == 3) baseFare += 10.0f;
+    return baseFare;
+}
+
+/**
+ * @brief The price of a seat by its number as ReservationService::getSeatPrice computes it.
+ *
+ * @param baseFare The base fare pricer, old or current.
+ */
+static float seatPrice(BaseFarePricer baseFare, const std::string& seatNumber, float loyaltyPoints) {
+    float basePrice = FareRules::getSeatlessFare();
+    if (!seatNumber.empty()) {
+        int row = std::stoi(seatNumber.substr(0, seatNumber.size() - 1));
+        char col = seatNumber.back();
+        if (row >= 1 && col >= 'A') {
+            basePrice = baseFare(static_cast<std::size_t>(row - 1), static_cast<std::size_t>(col - 'A'), SEATS_PER_ROW);
+        }
+    }
+    float maxDiscount = basePrice * 0.3f;
+    float discount = std::min(loyaltyPoints, maxDiscount);
+    return basePrice - discount;
+}
+
+/**
+ * @brief Times a pricer over the seats in turn and prints the time per seat.
+ *
+ * @param label The name of the pricer.
+ * @param count The number of seats priced.
+ * @param price Prices the i-th seat.
+ * @return double The sum of all prices, to be printed.
+ */
+template <typename Price>
+static double timePricer(const std::string& label, std::size_t count, Price&& price) {
+    double total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; i++) {
+        total += static_cast<double>(price(i));
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << label << ": " << elapsed.count() / static_cast<double>(count) << " ns per seat" << std::endl;
+    return total;
+}
+
+int main() {
+    try {
+        std::vector<std::pair<std::size_t, std::size_t>> seats;
+        std::vector<std::string> seatNumbers;
+        for (std::size_t row = 0; row < ROWS; row++) {
+            for (std::size_t column = 0; column < SEATS_PER_ROW; column++) {
+                seats.emplace_back(row, column);
+                seatNumbers.push_back(std::to_string(row + 1) + static_cast<char>('A' + column));
+            }
+        }
+        for (const auto& [row, column] : seats) {
+            if (legacyBaseFare(row, column, SEATS_PER_ROW) != FareRules::getBaseFare(row, column, SEATS_PER_ROW)) {
+                throw std::runtime_error("The fare tables do not price the six-abreast seats like the old rules.");
+            }
+        }
+
+        // A long shuffled sequence of seat indices, read in turn by every pricer
+        std::mt19937 random(42);
+        std::vector<std::size_t> order(1 << 16);
+        std::uniform_int_distribution<std::size_t> anySeat(0, seats.size() - 1);
+        for (auto& seat : order) {
+            seat = anySeat(random);
+        }
+        const std::size_t mask = order.size() - 1;
+
+        volatile BaseFarePricer legacyPricer = &legacyBaseFare;
+        volatile BaseFarePricer tablePricer = &FareRules::getBaseFare;
+        auto byPointer = [&](BaseFarePricer pricer) {
+            return [&seats, &order, mask, pricer](std::size_t i) {
+                const auto& seat = seats[order[i & mask]];
+                return pricer(seat.first, seat.second, SEATS_PER_ROW);
+            };
+        };
+
+        double total = 0;
+        std::cout << ROWS << " rows of " << SEATS_PER_ROW << " seats in shuffled order" << std::endl;
+        total += timePricer("Base fare, old branching rules", PRICINGS_PER_RUN, byPointer(legacyPricer));
+        total += timePricer("Base fare, FareRules::getBaseFare", PRICINGS_PER_RUN, byPointer(tablePricer));
+        total += timePricer("Base fare, FareTable inlined", PRICINGS_PER_RUN, [&](std::size_t i) {
+            const auto& seat = seats[order[i & mask]];
+            return SingleAisleFareTable::getFare(seat.first, seat.second);
+        });
+        total += timePricer("Seat price from its number, old rules", SEAT_NUMBER_PRICINGS_PER_RUN, [&](std::size_t i) {
+            return seatPrice(legacyPricer, seatNumbers[order[i & mask]], 10.0f);
+        });
+        total += timePricer("Seat price from its number, fare tables", SEAT_NUMBER_PRICINGS_PER_RUN, [&](std::size_t i) {
+            return seatPrice(tablePricer, seatNumbers[order[i & mask]], 10.0f);
+        });
+        std::cout << "Sum of all prices: " << total << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
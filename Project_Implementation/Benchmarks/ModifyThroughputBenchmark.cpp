@@ -0,0 +1,132 @@
+#include "../Repositories/include/FlightRepository.hpp"
+#include "../Repositories/include/ReservationRepository.hpp"
+#include "../Services/include/FlightService.hpp"
+#include "../Services/include/ReservationService.hpp"
+#include "../Services/include/UserManagementService.hpp"
+#include "../Utils/include/DateTime.hpp"
+#include "../Utils/include/RuntimeOptions.hpp"
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file ModifyThroughputBenchmark.cpp
+ * @brief Measures update throughput of modifyFlight/modifyReservation against copy-then-update.
+ *
+ * The benchmark runs against its own copy of the database (see BUILD_BENCHMARKS in
+ * CMakeLists.txt), adds FLIGHT_COUNT flights with one booked seat each, then updates them
+ * in turn through both paths. Copy-then-update is what the services did before the
+ * modify APIs: copy the stored model, change the copy and write it back with
+ * compareAndSetFlight/compareAndSetReservation, which copies it back over the stored one.
+ * modifyFlight/modifyReservation change the stored model in place. Both paths
+ * bump the version and record the mutation log. Command-line options such as --shards=4
+ * are passed on to RuntimeOptions.
+ */
+
+static constexpr std::size_t FLIGHT_COUNT = 200;
+static constexpr std::size_t UPDATES_PER_RUN = 20000;
+static const std::string AIRCRAFT_ID = "AC-61737";
+
+/**
+ * @brief Adds the flights to update, one day apart, and books one seat on each.
+ *
+ * @param passengerId The passenger every seat is booked for.
+ * @return std::vector<std::pair<std::string, std::string>> The ID of each flight and of its reservation.
+ */
+static std::vector<std::pair<std::string, std::string>> addBookedFlights(const std::string& passengerId) {
+    std::vector<std::pair<std::string, std::string>> booked;
+    booked.reserve(FLIGHT_COUNT);
+    const DateTime firstDeparture(2033, 1, 1, 10, 0);
+    const DateTime firstArrival(2033, 1, 1, 14, 0);
+    for (std::size_t i = 0; i < FLIGHT_COUNT; i++) {
+        int day = static_cast<int>(i);
+        auto flight = FlightService::addFlight("CAI", "DXB", firstDeparture.addDays(day), firstArrival.addDays(day), AIRCRAFT_ID);
+        if (!flight.has_value()) {
+            throw std::runtime_error("Failed to add a benchmark flight.");
+        }
+        const std::string flightId = flight.value() -> getFlightId();
+        std::optional<std::shared_ptr<ReservationModel>> reservation;
+        FlightService::runOnFlightShard(flightId, [&] {
+            reservation = ReservationService::addReservation(flightId, "1A", passengerId, "cash", JSON::object());
+        });
+        if (!reservation.has_value()) {
+            throw std::runtime_error("Failed to book a benchmark seat.");
+        }
+        booked.emplace_back(flightId, reservation.value() -> getReservationId());
+    }
+    return booked;
+}
+
+/**
+ * @brief Runs UPDATES_PER_RUN updates, one per call of update, and prints their throughput.
+ *
+ * @param label The name of the run.
+ * @param update Applies the i-th update and returns whether it was committed.
+ */
+static void runUpdates(const std::string& label, const std::function<bool(std::size_t)>& update) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < UPDATES_PER_RUN; i++) {
+        if (!update(i)) {
+            throw std::runtime_error("A benchmark update was not committed.");
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << label << ": " << static_cast<double>(UPDATES_PER_RUN) / elapsed.count() << " updates/s ("
+              << elapsed.count() * 1e6 / static_cast<double>(UPDATES_PER_RUN) << " us per update)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    RuntimeOptions::parse(argc, argv);
+    try {
+        auto passenger = UserManagementService::createUser(
+            "benchmark_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()),
+            "benchmark",
+            UserModel::UserType::Passenger
+        );
+        if (!passenger.has_value()) {
+            throw std::runtime_error("Failed to add the benchmark passenger.");
+        }
+        const auto booked = addBookedFlights(passenger.value() -> getUserId());
+        auto flightRepository = FlightRepository::getInstance();
+        auto reservationRepository = ReservationRepository::getInstance();
+        // Every update moves the departure by a few minutes, so each one changes the flight
+        auto departureFor = [](std::size_t i) {
+            return DateTime(2033, 1, 1, 10, static_cast<int>(i % 30)).addDays(static_cast<int>(i % FLIGHT_COUNT));
+        };
+        auto statusFor = [](std::size_t i) {
+            return (i / FLIGHT_COUNT) % 2 == 0 ? ReservationModel::ReservationStatus::BOARDED : ReservationModel::ReservationStatus::CONFIRMED;
+        };
+
+        std::cout << FLIGHT_COUNT << " flights, " << UPDATES_PER_RUN << " updates per run" << std::endl;
+        runUpdates("Flights, copy then compareAndSetFlight", [&](std::size_t i) {
+            FlightModel flight = *flightRepository -> findFlightById(booked[i % FLIGHT_COUNT].first).value();
+            flight.setDepartureTime(departureFor(i));
+            return flightRepository -> compareAndSetFlight(flight, flight.getVersion());
+        });
+        runUpdates("Flights, modifyFlight", [&](std::size_t i) {
+            return flightRepository -> modifyFlight(booked[i % FLIGHT_COUNT].first, [&](FlightModel& flight) {
+                flight.setDepartureTime(departureFor(i));
+                return true;
+            });
+        });
+        runUpdates("Reservations, copy then compareAndSetReservation", [&](std::size_t i) {
+            ReservationModel reservation = *reservationRepository -> findReservationById(booked[i % FLIGHT_COUNT].second).value();
+            reservation.setStatus(statusFor(i));
+            return reservationRepository -> compareAndSetReservation(reservation, reservation.getVersion());
+        });
+        runUpdates("Reservations, modifyReservation", [&](std::size_t i) {
+            return reservationRepository -> modifyReservation(booked[i % FLIGHT_COUNT].second, [&](ReservationModel& reservation) {
+                reservation.setStatus(statusFor(i));
+                return true;
+            });
+        });
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
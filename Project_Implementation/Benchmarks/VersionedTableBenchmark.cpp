@@ -0,0 +1,142 @@
+#include "../Services/include/FlightService.hpp"
+#include "../Services/include/ReservationService.hpp"
+#include "../Services/include/UserManagementService.hpp"
+#include "../Utils/include/DateTime.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file VersionedTableBenchmark.cpp
+ * @brief Measures booking latency while a full-scan report reads the flight table.
+ *
+ * The benchmark runs against its own copy of the database (see BUILD_BENCHMARKS in
+ * CMakeLists.txt), adds FLIGHT_COUNT flights and books seats on them through the same
+ * service calls as the booking manager. Each booking is timed twice over: once on a quiet
+ * table and once while another thread keeps scanning every seat of every flight through a
+ * snapshot, as the admin listings and reports do. The scan never takes a lock, so the two
+ * runs should report close latencies.
+ */
+
+static constexpr std::size_t FLIGHT_COUNT = 1000;
+static constexpr std::size_t BOOKINGS_PER_RUN = 2000;
+static constexpr std::size_t ROWS = 30;
+static const std::string AIRCRAFT_ID = "AC-61737";
+static const std::string SEAT_LETTERS = "ABCDEF";
+
+/**
+ * @brief Adds the flights bookings are made on, one day apart so the aircraft is free.
+ *
+ * @return std::vector<std::string> The IDs of the added flights.
+ */
+static std::vector<std::string> addFlights() {
+    std::vector<std::string> flightIds;
+    flightIds.reserve(FLIGHT_COUNT);
+    const DateTime firstDeparture(2030, 1, 1, 10, 0);
+    const DateTime firstArrival(2030, 1, 1, 14, 0);
+    for (std::size_t i = 0; i < FLIGHT_COUNT; i++) {
+        int day = static_cast<int>(i);
+        auto flight = FlightService::addFlight("CAI", "DXB", firstDeparture.addDays(day), firstArrival.addDays(day), AIRCRAFT_ID);
+        if (!flight.has_value()) {
+            throw std::runtime_error("Failed to add a benchmark flight.");
+        }
+        flightIds.push_back(flight.value() -> getFlightId());
+    }
+    return flightIds;
+}
+
+/**
+ * @brief Books the next seats in turn and returns the latency of every booking.
+ *
+ * @param flightIds The flights to book on.
+ * @param passengerId The passenger every seat is booked for.
+ * @param nextBooking The index of the first seat to book; advanced past the booked seats.
+ * @return std::vector<double> The latency of each booking in microseconds.
+ */
+static std::vector<double> bookSeats(const std::vector<std::string>& flightIds, const std::string& passengerId, std::size_t& nextBooking) {
+    std::vector<double> latencies;
+    latencies.reserve(BOOKINGS_PER_RUN);
+    for (std::size_t i = 0; i < BOOKINGS_PER_RUN; i++, nextBooking++) {
+        const std::string& flightId = flightIds[nextBooking % flightIds.size()];
+        std::size_t seat = nextBooking / flightIds.size();
+        std::string seatNumber = std::to_string(seat / SEAT_LETTERS.size() + 1) + SEAT_LETTERS[seat % SEAT_LETTERS.size()];
+
+        auto start = std::chrono::steady_clock::now();
+        FlightService::runOnFlightShard(flightId, [&] {
+            ReservationService::addReservation(flightId, seatNumber, passengerId, "cash", JSON::object());
+        });
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(elapsed.count());
+    }
+    return latencies;
+}
+
+/**
+ * @brief Prints the median, 99th percentile and worst latency of a run.
+ *
+ * @param label The name of the run.
+ * @param latencies The latencies of the run in microseconds.
+ */
+static void printLatencies(const std::string& label, std::vector<double> latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        return latencies[static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1))];
+    };
+    std::cout << label << ": p50 " << percentile(0.50) << " us, p99 " << percentile(0.99)
+              << " us, max " << latencies.back() << " us" << std::endl;
+}
+
+int main() {
+    try {
+        auto passenger = UserManagementService::createUser(
+            "benchmark_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()),
+            "benchmark",
+            UserModel::UserType::Passenger
+        );
+        if (!passenger.has_value()) {
+            throw std::runtime_error("Failed to add the benchmark passenger.");
+        }
+        auto flightIds = addFlights();
+        if (2 * BOOKINGS_PER_RUN > flightIds.size() * ROWS * SEAT_LETTERS.size()) {
+            throw std::runtime_error("Not enough seats for the benchmark.");
+        }
+        std::size_t nextBooking = 0;
+
+        auto quiet = bookSeats(flightIds, passenger.value() -> getUserId(), nextBooking);
+
+        std::atomic<bool> scanning{true};
+        std::atomic<std::size_t> scans{0};
+        std::size_t bookedSeen = 0;
+        std::thread report([&] {
+            while (scanning.load()) {
+                std::size_t booked = 0;
+                for (const auto& flight : FlightService::getFlightsSnapshot()) {
+                    for (const auto& row : flight.getSeatMap()) {
+                        booked += static_cast<std::size_t>(std::count(row.begin(), row.end(), true));
+                    }
+                }
+                bookedSeen = booked;
+                scans++;
+            }
+        });
+        auto scanned = bookSeats(flightIds, passenger.value() -> getUserId(), nextBooking);
+        scanning.store(false);
+        report.join();
+
+        std::cout << FLIGHT_COUNT << " flights, " << BOOKINGS_PER_RUN << " bookings per run" << std::endl;
+        printLatencies("Bookings on a quiet table", quiet);
+        printLatencies("Bookings during full scans", scanned);
+        std::cout << "Full scans completed during the second run: " << scans.load()
+                  << " (last one saw " << bookedSeen << " booked seats)" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
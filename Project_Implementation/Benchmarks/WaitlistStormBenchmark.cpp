@@ -0,0 +1,161 @@
+#include "../Model/include/Passenger.hpp"
+#include "../Services/include/FlightService.hpp"
+#include "../Services/include/ReservationService.hpp"
+#include "../Services/include/UserManagementService.hpp"
+#include "../Utils/include/DateTime.hpp"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file WaitlistStormBenchmark.cpp
+ * @brief Measures how fast cancellations promote waitlisted passengers on deep waitlists.
+ *
+ * The benchmark runs against its own copy of the database (see BUILD_BENCHMARKS in
+ * CMakeLists.txt). For each waitlist depth it fully books FLIGHTS_PER_DEPTH flights, puts
+ * that many passengers on the waitlist of each, with loyalty points spread so the heap
+ * order differs from the order of joining, then cancels every original booking in one
+ * burst, as a schedule change would. Each cancellation frees a seat that goes to the
+ * first passenger in line, charged at once. The waitlist heap takes the next entry in
+ * O(log n), so promotions per second should barely drop as the waitlists grow.
+ *
+ * Waitlist entry IDs are five random digits, so the flights of each depth are deleted,
+ * dropping their waitlists, before the next depth is set up; no more than
+ * FLIGHTS_PER_DEPTH * 20000 entries are waiting at any time.
+ */
+
+static constexpr std::size_t FLIGHTS_PER_DEPTH = 2;
+static constexpr std::size_t PASSENGER_COUNT = 100;
+static const std::vector<std::size_t> WAITLIST_DEPTHS = {200, 2000, 20000};
+static constexpr std::size_t ROWS = 30;
+static const std::string AIRCRAFT_ID = "AC-61737";
+static const std::string SEAT_LETTERS = "ABCDEF";
+
+/**
+ * @brief Adds the passengers who book and wait, each with its own loyalty points.
+ *
+ * @return std::vector<std::shared_ptr<Passenger>> The stored passengers.
+ */
+static std::vector<std::shared_ptr<Passenger>> addPassengers() {
+    std::vector<std::shared_ptr<Passenger>> passengers;
+    passengers.reserve(PASSENGER_COUNT);
+    const std::string prefix = "storm_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()) + "_";
+    for (std::size_t i = 0; i < PASSENGER_COUNT; i++) {
+        auto user = UserManagementService::createUser(prefix + std::to_string(i), "benchmark", UserModel::UserType::Passenger);
+        auto passenger = user.has_value() ? std::dynamic_pointer_cast<Passenger>(user.value()) : nullptr;
+        if (!passenger) {
+            throw std::runtime_error("Failed to add a benchmark passenger.");
+        }
+        passengers.push_back(passenger);
+    }
+    return passengers;
+}
+
+/**
+ * @brief Adds a flight and books every seat of it.
+ *
+ * @param day The day offset of the flight, so the aircraft is free.
+ * @param passengers The passengers the seats are booked for, in turn.
+ * @param reservationIds Receives the IDs of the bookings.
+ * @return std::string The ID of the flight.
+ */
+static std::string addFullFlight(int day, const std::vector<std::shared_ptr<Passenger>>& passengers, std::vector<std::string>& reservationIds) {
+    auto flight = FlightService::addFlight("CAI", "DXB", DateTime(2034, 1, 1, 10, 0).addDays(day), DateTime(2034, 1, 1, 14, 0).addDays(day), AIRCRAFT_ID);
+    if (!flight.has_value()) {
+        throw std::runtime_error("Failed to add a benchmark flight.");
+    }
+    const std::string flightId = flight.value() -> getFlightId();
+    for (std::size_t seat = 0; seat < ROWS * SEAT_LETTERS.size(); seat++) {
+        std::string seatNumber = std::to_string(seat / SEAT_LETTERS.size() + 1) + SEAT_LETTERS[seat % SEAT_LETTERS.size()];
+        std::optional<std::shared_ptr<ReservationModel>> reservation;
+        FlightService::runOnFlightShard(flightId, [&] {
+            reservation = ReservationService::addReservation(flightId, seatNumber, passengers[seat % passengers.size()] -> getUserId(), "cash", JSON::object());
+        });
+        if (!reservation.has_value()) {
+            throw std::runtime_error("Failed to book a benchmark seat.");
+        }
+        reservationIds.push_back(reservation.value() -> getReservationId());
+    }
+    return flightId;
+}
+
+/**
+ * @brief Puts passengers on the waitlist of a fully booked flight.
+ *
+ * The loyalty points a passenger holds when joining set its place in line, so they are
+ * changed before every request.
+ *
+ * @param flightId The flight to wait for.
+ * @param depth The number of entries to add.
+ * @param passengers The passengers who join, in turn.
+ */
+static void fillWaitlist(const std::string& flightId, std::size_t depth, const std::vector<std::shared_ptr<Passenger>>& passengers) {
+    for (std::size_t i = 0; i < depth; i++) {
+        auto& passenger = passengers[i % passengers.size()];
+        passenger -> setLoyaltyPoints(static_cast<float>((i * 37) % 101));
+        std::optional<std::shared_ptr<WaitlistEntryModel>> entry;
+        FlightService::runOnFlightShard(flightId, [&] {
+            entry = ReservationService::joinWaitlist(flightId, passenger -> getUserId(), "cash", JSON::object());
+        });
+        if (!entry.has_value()) {
+            throw std::runtime_error("Failed to join the waitlist; the route may allow overbooking.");
+        }
+    }
+}
+
+int main() {
+    try {
+        auto passengers = addPassengers();
+        const std::size_t seatsPerFlight = ROWS * SEAT_LETTERS.size();
+        std::cout << FLIGHTS_PER_DEPTH << " fully booked flights per depth, " << seatsPerFlight
+                  << " cancellations per flight" << std::endl;
+
+        int day = 0;
+        for (std::size_t depth : WAITLIST_DEPTHS) {
+            if (depth < seatsPerFlight) {
+                throw std::runtime_error("A waitlist must be deep enough to refill every cancelled seat.");
+            }
+            std::vector<std::string> flightIds;
+            std::vector<std::string> reservationIds;
+            for (std::size_t i = 0; i < FLIGHTS_PER_DEPTH; i++) {
+                flightIds.push_back(addFullFlight(day++, passengers, reservationIds));
+                fillWaitlist(flightIds.back(), depth, passengers);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < reservationIds.size(); i++) {
+                const std::string& flightId = flightIds[i / seatsPerFlight];
+                bool cancelled = false;
+                FlightService::runOnFlightShard(flightId, [&] {
+                    cancelled = ReservationService::deleteReservation(reservationIds[i]);
+                });
+                if (!cancelled) {
+                    throw std::runtime_error("Failed to cancel a benchmark booking.");
+                }
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            std::size_t promotions = 0;
+            for (const auto& flightId : flightIds) {
+                promotions += depth - ReservationService::getWaitlistLength(flightId);
+            }
+            if (promotions != reservationIds.size()) {
+                throw std::runtime_error("Not every cancelled seat went to a waitlisted passenger.");
+            }
+            std::cout << "Waitlist depth " << depth << ": " << static_cast<double>(promotions) / elapsed.count()
+                      << " promotions/s (" << elapsed.count() * 1e6 / static_cast<double>(promotions)
+                      << " us per cancellation)" << std::endl;
+            for (const auto& flightId : flightIds) {
+                FlightService::deleteFlight(flightId);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <memory>
 #include "../../Model/include/Admin.hpp"
 #include "../../Model/include/CrewMemberModel.hpp"
+#include "ScreenBuffer.hpp"
 
 /**
  * @brief Interface class for administrator operations in the Airplane Management System
@@ -21,6 +22,7 @@
  */
 class AdminInterface {
     std::shared_ptr<Admin> currentUser;
+    ScreenBuffer screen;
     
     void displayAdminMenu();
 
@@ -36,6 +38,7 @@ class AdminInterface {
     void assignCrewToFlight();
     void removeCrewMemberFromFlight();
     void displayCrewMembersOfFlight();
+    void searchCrewMembers();
 
     // Aircraft Management
     void displayManageAircraftsMenu();
@@ -52,6 +55,7 @@ class AdminInterface {
     bool displayExistingUsers();
     void updateExistingUser();
     void removeExistingUser();
+    void searchUsers();
 
     constexpr static int MANAGE_FLIGHTS_OPTION = 1;
     constexpr static int MANAGE_AIRCRAFTS_OPTION = 2;
@@ -64,7 +68,8 @@ class AdminInterface {
     constexpr static int VIEW_FLIGHTS_OPTION = 4;
     constexpr static int ASSIGN_CREW_OPTION = 5;
     constexpr static int REMOVE_CREW_OPTION = 6;
-    constexpr static int FLIGHT_BACK_OPTION = 7;
+    constexpr static int SEARCH_CREW_OPTION = 7;
+    constexpr static int FLIGHT_BACK_OPTION = 8;
 
     constexpr static int BACK_OPTION = 5;
 
@@ -77,6 +82,8 @@ class AdminInterface {
     constexpr static int UPDATE_USER_OPTION = 2;
     constexpr static int REMOVE_USER_OPTION = 3;
     constexpr static int VIEW_USERS_OPTION = 4;
+    constexpr static int SEARCH_USERS_OPTION = 5;
+    constexpr static int USERS_BACK_OPTION = 6;
 
     public:
         AdminInterface(const std::shared_ptr<Admin>& admin);
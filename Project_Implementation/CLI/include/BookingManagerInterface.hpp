@@ -2,6 +2,11 @@
 
 #include <memory>
 #include "../../Model/include/BookingManager.hpp"
+#include "../../Model/include/FlightModel.hpp"
+#include "../../Third_Party/json.hpp"
+#include "ScreenBuffer.hpp"
+
+using JSON = nlohmann::json;
 
 /**
  * @brief Interface class for managing booking operations through a command-line interface.
@@ -18,6 +23,8 @@
  * 
  * Key features:
  * - Flight search and booking capabilities
+ * - Overbooking and waitlisting passengers on fully booked flights
+ * - Recording boarding and no-shows
  * - Booking modification and cancellation
  * - Passenger and flight information display
  * - Interactive seat map visualization
@@ -28,6 +35,7 @@
  */
 class BookingManagerInterface {
     std::shared_ptr<BookingManager> currentUser;
+    ScreenBuffer screen;
     void clearInputBuffer();
 
     void displayBookingManagerMenu();
@@ -35,8 +43,13 @@ class BookingManagerInterface {
     void searchFlights();
     bool viewBookings();
     void bookFlight();
+    bool selectSeat(const FlightModel& flight, std::string& seatNumber);
+    bool offerSaleWithoutSeat(const std::string& passengerId, const std::string& flightId);
+    bool selectPaymentMethod(std::string& paymentType, JSON& paymentDetails);
+    void joinWaitlist(const std::string& passengerId, const std::string& flightId);
     void modifyBooking();
     void cancelBooking();
+    void recordBoarding();
     void displayAllPassengers();
     void displayAllFlights();
     constexpr static int SEARCH_FLIGHTS_OPTION = 1;
@@ -44,7 +57,8 @@ class BookingManagerInterface {
     constexpr static int BOOK_FLIGHT_OPTION = 3;
     constexpr static int MODIFY_BOOKING_OPTION = 4;
     constexpr static int CANCEL_BOOKING_OPTION = 5;
-    constexpr static int LOGOUT_OPTION = 6;
+    constexpr static int RECORD_BOARDING_OPTION = 6;
+    constexpr static int LOGOUT_OPTION = 7;
 
     public:
         BookingManagerInterface(const std::shared_ptr<BookingManager>& bookingManager);
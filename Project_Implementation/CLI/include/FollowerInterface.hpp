@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include "../../Repositories/include/ReplicationFollower.hpp"
+
+/**
+ * @brief Interface class for hot-standby follower processes.
+ *
+ * While the follower applies the primary's mutation log in the background, this interface
+ * only reports replication progress and never touches the repositories. Once the follower
+ * is promoted, the caller takes over the repositories and continues as the primary.
+ */
+class FollowerInterface {
+    ReplicationFollower follower;
+
+    void clearInputBuffer();
+    void displayFollowerMenu();
+    void displayStatus();
+
+    constexpr static int VIEW_STATUS_OPTION = 1;
+    constexpr static int PROMOTE_OPTION = 2;
+    constexpr static int EXIT_OPTION = 3;
+    public:
+        explicit FollowerInterface(const std::string& socketPath);
+        bool startInterface();
+};
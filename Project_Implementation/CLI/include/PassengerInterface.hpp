@@ -2,6 +2,9 @@
 
 #include <memory>
 #include "../../Model/include/Passenger.hpp"
+#include "../../Repositories/include/FareCalendarIndex.hpp"
+#include "../../Utils/include/DateTime.hpp"
+#include "ScreenBuffer.hpp"
 
 /**
  * @brief Interface class for passenger operations in the airline management system.
@@ -15,10 +18,14 @@
  */
 class PassengerInterface {
     std::shared_ptr<Passenger> currentUser;
+    ScreenBuffer screen;
     
     void clearInputBuffer();
     void displayPassengerMenu();
     void searchFlights();
+    std::string selectAirport(const std::string& prompt);
+    AvailabilityFilter selectAvailabilityFilter();
+    void displayFareCalendar(const std::string& origin, const std::string& destination, const DateTime& departureDate);
     void viewReservations();
     void displayExistingFlights();
     void displaySeatMap(const std::vector<std::vector<bool>>& seatMap);
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../../Repositories/include/FlightSnapshotReader.hpp"
+#include "ScreenBuffer.hpp"
+
+/**
+ * @brief Interface class for read-only replica processes.
+ *
+ * A replica process does not load or save any repository. It attaches to the flight
+ * snapshots published by a primary process and lets users search flights by route and
+ * date and inspect seat maps, always answering from the latest published snapshot.
+ */
+class ReplicaInterface {
+    FlightSnapshotReader reader;
+    ScreenBuffer screen;
+
+    void clearInputBuffer();
+    void displayReplicaMenu();
+    void searchFlights();
+    void viewSeatMap();
+    void displaySeatMap(const std::vector<std::vector<bool>>& seatMap);
+
+    constexpr static int SEARCH_FLIGHTS_OPTION = 1;
+    constexpr static int VIEW_SEAT_MAP_OPTION = 2;
+    constexpr static int EXIT_OPTION = 3;
+    public:
+        explicit ReplicaInterface(const std::string& segmentName);
+        void startInterface();
+};
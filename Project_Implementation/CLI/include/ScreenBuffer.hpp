@@ -0,0 +1,54 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief Output buffer that collects one screen of text and writes it in a single call.
+ *
+ * Interfaces format menus, listings and seat maps into a ScreenBuffer instead of writing
+ * to std::cout piece by piece, then call flush() once the screen is complete (and before
+ * reading input). The buffer keeps its capacity between screens, so once it has grown to
+ * the size of the largest screen, formatting allocates nothing.
+ *
+ * Text, characters and numbers can be appended; numbers are formatted the way std::cout
+ * formats them by default. Anything else is formatted by the caller first.
+ */
+class ScreenBuffer {
+    std::string buffer;
+    std::ostream& out;
+
+    void appendInteger(long long value);
+    void appendUnsigned(unsigned long long value);
+
+    public:
+        explicit ScreenBuffer(std::ostream& out = std::cout);
+        ScreenBuffer(const ScreenBuffer&) = delete;
+        ScreenBuffer& operator=(const ScreenBuffer&) = delete;
+
+        ScreenBuffer& operator<<(std::string_view text);
+        ScreenBuffer& operator<<(const char* text);
+        ScreenBuffer& operator<<(const std::string& text);
+        ScreenBuffer& operator<<(char character);
+        ScreenBuffer& operator<<(double value);
+
+        template <typename Integer, typename = std::enable_if_t<std::is_integral_v<Integer>>>
+        ScreenBuffer& operator<<(Integer value) {
+            if constexpr (std::is_signed_v<Integer>) {
+                appendInteger(value);
+            } else {
+                appendUnsigned(value);
+            }
+            return *this;
+        }
+
+        ScreenBuffer& repeat(char character, std::size_t count);
+        inline std::size_t size() const                     { return buffer.size(); }
+        void flush();
+
+        static bool supportsColor();
+
+        ~ScreenBuffer();
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+#include "ScreenBuffer.hpp"
+
+/**
+ * @brief Renders a flight's seat map compactly into a ScreenBuffer.
+ *
+ * Each row is one line: the row number followed by one character per seat, 'O' for an
+ * available seat and 'X' for an occupied one, under a header of seat letters. Rows of four
+ * seats or more are split by an aisle. When color is enabled, available seats are green
+ * and occupied seats red; an escape sequence is only emitted where the color changes, so
+ * a 500-seat aircraft renders to a few kilobytes written in one call.
+ *
+ * @note This class cannot be instantiated; all rendering goes through render().
+ */
+class SeatMapRenderer {
+    public:
+        SeatMapRenderer() = delete;
+
+        static void render(const std::vector<std::vector<bool>>& seatMap, ScreenBuffer& screen, bool color);
+};
@@ -4,6 +4,21 @@
 #include <stdexcept>
 #include <functional>
 
+static const std::size_t PAGE_SIZE = 10;
+
+static const char* getRoleLabel(UserModel::UserType role) {
+    switch (role) {
+        case UserModel::UserType::Passenger:
+            return "Passenger";
+        case UserModel::UserType::Admin:
+            return "Admin";
+        case UserModel::UserType::BookingManager:
+            return "Booking Manager";
+        default:
+            return "Unknown";
+    }
+}
+
 AdminInterface::AdminInterface(const std::shared_ptr<Admin>& admin) : currentUser(admin) {}
 
 
@@ -54,7 +69,8 @@ void AdminInterface::displayManageFlightsMenu() {
     std::cout << "4. View Flights" << std::endl;
     std::cout << "5. Assign Crew to Flight" << std::endl;
     std::cout << "6. Remove Crew from Flight" << std::endl;
-    std::cout << "7. Back to Admin Menu" << std::endl;
+    std::cout << "7. Search Crew Members" << std::endl;
+    std::cout << "8. Back to Admin Menu" << std::endl;
     std::cout << "Choice: ";
 }
 
@@ -89,6 +105,9 @@ void AdminInterface::handleFlights() {
                 // Remove Crew from Flight
                 removeCrewMemberFromFlight();
                 break;
+            case SEARCH_CREW_OPTION:
+                searchCrewMembers();
+                break;
             case FLIGHT_BACK_OPTION:
                 std::cout << "Going back to Admin Menu..." << std::endl;
                 break;
@@ -249,27 +268,51 @@ void AdminInterface::addFlightOption() {
 }
 
 void AdminInterface::displayCrewMembers(const CrewMemberModel::CrewType& role) {
-    auto crewMembers = AdminController::getAllCrewMembers(currentUser -> getUserId(), role);
+    auto crewMembers = AdminController::viewCrewMembers(currentUser -> getUserId());
+    int index = 1;
+    for (const auto& crewMember : crewMembers) {
+        if (crewMember.getRole() != role) {
+            continue;
+        }
+        if (index == 1) {
+            switch(role) {
+                case CrewMemberModel::CrewType::Pilot:
+                    screen << "Available Pilots:" << '\n';
+                    break;
+                case CrewMemberModel::CrewType::FlightAttendant:
+                    screen << "Available Flight Attendants:" << '\n';
+                    break;
+                default:
+                    screen << "Available Crew Members:" << '\n';
+                    break;
+            }
+        }
+        screen << index << ". Crew ID: " << crewMember.getCrewId() << ", Name: " << crewMember.getName() << '\n';
+        index++;
+    }
+    if (index == 1) {
+        screen << "No crew members available." << '\n';
+    }
+    screen.flush();
+}
+void AdminInterface::searchCrewMembers() {
+    std::cout << " ----- Search Crew Members ----- " << std::endl;
+    std::string prefix;
+    std::cout << "Enter the beginning of the name: ";
+    std::getline(std::cin >> std::ws, prefix);
+
+    auto crewMembers = AdminController::searchCrewMembers(currentUser -> getUserId(), prefix, PAGE_SIZE);
     if (crewMembers.empty()) {
-        std::cout << "No crew members available." << std::endl;
+        std::cout << "No crew members found." << std::endl;
         return;
     }
-    switch(role) {
-        case CrewMemberModel::CrewType::Pilot:
-            std::cout << "Available Pilots:" << std::endl;
-            break;
-        case CrewMemberModel::CrewType::FlightAttendant:
-            std::cout << "Available Flight Attendants:" << std::endl;
-            break;
-        default:
-            std::cout << "Available Crew Members:" << std::endl;
-            break;
-    }
     int index = 1;
     for (const auto& crewMember : crewMembers) {
-        std::cout << index << ". Crew ID: " << crewMember -> getCrewId() << ", Name: " << crewMember -> getName() << std::endl;
+        screen << index << ". Crew ID: " << crewMember -> getCrewId() << ", Name: " << crewMember -> getName() << ", Role: ";
+        screen << (crewMember -> getRole() == CrewMemberModel::CrewType::Pilot ? "Pilot" : "Flight Attendant") << '\n';
         index++;
     }
+    screen.flush();
 }
 void AdminInterface::assignCrewToFlight() {
     std::cout << " ----- Assign Crew to Flight ----- " << std::endl;
@@ -443,53 +486,70 @@ void AdminInterface::removeCrewMemberFromFlight() {
     }
 }
 bool AdminInterface::displayAllAircrafts() {
-    auto aircrafts = AdminController::getAllAircrafts(currentUser -> getUserId());
+    auto aircrafts = AdminController::viewAircrafts(currentUser -> getUserId());
     if (aircrafts.empty()) {
-        std::cout << "No aircrafts available. Please add an aircraft first." << std::endl;
+        screen << "No aircrafts available. Please add an aircraft first." << '\n';
+        screen.flush();
         return false;
     }
-    std::cout << "Here is all the aircrafts available:" << std::endl;
+    screen << "Here is all the aircrafts available:" << '\n';
     int index = 1;
     for (const auto& aircraft : aircrafts) {
-        std::cout << index << ". Aircraft ID: " << aircraft -> getAircraftId() << std::endl;
-        std::cout << "   Model: " << aircraft -> getModel() << std::endl;
-        std::cout << "   Capacity: " << aircraft -> getCapacity() << std::endl;
+        screen << index << ". Aircraft ID: " << aircraft.getAircraftId() << '\n';
+        screen << "   Model: " << aircraft.getModel() << '\n';
+        screen << "   Capacity: " << aircraft.getCapacity() << '\n';
         index++;
     }
+    screen.flush();
     return true;
 }
 bool AdminInterface::displayExistingFlights() {
-    auto flights = AdminController::getAllFlights(currentUser -> getUserId());
-    if (flights.empty()) {
-        std::cout << "No flights available." << std::endl;
+    auto page = AdminController::getFlightsPage(currentUser -> getUserId(), std::nullopt, PAGE_SIZE);
+    if (page.rows.empty()) {
+        screen << "No flights available." << '\n';
+        screen.flush();
         return false;
     }
-    std::cout << "Here are the existing flights:" << std::endl;
+    screen << "Here are the existing flights:" << '\n';
     int index = 1;
-    for (const auto& flight : flights) {
-        std::cout << index << ". Flight ID: " << flight -> getFlightId() << std::endl;
-        std::cout << "   Origin: " << flight -> getOrigin() << std::endl;
-        std::cout << "   Destination: " << flight -> getDestination() << std::endl;
-        std::cout << "   Departure: " << flight -> getDepartureTime().toString() << std::endl;
-        std::cout << "   Arrival: " << flight -> getArrivalTime().toString() << std::endl;
-        std::cout << "   Aircraft ID: " << flight -> getAircraftId() << std::endl;
-        
-        // get crew members for the flight
-        auto crewMembers = AdminController::getCrewMembersOfFlight(currentUser->getUserId(), flight->getFlightId());
-        if (!crewMembers.empty()) {
-            std::cout << "   Crew Members: ";
-            for (std::size_t index = 0; index < crewMembers.size(); index++) {
-                std::cout << crewMembers[index]->getName() << " (" 
-                          << (crewMembers[index]->getRole() == CrewMemberModel::CrewType::Pilot ? "Pilot" : "Flight Attendant") 
-                          << ")";
-                if (index < crewMembers.size() - 1) {
-                    std::cout << ", ";
+    while (true) {
+        for (const auto& flight : page.rows) {
+            screen << index << ". Flight ID: " << flight -> getFlightId() << '\n';
+            screen << "   Origin: " << flight -> getOrigin() << '\n';
+            screen << "   Destination: " << flight -> getDestination() << '\n';
+            screen << "   Departure: " << flight -> getDepartureTime().toString() << '\n';
+            screen << "   Arrival: " << flight -> getArrivalTime().toString() << '\n';
+            screen << "   Aircraft ID: " << flight -> getAircraftId() << '\n';
+            
+            // get crew members for the flight
+            auto crewMembers = AdminController::getCrewMembersOfFlight(currentUser->getUserId(), flight->getFlightId());
+            if (!crewMembers.empty()) {
+                screen << "   Crew Members: ";
+                for (std::size_t index = 0; index < crewMembers.size(); index++) {
+                    screen << crewMembers[index]->getName() << " (" 
+                              << (crewMembers[index]->getRole() == CrewMemberModel::CrewType::Pilot ? "Pilot" : "Flight Attendant") 
+                              << ")";
+                    if (index < crewMembers.size() - 1) {
+                        screen << ", ";
+                    }
                 }
+                screen << '\n';
             }
-            std::cout << std::endl;
+            index++;
         }
-        index++;
+        if (!page.next.has_value()) {
+            break;
+        }
+        char more;
+        screen << "Show more flights? (y/n): ";
+        screen.flush();
+        std::cin >> more;
+        if (more != 'y' && more != 'Y') {
+            break;
+        }
+        page = AdminController::getFlightsPage(currentUser -> getUserId(), page.next, PAGE_SIZE);
     }
+    screen.flush();
     return true;
 }
 
@@ -573,8 +633,12 @@ void AdminInterface::removeExistingFlight() {
     }
 
     // Call the controller to remove the flight
-    if (AdminController::removeFlight(currentUser -> getUserId(), flightId)) {
+    auto report = AdminController::removeFlight(currentUser -> getUserId(), flightId);
+    if (report.has_value()) {
         std::cout << "Flight removed successfully!" << std::endl;
+        std::cout << "Reservations rebooked on the same route: " << report -> rebooked << std::endl;
+        std::cout << "Reservations rebooked with a connection: " << report -> rebookedWithConnection << std::endl;
+        std::cout << "Reservations cancelled for lack of seats: " << report -> cancelled << std::endl;
     } else {
         std::cout << "Failed to remove flight. Please check the details and try again." << std::endl;
     }
@@ -664,20 +728,22 @@ void AdminInterface::addAircraft() {
 }
 
 bool AdminInterface::displayExistingAircrafts() {
-    auto aircrafts = AdminController::getAllAircrafts(currentUser -> getUserId());
+    auto aircrafts = AdminController::viewAircrafts(currentUser -> getUserId());
     if (aircrafts.empty()) {
-        std::cout << "No aircrafts available." << std::endl;
+        screen << "No aircrafts available." << '\n';
+        screen.flush();
         return false;
     }
-    std::cout << "Here are the existing aircrafts:" << std::endl;
+    screen << "Here are the existing aircrafts:" << '\n';
     int index = 1;
     for (const auto& aircraft : aircrafts) {
-        std::cout << index << ". Aircraft ID: " << aircraft -> getAircraftId() << std::endl;
-            std::cout << "   Model: " << aircraft -> getModel() << std::endl;
-            std::cout << "   Capacity: " << aircraft -> getCapacity() << std::endl;
-            std::cout << "   Number of Seats in each row: " << aircraft -> getNumOfRowSeats() << std::endl;
+        screen << index << ". Aircraft ID: " << aircraft.getAircraftId() << '\n';
+            screen << "   Model: " << aircraft.getModel() << '\n';
+            screen << "   Capacity: " << aircraft.getCapacity() << '\n';
+            screen << "   Number of Seats in each row: " << aircraft.getNumOfRowSeats() << '\n';
             index++;
     }
+    screen.flush();
     return true;
 }
 
@@ -759,12 +825,13 @@ void AdminInterface::displayManageUsersMenu() {
     std::cout << "2. Update User Password" << std::endl;
     std::cout << "3. Remove User" << std::endl;
     std::cout << "4. View Users" << std::endl;
-    std::cout << "5. Back to Admin Menu" << std::endl;
+    std::cout << "5. Search Users" << std::endl;
+    std::cout << "6. Back to Admin Menu" << std::endl;
 }
 
 void AdminInterface::handleUsers() {
     int choice = 0;
-    while (choice != BACK_OPTION) {
+    while (choice != USERS_BACK_OPTION) {
         displayManageUsersMenu();
         std::cout << "Choice: ";
         std::cin >> choice;
@@ -781,7 +848,10 @@ void AdminInterface::handleUsers() {
             case VIEW_USERS_OPTION:
                 displayExistingUsers();
                 break;
-            case BACK_OPTION:
+            case SEARCH_USERS_OPTION:
+                searchUsers();
+                break;
+            case USERS_BACK_OPTION:
                 return;
             default:
                 std::cout << "Invalid choice. Please try again." << std::endl;
@@ -833,39 +903,48 @@ void AdminInterface::addUser() {
 }
 
 bool AdminInterface::displayExistingUsers() {
-    auto users = AdminController::getAllUsers(currentUser -> getUserId());
+    auto users = AdminController::viewUsers(currentUser -> getUserId());
     if (users.size() <= 1) { // Only the current admin exists
-        std::cout << "No other users available." << std::endl;
+        screen << "No other users available." << '\n';
+        screen.flush();
         return false;
     }
-    std::cout << "Here are the existing users:" << std::endl;
+    screen << "Here are the existing users:" << '\n';
     int index = 1;
     for (const auto& user : users) {
-        if (user -> getUserId() == currentUser -> getUserId()) {
+        if (user.getUserId() == currentUser -> getUserId()) {
             continue; // Skip displaying the current admin user
         }
-        std::cout << index << ". User ID: " << user -> getUserId() << std::endl;
-        std::cout << "   Username: " << user -> getUsername() << std::endl;
-        std::cout << "   Role: ";
-        switch (user -> getRole()) {
-            case UserModel::UserType::Passenger:
-                std::cout << "Passenger" << std::endl;
-                break;
-            case UserModel::UserType::Admin:
-                std::cout << "Admin" << std::endl;
-                break;
-            case UserModel::UserType::BookingManager:
-                std::cout << "Booking Manager" << std::endl;
-                break;
-            default:
-                std::cout << "Unknown" << std::endl;
-                break;
-        }
+        screen << index << ". User ID: " << user.getUserId() << '\n';
+        screen << "   Username: " << user.getUsername() << '\n';
+        screen << "   Role: " << getRoleLabel(user.getRole()) << '\n';
         index++;
     }
+    screen.flush();
     return true;
 }
 
+void AdminInterface::searchUsers() {
+    std::cout << " ----- Search Users ----- " << std::endl;
+    std::string prefix;
+    std::cout << "Enter the beginning of the username: ";
+    std::cin >> prefix;
+
+    auto users = AdminController::searchUsers(currentUser -> getUserId(), prefix, PAGE_SIZE);
+    if (users.empty()) {
+        std::cout << "No users found." << std::endl;
+        return;
+    }
+    int index = 1;
+    for (const auto& user : users) {
+        screen << index << ". User ID: " << user -> getUserId() << '\n';
+        screen << "   Username: " << user -> getUsername() << '\n';
+        screen << "   Role: " << getRoleLabel(user -> getRole()) << '\n';
+        index++;
+    }
+    screen.flush();
+}
+
 void AdminInterface::updateExistingUser() {
     std::cout << " ----- Update Existing User ----- " << std::endl;
     if(!displayExistingUsers()) {
@@ -1,9 +1,12 @@
 #include "../include/BookingManagerInterface.hpp"
+#include "../include/SeatMapRenderer.hpp"
 #include "../../Controller/include/BookingManagerController.hpp"
 #include "../../Model/include/Passenger.hpp"
 #include <iostream>
 #include <limits>
 
+static const std::size_t PAGE_SIZE = 10;
+
 BookingManagerInterface::BookingManagerInterface(const std::shared_ptr<BookingManager>& bookingManager)
     : currentUser(bookingManager) {}
 
@@ -19,7 +22,8 @@ void BookingManagerInterface::displayBookingManagerMenu() {
     std::cout << "3. Book a Flight" << std::endl;
     std::cout << "4. Modify a Booking" << std::endl;
     std::cout << "5. Cancel a Booking" << std::endl;
-    std::cout << "6. Logout" << std::endl;
+    std::cout << "6. Record Boarding" << std::endl;
+    std::cout << "7. Logout" << std::endl;
     std::cout << "Choice: ";
 }
 
@@ -46,6 +50,9 @@ void BookingManagerInterface::startInterface() {
             case CANCEL_BOOKING_OPTION:
                 cancelBooking();
                 break;
+            case RECORD_BOARDING_OPTION:
+                recordBoarding();
+                break;
             case LOGOUT_OPTION:
                 std::cout << "Logging out..." << std::endl;
                 break;
@@ -89,85 +96,90 @@ void BookingManagerInterface::searchFlights() {
 }
 
 bool BookingManagerInterface::viewBookings() {
-    // Implement view bookings logic here
-    auto reservations = BookingManagerController::getAllReservations(currentUser->getUserId());
-    if (reservations.empty()) {
-        std::cout << "No reservations found." << std::endl;
+    auto page = BookingManagerController::getReservationsPage(currentUser->getUserId(), std::nullopt, PAGE_SIZE);
+    if (page.rows.empty()) {
+        screen << "No reservations found." << '\n';
+        screen.flush();
         return false;
     }
 
-    std::cout << "Available Reservations:" << std::endl;
+    screen << "Available Reservations:" << '\n';
     int index = 1;
-    for (const auto& reservation : reservations) {
-        std::cout << index << ". Reservation ID: " << reservation->getReservationId() << std::endl;
-        std::cout << "   Flight ID: " << reservation->getFlightId() <<  std::endl;
-        std::cout << "   Seat Number: " << reservation->getSeatNumber() << std::endl;
-        std::cout << "   Status: " << (reservation->getStatus() == ReservationModel::ReservationStatus::CONFIRMED ? "Confirmed" : "Cancelled") << std::endl;
-        std::cout << "   Passenger ID: " << reservation->getPassengerId() << std::endl;
-        std::cout << "------------------------" << std::endl;
-        index++;
+    while (true) {
+        for (const auto& reservation : page.rows) {
+            screen << index << ". Reservation ID: " << reservation->getReservationId() << '\n';
+            screen << "   Flight ID: " << reservation->getFlightId() << '\n';
+            screen << "   Seat Number: " << (reservation->hasSeat() ? reservation->getSeatNumber() : "Unassigned") << '\n';
+            screen << "   Status: " << reservation->getStatusLabel() << '\n';
+            screen << "   Passenger ID: " << reservation->getPassengerId() << '\n';
+            screen << "------------------------" << '\n';
+            index++;
+        }
+        if (!page.next.has_value()) {
+            break;
+        }
+        char more;
+        screen << "Show more reservations? (y/n): ";
+        screen.flush();
+        std::cin >> more;
+        if (more != 'y' && more != 'Y') {
+            break;
+        }
+        page = BookingManagerController::getReservationsPage(currentUser->getUserId(), page.next, PAGE_SIZE);
     }
+    screen.flush();
     return true;
 }
 void BookingManagerInterface::displayAllPassengers() {
-    auto passengers = BookingManagerController::getAllPassengers(currentUser->getUserId());
-    if (passengers.empty()) {
-        std::cout << "No passengers found." << std::endl;
-        return;
-    }
-    std::cout << "Available Passengers:" << std::endl;
+    auto users = BookingManagerController::viewUsers(currentUser->getUserId());
     int index = 1;
-    for (const auto& user : passengers) {
-        auto passenger = std::dynamic_pointer_cast<Passenger>(user);
-        std::cout << index << ". Passenger ID: " << passenger -> getUserId() << std::endl;
-        std::cout << "   Name: " << passenger -> getUsername() << std::endl;
-        std::cout << "   Loyalty Points: " << passenger -> getLoyaltyPoints() << std::endl;
-        std::cout << "------------------------" << std::endl;
+    for (const auto& user : users) {
+        auto passenger = userCast<Passenger>(&user);
+        if (passenger == nullptr) {
+            continue;
+        }
+        if (index == 1) {
+            screen << "Available Passengers:" << '\n';
+        }
+        screen << index << ". Passenger ID: " << passenger -> getUserId() << '\n';
+        screen << "   Name: " << passenger -> getUsername() << '\n';
+        screen << "   Loyalty Points: " << passenger -> getLoyaltyPoints() << '\n';
+        screen << "------------------------" << '\n';
         index++;
     }
+    if (index == 1) {
+        screen << "No passengers found." << '\n';
+    }
+    screen.flush();
 }
 void BookingManagerInterface::displayAllFlights() {
-    auto flights = BookingManagerController::getAllFlights(currentUser->getUserId());
-    if (flights.empty()) {
-        std::cout << "No flights found." << std::endl;
+    auto flights = BookingManagerController::getFlightsSnapshot(currentUser->getUserId());
+    if (!flights.has_value() || flights -> empty()) {
+        screen << "No flights found." << '\n';
+        screen.flush();
         return;
     }
-    std::cout << "Available Flights:" << std::endl;
+    screen << "Available Flights:" << '\n';
     int index = 1;
-    for (const auto& flight : flights) {
-        std::cout << index << ". Flight ID: " << flight->getFlightId() << std::endl;
-        std::cout << "   Origin: " << flight->getOrigin() << std::endl;
-        std::cout << "   Destination: " << flight->getDestination() << std::endl;
-        std::cout << "   Departure Time: " << flight->getDepartureTime().toString() << std::endl;
-        std::cout << "   Arrival Time: " << flight->getArrivalTime().toString() << std::endl;
-        std::cout << "------------------------" << std::endl;
+    for (const auto& flight : *flights) {
+        screen << index << ". Flight ID: " << flight.getFlightId() << '\n';
+        screen << "   Origin: " << flight.getOrigin() << '\n';
+        screen << "   Destination: " << flight.getDestination() << '\n';
+        screen << "   Departure Time: " << flight.getDepartureTime().toString() << '\n';
+        screen << "   Arrival Time: " << flight.getArrivalTime().toString() << '\n';
+        screen << "------------------------" << '\n';
         index++;
     }
+    screen.flush();
 }
 void BookingManagerInterface::displaySeatMap(const std::vector<std::vector<bool>>& seatMap) {
-    if (seatMap.empty()) {
-        std::cout << "No seat map available for this flight." << std::endl;
-        return;
-    }
-
-    std::cout << "Legend: [O] = Available, [X] = Occupied" << std::endl;
-    for(std::size_t index = 0; index < seatMap.size(); index++) {
-        std::cout << "Row " << (index + 1) << "\t";
-        for(std::size_t j = 0; j < seatMap[index].size(); j++) {
-            if(seatMap[index][j]) {
-                std::cout << "[X]\t"; // Occupied
-            } else {
-                std::cout << "[O]\t"; // Available
-            }
-        }
-        std::cout << std::endl;
-    }
+    SeatMapRenderer::render(seatMap, screen, ScreenBuffer::supportsColor());
+    screen.flush();
 }
 void BookingManagerInterface::bookFlight() {
     std::string passengerId;
     std::string flightId;
     std::string seatNumber;
-    int paymentTypeChoice;
     std::string paymentType;
     JSON paymentDetails;
 
@@ -228,8 +240,59 @@ void BookingManagerInterface::bookFlight() {
     std::cout << "Flight selected: " << flightOpt.value() -> getFlightId() << std::endl;
 
     auto flight = flightOpt.value();
-    displaySeatMap(flight -> getSeatMap());
-    attempts = 0;
+    if (flight -> isFullyBooked()) {
+        if (!offerSaleWithoutSeat(passengerId, flightId)) {
+            return;
+        }
+    }
+    else if (!selectSeat(*flight, seatNumber)) {
+        return;
+    }
+    
+    if (!selectPaymentMethod(paymentType, paymentDetails)) {
+        return;
+    }
+    try {
+        auto reservationOpt = BookingManagerController::createReservation(
+                currentUser->getUserId(), 
+                passengerId, 
+                flightId, 
+                seatNumber, 
+                paymentType, 
+                paymentDetails
+        );
+        if (reservationOpt.has_value()) {
+            auto reservation = reservationOpt.value();
+            std::cout << "Flight booked successfully! Reservation ID: " << reservation->getReservationId() << std::endl;
+            if (!reservation->hasSeat()) {
+                std::cout << "No seat assigned yet; one is assigned as soon as a seat is freed." << std::endl;
+            }
+            if (reservation && !reservation->getPaymentId().empty()) {
+                try {
+                    std::string paymentResult = BookingManagerController::processPayment(
+                        currentUser->getUserId(), 
+                        reservation->getPaymentId()
+                    );
+                    std::cout << "Payment Status: " << paymentResult << std::endl;
+                } catch (const std::exception& e) {
+                    std::cout << "Payment processing failed: " << e.what() << std::endl;
+                    std::cout << "Reservation created but payment needs manual processing." << std::endl;
+                }
+            } else {
+                std::cout << "Warning: No payment ID generated. Manual payment processing required." << std::endl;
+            }
+        } else {
+            std::cout << "Failed to book flight. Please check the details and try again." << std::endl;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cout << "An error occurred while booking the flight: " << e.what() << std::endl;
+    }
+}
+bool BookingManagerInterface::selectSeat(const FlightModel& flight, std::string& seatNumber) {
+    int maxAttempts = 3;
+    int attempts = 0;
+    displaySeatMap(flight.getSeatMap());
 
     do {
         attempts++;
@@ -240,12 +303,12 @@ void BookingManagerInterface::bookFlight() {
             continue;
         }
         try {
-            if (!flight -> isValidSeat(seatNumber)) {
+            if (!flight.isValidSeat(seatNumber)) {
                 std::cout << "Invalid seat number format. Please try again." << std::endl;
                 seatNumber.clear();
                 continue;
             }
-            if (flight -> getSeatStatus(seatNumber)) {
+            if (flight.getSeatStatus(seatNumber)) {
                 std::cout << "Seat is already occupied or invalid. Please choose another seat." << std::endl;
                 seatNumber.clear();
                 continue;
@@ -263,9 +326,24 @@ void BookingManagerInterface::bookFlight() {
     } while ((attempts < maxAttempts) && seatNumber.empty());
     if (attempts >= maxAttempts || seatNumber.empty()) {
         std::cout << "Maximum attempts reached or invalid seat. Aborting booking." << std::endl;
-        return;
+        return false;
     }
-    
+    return true;
+}
+bool BookingManagerInterface::offerSaleWithoutSeat(const std::string& passengerId, const std::string& flightId) {
+    if (!BookingManagerController::canSellWithoutSeat(currentUser->getUserId(), flightId)) {
+        joinWaitlist(passengerId, flightId);
+        return false;
+    }
+    char sell;
+    std::cout << "All seats are taken, but the flight may still be overbooked." << std::endl;
+    std::cout << "Sell a reservation without a seat? A seat is assigned as soon as one is freed. (y/n): ";
+    std::cin >> sell;
+    clearInputBuffer();
+    return (sell == 'y' || sell == 'Y');
+}
+bool BookingManagerInterface::selectPaymentMethod(std::string& paymentType, JSON& paymentDetails) {
+    int paymentTypeChoice;
     std::cout << "Please Select Payment Type: " << std::endl;
     std::cout << "1. Cash" << std::endl;
     std::cout << "2. Credit Card" << std::endl;
@@ -309,41 +387,32 @@ void BookingManagerInterface::bookFlight() {
             break;
         default:
             std::cout << "Invalid payment type selected." << std::endl;
-            return;
+            return false;
     }
-    try {
-        auto reservationOpt = BookingManagerController::createReservation(
-                currentUser->getUserId(), 
-                passengerId, 
-                flightId, 
-                seatNumber, 
-                paymentType, 
-                paymentDetails
-        );
-        if (reservationOpt.has_value()) {
-            auto reservation = reservationOpt.value();
-            std::cout << "Flight booked successfully! Reservation ID: " << reservation->getReservationId() << std::endl;
-            if (reservation && !reservation->getPaymentId().empty()) {
-                try {
-                    std::string paymentResult = BookingManagerController::processPayment(
-                        currentUser->getUserId(), 
-                        reservation->getPaymentId()
-                    );
-                    std::cout << "Payment Status: " << paymentResult << std::endl;
-                } catch (const std::exception& e) {
-                    std::cout << "Payment processing failed: " << e.what() << std::endl;
-                    std::cout << "Reservation created but payment needs manual processing." << std::endl;
-                }
-            } else {
-                std::cout << "Warning: No payment ID generated. Manual payment processing required." << std::endl;
-            }
-        } else {
-            std::cout << "Failed to book flight. Please check the details and try again." << std::endl;
-        }
+    return true;
+}
+void BookingManagerInterface::joinWaitlist(const std::string& passengerId, const std::string& flightId) {
+    std::cout << "This flight is fully booked. Passengers on the waitlist: "
+              << BookingManagerController::getWaitlistLength(currentUser->getUserId(), flightId) << std::endl;
+    char join;
+    std::cout << "Add the passenger to the waitlist? (y/n): ";
+    std::cin >> join;
+    clearInputBuffer();
+    if (join != 'y' && join != 'Y') {
+        return;
     }
-    catch (const std::exception& e) {
-        std::cout << "An error occurred while booking the flight: " << e.what() << std::endl;
+    std::string paymentType;
+    JSON paymentDetails;
+    std::cout << "The seat is charged when it is assigned to the passenger." << std::endl;
+    if (!selectPaymentMethod(paymentType, paymentDetails)) {
+        return;
+    }
+    auto entryOpt = BookingManagerController::joinWaitlist(currentUser->getUserId(), passengerId, flightId, paymentType, paymentDetails);
+    if (!entryOpt.has_value()) {
+        std::cout << "Failed to join the waitlist. Please check the details and try again." << std::endl;
+        return;
     }
+    std::cout << "Passenger added to the waitlist. Waitlist entry ID: " << entryOpt.value()->getEntryId() << std::endl;
 }
 void BookingManagerInterface::modifyBooking() {
     std::string reservationId;
@@ -379,9 +448,10 @@ void BookingManagerInterface::modifyBooking() {
 
 
     if (!newSeatNumber.empty()) {
-        reservation->setSeatNumber(newSeatNumber);
-        if (!BookingManagerController::updateReservation(currentUser->getUserId(), *reservation)) {
-            std::cout << "Failed to update reservation." << std::endl;
+        ReservationModel modified = *reservation;
+        modified.assignSeatNumber(newSeatNumber);
+        if (!BookingManagerController::updateReservation(currentUser->getUserId(), modified)) {
+            std::cout << "Failed to update reservation. The seat may be taken or the reservation was changed by someone else." << std::endl;
             return;
         }
         std::cout << "Reservation modified successfully!" << std::endl;
@@ -425,4 +495,27 @@ void BookingManagerInterface::cancelBooking() {
     } else {
         std::cout << "Cancellation aborted." << std::endl;
     }
+}
+void BookingManagerInterface::recordBoarding() {
+    std::string reservationId;
+    if(!viewBookings()) {
+        return;
+    }
+    clearInputBuffer();
+    std::cout << "Please enter the Reservation ID of the passenger: ";
+    std::getline(std::cin, reservationId);
+
+    char boarded;
+    std::cout << "Did the passenger board the flight? (y = boarded, n = no-show): ";
+    std::cin >> boarded;
+    if (boarded != 'y' && boarded != 'Y' && boarded != 'n' && boarded != 'N') {
+        std::cout << "Invalid choice. Nothing recorded." << std::endl;
+        return;
+    }
+    bool isBoarded = (boarded == 'y' || boarded == 'Y');
+    if (!BookingManagerController::recordBoardingOutcome(currentUser->getUserId(), reservationId, isBoarded)) {
+        std::cout << "Failed to record the outcome. Only confirmed reservations can be recorded, and only passengers with a seat can board." << std::endl;
+        return;
+    }
+    std::cout << (isBoarded ? "Boarding recorded." : "No-show recorded; the seat was released.") << std::endl;
 }
\ No newline at end of file
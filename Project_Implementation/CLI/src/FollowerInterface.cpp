@@ -0,0 +1,79 @@
+#include "../include/FollowerInterface.hpp"
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+FollowerInterface::FollowerInterface(const std::string& socketPath) : follower(socketPath) {}
+
+void FollowerInterface::clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+void FollowerInterface::displayFollowerMenu() {
+    auto status = follower.getStatus();
+    if (!status.connected) {
+        std::cout << "*** Replication stopped: " << (status.error.empty() ? "unknown reason" : status.error)
+                  << " Promote this follower to take over. ***" << std::endl;
+    }
+    std::cout << "Hot Standby (applied LSN " << status.appliedLsn << ") - Please choose an option:" << std::endl;
+    std::cout << "1. View Replication Status" << std::endl;
+    std::cout << "2. Promote to Primary" << std::endl;
+    std::cout << "3. Exit" << std::endl;
+    std::cout << "Choice: ";
+}
+
+bool FollowerInterface::startInterface() {
+    int choice = 0;
+    do {
+        displayFollowerMenu();
+        if (!(std::cin >> choice)) {
+            if (std::cin.eof()) {
+                return false;
+            }
+            clearInputBuffer();
+            choice = 0;
+        }
+
+        switch (choice) {
+            case VIEW_STATUS_OPTION:
+                displayStatus();
+                break;
+            case PROMOTE_OPTION:
+                follower.promote();
+                std::cout << "Promoted to primary at LSN " << follower.getStatus().appliedLsn << "." << std::endl;
+                return true;
+            case EXIT_OPTION:
+                std::cout << "Exiting the follower. Goodbye!" << std::endl;
+                break;
+            default:
+                std::cout << "Invalid choice. Please try again." << std::endl;
+        }
+    } while (choice != EXIT_OPTION);
+    return false;
+}
+
+void FollowerInterface::displayStatus() {
+    auto status = follower.getStatus();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << " ----- Replication Status ----- " << std::endl;
+    std::cout << "Connected: " << (status.connected ? "yes" : "no") << std::endl;
+    if (!status.error.empty()) {
+        std::cout << "Last error: " << status.error << std::endl;
+    }
+    std::cout << "Applied LSN: " << status.appliedLsn << " / primary LSN: " << status.primaryLsn
+              << " (" << (status.primaryLsn > status.appliedLsn ? status.primaryLsn - status.appliedLsn : 0)
+              << " records behind)" << std::endl;
+    std::cout << "Records applied: " << status.recordsApplied << " (" << status.bytesApplied << " bytes)" << std::endl;
+    if (status.caughtUp) {
+        std::cout << "Catch-up: " << status.catchUpRecords << " records in " << status.catchUpSeconds << " s ("
+                  << status.catchUpRecordsPerSecond << " records/s, "
+                  << status.catchUpBytesPerSecond / 1024.0 << " KiB/s)" << std::endl;
+    } else {
+        std::cout << "Catch-up: in progress" << std::endl;
+    }
+    std::cout << "Replication lag (ms): last " << status.lastLagMillis << ", average " << status.averageLagMillis
+              << ", max " << status.maxLagMillis << std::endl;
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+}
@@ -1,6 +1,14 @@
 #include "../include/PassengerInterface.hpp"
+#include "../include/SeatMapRenderer.hpp"
 #include "../../Controller/include/PassengerController.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+
+static const std::size_t MAX_AIRPORT_SUGGESTIONS = 5;
+static const std::size_t FLEXIBLE_DAYS = 3;
 
 PassengerInterface::PassengerInterface(const std::shared_ptr<Passenger>& passenger) : currentUser(passenger) {}
 
@@ -41,6 +49,90 @@ void PassengerInterface::displayPassengerMenu() {
     std::cout << "Choice: ";
 }
 
+std::string PassengerInterface::selectAirport(const std::string& prompt) {
+    std::string input;
+    std::cout << prompt;
+    std::getline(std::cin, input);
+
+    auto suggestions = PassengerController::suggestAirports(currentUser->getUserId(), input, MAX_AIRPORT_SUGGESTIONS);
+    if (suggestions.empty()) {
+        return input;
+    }
+    // An airport whose code was typed is suggested first and needs no confirmation
+    std::string upperInput = input;
+    for (char& c : upperInput) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    const auto& first = suggestions.front();
+    if (suggestions.size() == 1 || first->getCode() == upperInput) {
+        std::cout << "Airport: " << first->getCode() << " - " << first->getName() << ", " << first->getCity() << std::endl;
+        return first->getCode();
+    }
+
+    std::cout << "Did you mean:" << std::endl;
+    for (std::size_t i = 0; i < suggestions.size(); i++) {
+        std::cout << i + 1 << ". " << suggestions[i]->getCode() << " - " << suggestions[i]->getName() << ", " << suggestions[i]->getCity() << std::endl;
+    }
+    std::cout << "Choose an airport (or '0' to keep \"" << input << "\"): ";
+    std::string choice;
+    std::getline(std::cin, choice);
+    try {
+        std::size_t index = std::stoul(choice);
+        if (index >= 1 && index <= suggestions.size()) {
+            return suggestions[index - 1]->getCode();
+        }
+    } catch (const std::exception&) {
+        std::cout << "Invalid choice." << std::endl;
+    }
+    return input;
+}
+
+AvailabilityFilter PassengerInterface::selectAvailabilityFilter() {
+    AvailabilityFilter filter;
+    filter.minFreeSeats = 1;
+    std::string input;
+    std::cout << "Number of seats needed (press Enter for 1): ";
+    std::getline(std::cin, input);
+    if (!input.empty()) {
+        try {
+            filter.minFreeSeats = std::max<std::size_t>(std::stoul(input), 1);
+        } catch (const std::exception&) {
+            std::cout << "Invalid number, searching for 1 seat." << std::endl;
+        }
+    }
+    std::cout << "Cabin: 1. Any  2. First  3. Business  4. Economy (press Enter for any): ";
+    std::getline(std::cin, input);
+    if (input == "2") {
+        filter.cabin = FareRules::Cabin::First;
+    }
+    else if (input == "3") {
+        filter.cabin = FareRules::Cabin::Business;
+    }
+    else if (input == "4") {
+        filter.cabin = FareRules::Cabin::Economy;
+    }
+    return filter;
+}
+
+void PassengerInterface::displayFareCalendar(const std::string& origin, const std::string& destination, const DateTime& departureDate) {
+    auto calendar = PassengerController::getFareCalendar(currentUser->getUserId(), origin, destination, departureDate, FLEXIBLE_DAYS);
+    std::cout << "Fares from " << origin << " to " << destination << " around the selected date:" << std::endl;
+    for (const auto& day : calendar) {
+        std::cout << (day.date.sameDay(departureDate) ? " * " : "   ") << day.date.toString().substr(0, 10) << ": ";
+        if (day.flights == 0) {
+            std::cout << "no flights" << std::endl;
+        }
+        else if (!day.lowestFare.has_value()) {
+            std::cout << day.flights << " flight(s), sold out" << std::endl;
+        }
+        else {
+            std::ostringstream fare;
+            fare << std::fixed << std::setprecision(2) << day.lowestFare.value();
+            std::cout << day.flights << " flight(s), " << day.freeSeats << " seats free, from $" << fare.str() << std::endl;
+        }
+    }
+}
+
 void PassengerInterface::searchFlights() {
     std::string origin;
     std::string destination;
@@ -50,18 +142,19 @@ void PassengerInterface::searchFlights() {
     
     clearInputBuffer();
     std::cout << " ----- Search Flights ----- " << std::endl;
-    std::cout << "Please enter the origin of the flight: ";
-    std::getline(std::cin, origin);
-    std::cout << "Please enter the destination of the flight: ";
-    std::getline(std::cin, destination);
+    origin = selectAirport("Please enter the origin of the flight: ");
+    destination = selectAirport("Please enter the destination of the flight: ");
     std::cout << "Please enter the departure date (YYYY-MM-DD): ";
     std::getline(std::cin, departureDateStr);
 
+    AvailabilityFilter filter = selectAvailabilityFilter();
+
     DateTime departureDate(departureDateStr);
-    auto flights = PassengerController::getFlightsByRouteAndDate(currentUser->getUserId(), origin, destination, departureDate);
+    displayFareCalendar(origin, destination, departureDate);
+    auto flights = PassengerController::getFlightsByRouteAndDate(currentUser->getUserId(), origin, destination, departureDate, filter);
     
     if (flights.empty()) {
-        std::cout << "No flights found for the specified criteria." << std::endl;
+        std::cout << "No flights with enough free seats found for the specified criteria." << std::endl;
         return;
     }
     std::cout << "Available Flights:" << std::endl;
@@ -173,41 +266,28 @@ void PassengerInterface::searchFlights() {
 
 void PassengerInterface::viewReservations() {
     clearInputBuffer();
-    std::cout << " ----- View Reservations ----- " << std::endl;
+    screen << " ----- View Reservations ----- " << '\n';
     auto reservations = PassengerController::getPassengerReservations(currentUser->getUserId());
     if (reservations.empty()) {
-        std::cout << "No reservations found." << std::endl;
+        screen << "No reservations found." << '\n';
+        screen.flush();
         return;
     }
     
-    std::cout << "Your Reservations:" << std::endl;
+    screen << "Your Reservations:" << '\n';
     int index = 1;
     for (const auto& reservation : reservations) {
-        std::cout << index << ". Reservation ID: " << reservation->getReservationId() << std::endl;
-        std::cout << "   Flight ID: " << reservation->getFlightId() <<  std::endl;
-        std::cout << "   Seat Number: " << reservation->getSeatNumber() << std::endl;
-        std::cout << "   Status: " << (reservation->getStatus() == ReservationModel::ReservationStatus::CONFIRMED ? "Confirmed" : "Cancelled") << std::endl;
-        std::cout << "------------------------" << std::endl;
+        screen << index << ". Reservation ID: " << reservation->getReservationId() << '\n';
+        screen << "   Flight ID: " << reservation->getFlightId() << '\n';
+        screen << "   Seat Number: " << (reservation->hasSeat() ? reservation->getSeatNumber() : "Unassigned") << '\n';
+        screen << "   Status: " << reservation->getStatusLabel() << '\n';
+        screen << "------------------------" << '\n';
         index++;
     }
+    screen.flush();
 }
 
 void PassengerInterface::displaySeatMap(const std::vector<std::vector<bool>>& seatMap) {
-    if (seatMap.empty()) {
-        std::cout << "No seat map available for this flight." << std::endl;
-        return;
-    }
-
-    std::cout << "Legend: [O] = Available, [X] = Occupied" << std::endl;
-    for(std::size_t index = 0; index < seatMap.size(); index++) {
-        std::cout << "Row " << (index + 1) << "\t";
-        for(std::size_t j = 0; j < seatMap[index].size(); j++) {
-            if(seatMap[index][j]) {
-                std::cout << "[X]\t"; // Occupied
-            } else {
-                std::cout << "[O]\t"; // Available
-            }
-        }
-        std::cout << std::endl;
-    }
+    SeatMapRenderer::render(seatMap, screen, ScreenBuffer::supportsColor());
+    screen.flush();
 }
\ No newline at end of file
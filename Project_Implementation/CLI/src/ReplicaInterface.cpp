@@ -0,0 +1,104 @@
+#include "../include/ReplicaInterface.hpp"
+#include "../include/SeatMapRenderer.hpp"
+#include <iostream>
+#include <limits>
+
+ReplicaInterface::ReplicaInterface(const std::string& segmentName) : reader(segmentName) {}
+
+void ReplicaInterface::clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+void ReplicaInterface::displayReplicaMenu() {
+    std::cout << "Read Replica (snapshot epoch " << reader.getEpoch() << ") - Please choose an option:" << std::endl;
+    std::cout << "1. Search Flights" << std::endl;
+    std::cout << "2. View Seat Map" << std::endl;
+    std::cout << "3. Exit" << std::endl;
+    std::cout << "Choice: ";
+}
+
+void ReplicaInterface::startInterface() {
+    int choice = 0;
+    do {
+        displayReplicaMenu();
+        if (!(std::cin >> choice)) {
+            if (std::cin.eof()) {
+                return;
+            }
+            clearInputBuffer();
+            choice = 0;
+        }
+
+        switch (choice) {
+            case SEARCH_FLIGHTS_OPTION:
+                searchFlights();
+                break;
+            case VIEW_SEAT_MAP_OPTION:
+                viewSeatMap();
+                break;
+            case EXIT_OPTION:
+                std::cout << "Exiting the replica. Goodbye!" << std::endl;
+                break;
+            default:
+                std::cout << "Invalid choice. Please try again." << std::endl;
+        }
+    } while (choice != EXIT_OPTION);
+}
+
+void ReplicaInterface::searchFlights() {
+    std::string origin;
+    std::string destination;
+    std::string departureDateStr;
+
+    clearInputBuffer();
+    std::cout << " ----- Search Flights ----- " << std::endl;
+    std::cout << "Please enter the origin of the flight: ";
+    std::getline(std::cin, origin);
+    std::cout << "Please enter the destination of the flight: ";
+    std::getline(std::cin, destination);
+    std::cout << "Please enter the departure date (YYYY-MM-DD): ";
+    std::getline(std::cin, departureDateStr);
+
+    try {
+        DateTime departureDate(departureDateStr);
+        auto flights = reader.getFlightsByRouteAndDate(origin, destination, departureDate);
+        if (flights.empty()) {
+            std::cout << "No flights found for the specified criteria." << std::endl;
+            return;
+        }
+        std::cout << "Available Flights:" << std::endl;
+        int index = 1;
+        for (const auto& flight : flights) {
+            std::cout << index << ". Flight ID: " << flight.flightId << std::endl;
+            std::cout << "   Origin: " << flight.origin << std::endl;
+            std::cout << "   Destination: " << flight.destination << std::endl;
+            std::cout << "   Departure Time: " << flight.departureTime.toString() << std::endl;
+            std::cout << "   Arrival Time: " << flight.arrivalTime.toString() << std::endl;
+            std::cout << "   Available Seats: " << flight.availableSeats << std::endl;
+            std::cout << "------------------------" << std::endl;
+            index++;
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Invalid search: " << e.what() << std::endl;
+    }
+}
+
+void ReplicaInterface::viewSeatMap() {
+    std::string flightId;
+    clearInputBuffer();
+    std::cout << "Please enter the Flight ID: ";
+    std::getline(std::cin, flightId);
+
+    auto seatMap = reader.getSeatMap(flightId);
+    if (!seatMap.has_value()) {
+        std::cout << "Flight not found in the current snapshot." << std::endl;
+        return;
+    }
+    displaySeatMap(seatMap.value());
+}
+
+void ReplicaInterface::displaySeatMap(const std::vector<std::vector<bool>>& seatMap) {
+    SeatMapRenderer::render(seatMap, screen, ScreenBuffer::supportsColor());
+    screen.flush();
+}
\ No newline at end of file
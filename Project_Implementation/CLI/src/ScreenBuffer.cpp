@@ -0,0 +1,146 @@
+#include "../include/ScreenBuffer.hpp"
+#include <charconv>
+#include <cstdio>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+/**
+ * @brief Constructs an empty screen buffer writing to the given stream.
+ *
+ * @param out The stream the buffered text is written to on flush().
+ */
+ScreenBuffer::ScreenBuffer(std::ostream& out) : out(out) {}
+
+/**
+ * @brief Appends a signed integer in decimal without going through a stream.
+ *
+ * @param value The integer to append.
+ */
+void ScreenBuffer::appendInteger(long long value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends an unsigned integer in decimal without going through a stream.
+ *
+ * @param value The integer to append.
+ */
+void ScreenBuffer::appendUnsigned(unsigned long long value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends text.
+ *
+ * @param text The text to append.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::operator<<(std::string_view text) {
+    buffer.append(text);
+    return *this;
+}
+
+/**
+ * @brief Appends a null-terminated string.
+ *
+ * @param text The string to append.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::operator<<(const char* text) {
+    buffer.append(text);
+    return *this;
+}
+
+/**
+ * @brief Appends a string.
+ *
+ * @param text The string to append.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::operator<<(const std::string& text) {
+    buffer.append(text);
+    return *this;
+}
+
+/**
+ * @brief Appends a single character.
+ *
+ * @param character The character to append.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::operator<<(char character) {
+    buffer.push_back(character);
+    return *this;
+}
+
+/**
+ * @brief Appends a floating-point number, formatted like std::cout does by default (%g).
+ *
+ * @param value The number to append.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::operator<<(double value) {
+    char digits[32];
+    int length = std::snprintf(digits, sizeof(digits), "%g", value);
+    if (length > 0) {
+        buffer.append(digits, static_cast<std::size_t>(length));
+    }
+    return *this;
+}
+
+/**
+ * @brief Appends a character a number of times, e.g. for padding and separator lines.
+ *
+ * @param character The character to append.
+ * @param count How many times to append it.
+ * @return ScreenBuffer& This buffer, for chaining.
+ */
+ScreenBuffer& ScreenBuffer::repeat(char character, std::size_t count) {
+    buffer.append(count, character);
+    return *this;
+}
+
+/**
+ * @brief Writes the collected text to the stream in one call and empties the buffer.
+ *
+ * The buffer keeps its capacity for the next screen. The stream is flushed even if
+ * nothing was collected, so prompts written around the buffer appear too.
+ */
+void ScreenBuffer::flush() {
+    if (!buffer.empty()) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    out.flush();
+}
+
+/**
+ * @brief Checks whether standard output is a terminal that can show ANSI colors.
+ *
+ * Output redirected to a file or a pipe gets no escape sequences. The check is made once.
+ *
+ * @return true if standard output is a terminal; false otherwise.
+ */
+bool ScreenBuffer::supportsColor() {
+#ifdef _WIN32
+    static const bool color = _isatty(_fileno(stdout)) != 0;
+#else
+    static const bool color = isatty(STDOUT_FILENO) == 1;
+#endif
+    return color;
+}
+
+/**
+ * @brief Destructor. Writes out whatever text is still buffered.
+ */
+ScreenBuffer::~ScreenBuffer() {
+    flush();
+}
@@ -0,0 +1,91 @@
+#include "../include/SeatMapRenderer.hpp"
+#include <algorithm>
+
+static const char* const GREEN = "\033[32m";
+static const char* const RED = "\033[31m";
+static const char* const RESET = "\033[0m";
+
+/**
+ * @brief Counts the decimal digits of a number, used to right-align row numbers.
+ *
+ * @param value The number.
+ * @return std::size_t The number of digits; 1 for zero.
+ */
+static std::size_t countDigits(std::size_t value) {
+    std::size_t digits = 1;
+    while (value >= 10) {
+        value /= 10;
+        digits++;
+    }
+    return digits;
+}
+
+/**
+ * @brief Returns the index of the first seat after the aisle.
+ *
+ * @param seatsInRow The number of seats in the widest row.
+ * @return std::size_t The seat the aisle precedes, or seatsInRow if the row is too narrow for one.
+ */
+static std::size_t getAisle(std::size_t seatsInRow) {
+    return (seatsInRow >= 4) ? seatsInRow / 2 : seatsInRow;
+}
+
+/**
+ * @brief Renders a seat map with a legend and a header of seat letters.
+ *
+ * @param seatMap The seat map of the flight; true marks an occupied seat.
+ * @param screen The buffer the seat map is appended to; the caller flushes it.
+ * @param color Whether to color available and occupied seats with ANSI escape sequences.
+ */
+void SeatMapRenderer::render(const std::vector<std::vector<bool>>& seatMap, ScreenBuffer& screen, bool color) {
+    if (seatMap.empty()) {
+        screen << "No seat map available for this flight.\n";
+        return;
+    }
+
+    std::size_t seatsInRow = 0;
+    for (const auto& row : seatMap) {
+        seatsInRow = std::max(seatsInRow, row.size());
+    }
+    std::size_t aisle = getAisle(seatsInRow);
+    std::size_t labelWidth = countDigits(seatMap.size());
+
+    if (color) {
+        screen << "Legend: " << GREEN << 'O' << RESET << " = Available, " << RED << 'X' << RESET << " = Occupied\n";
+    } else {
+        screen << "Legend: O = Available, X = Occupied\n";
+    }
+
+    screen.repeat(' ', labelWidth + 1);
+    for (std::size_t seat = 0; seat < seatsInRow; seat++) {
+        if (seat == aisle) {
+            screen << "  ";
+        }
+        screen << static_cast<char>('A' + seat) << ' ';
+    }
+    screen << '\n';
+
+    for (std::size_t index = 0; index < seatMap.size(); index++) {
+        const auto& row = seatMap[index];
+        screen.repeat(' ', labelWidth - countDigits(index + 1));
+        screen << (index + 1) << ' ';
+        const char* current = nullptr;
+        for (std::size_t seat = 0; seat < row.size(); seat++) {
+            if (seat == aisle) {
+                screen << "  ";
+            }
+            if (color) {
+                const char* wanted = row[seat] ? RED : GREEN;
+                if (wanted != current) {
+                    screen << wanted;
+                    current = wanted;
+                }
+            }
+            screen << (row[seat] ? 'X' : 'O') << ' ';
+        }
+        if (current != nullptr) {
+            screen << RESET;
+        }
+        screen << '\n';
+    }
+}
@@ -46,21 +46,21 @@ void UserInterface::handleLogin() {
         case UserModel::UserType::Passenger:
             std::cout << "Redirecting to Passenger Interface..." << std::endl;
             {
-                PassengerInterface passengerInterface(std::dynamic_pointer_cast<Passenger>(user));
+                PassengerInterface passengerInterface(userCast<Passenger>(user));
                 passengerInterface.startInterface();
             }
             break;
         case UserModel::UserType::Admin:
             std::cout << "Redirecting to Admin Interface..." << std::endl;
             {
-                AdminInterface adminInterface(std::dynamic_pointer_cast<Admin>(user));
+                AdminInterface adminInterface(userCast<Admin>(user));
                 adminInterface.startInterface();
             }
             break;
         case UserModel::UserType::BookingManager:
             std::cout << "Redirecting to Booking Manager Interface..." << std::endl;
             {
-                BookingManagerInterface bookingManagerInterface(std::dynamic_pointer_cast<BookingManager>(user));
+                BookingManagerInterface bookingManagerInterface(userCast<BookingManager>(user));
                 bookingManagerInterface.startInterface();
             }
             break;
@@ -9,6 +9,9 @@
 #include "../../Model/include/AircraftModel.hpp"
 #include "../../Model/include/CrewMemberModel.hpp"
 #include "../../Utils/include/DateTime.hpp"
+#include "../../Repositories/include/FlightRepository.hpp"
+#include "../../Repositories/include/RepositoryView.hpp"
+#include "../../Services/include/ReaccommodationService.hpp"
 
 /**
  * @class AdminController
@@ -53,9 +56,17 @@
  */
 
 /**
- * @brief Retrieves all users in the system.
+ * @brief Returns a view over all users in the system, without copying them.
  * @param adminId The unique identifier of the admin performing the operation
- * @return Vector of shared pointers to UserModel objects representing all users
+ * @return View over all users; empty if the admin is not confirmed
+ */
+
+/**
+ * @brief Finds the users whose username starts with a prefix, case-insensitively.
+ * @param adminId The unique identifier of the admin performing the operation
+ * @param prefix The beginning of the username
+ * @param limit The maximum number of users returned
+ * @return The first matching users sorted by username; empty if the admin is not confirmed
  */
 
 /**
@@ -73,10 +84,17 @@
  */
 
 /**
- * @brief Retrieves all crew members, optionally filtered by crew type.
+ * @brief Returns a view over all crew members, without copying them.
+ * @param adminId The unique identifier of the admin performing the operation
+ * @return View over all crew members; empty if the admin is not confirmed
+ */
+
+/**
+ * @brief Finds the crew members whose name starts with a prefix, case-insensitively.
  * @param adminId The unique identifier of the admin performing the operation
- * @param role The crew type to filter by (defaults to Pilot)
- * @return Vector of shared pointers to CrewMemberModel objects
+ * @param prefix The beginning of the name
+ * @param limit The maximum number of crew members returned
+ * @return The first matching crew members sorted by name; empty if the admin is not confirmed
  */
 
 /**
@@ -118,16 +136,18 @@
  */
 
 /**
- * @brief Removes a flight from the system.
+ * @brief Removes a flight from the system and re-accommodates its passengers on other flights.
  * @param adminId The unique identifier of the admin performing the operation
  * @param flightId The unique identifier of the flight to remove
- * @return true if flight removal was successful, false otherwise
+ * @return How many reservations were rebooked or cancelled, or nullopt if the removal failed
  */
 
 /**
- * @brief Retrieves all flights in the system.
+ * @brief Retrieves one page of the flights in the system, sorted by departure time.
  * @param adminId The unique identifier of the admin performing the operation
- * @return Vector of shared pointers to FlightModel objects representing all flights
+ * @param after The cursor returned with the previous page, or nullopt for the first page
+ * @param limit The maximum number of flights in the page
+ * @return The page; empty if the admin is not confirmed
  */
 
 /**
@@ -195,9 +215,9 @@
  */
 
 /**
- * @brief Retrieves all aircraft in the system.
+ * @brief Returns a view over all aircraft in the system, without copying them.
  * @param adminId The unique identifier of the admin performing the operation
- * @return Vector of shared pointers to AircraftModel objects representing all aircraft
+ * @return View over all aircraft; empty if the admin is not confirmed
  */
 class AdminController {
     static bool confirmAdmin(const std::string& adminId);
@@ -209,10 +229,12 @@ public:
         const UserModel::UserType& role);
     static bool updateUserPassword(const std::string& adminId, const std::string& targetUserId, const std::string& newPassword);
     static bool deleteUser(const std::string& adminId, const std::string& targetUserId);
-    static std::vector<std::shared_ptr<UserModel>> getAllUsers(const std::string& adminId);
+    static RepositoryView<UserModel> viewUsers(const std::string& adminId);
+    static std::vector<std::shared_ptr<UserModel>> searchUsers(const std::string& adminId, const std::string& prefix, std::size_t limit);
     static std::optional<std::shared_ptr<UserModel>> getUserById(const std::string& adminId, const std::string& userId);
     static std::optional<std::shared_ptr<CrewMemberModel>> getCrewMemberById(const std::string& adminId, const std::string& crewMemberId);
-    static std::vector<std::shared_ptr<CrewMemberModel>> getAllCrewMembers(const std::string& adminId, const CrewMemberModel::CrewType& role = CrewMemberModel::CrewType::Pilot);
+    static RepositoryView<CrewMemberModel> viewCrewMembers(const std::string& adminId);
+    static std::vector<std::shared_ptr<CrewMemberModel>> searchCrewMembers(const std::string& adminId, const std::string& prefix, std::size_t limit);
 
     // --- Flight Management ---
     static std::optional<std::shared_ptr<FlightModel>> addFlight(
@@ -235,8 +257,12 @@ public:
         const DateTime& arrivalTime,
         const std::string& aircraftId
     );
-    static bool removeFlight(const std::string& adminId, const std::string& flightId);
-    static std::vector<std::shared_ptr<FlightModel>> getAllFlights(const std::string& adminId);
+    static std::optional<ReaccommodationService::Report> removeFlight(const std::string& adminId, const std::string& flightId);
+    static FlightRepository::FlightPage getFlightsPage(
+        const std::string& adminId,
+        const std::optional<FlightRepository::DepartureCursor>& after,
+        std::size_t limit
+    );
 
     static bool assignCrewToFlight(const std::string& adminId, const std::string& flightId, const std::vector<std::string>& crewIds);
     static bool assignCrewToFlight(const std::string& adminId, const std::string& flightId, const std::string& crewId);
@@ -259,5 +285,5 @@ public:
         int numOfRowSeats
     );
     static bool removeAircraft(const std::string& adminId, const std::string& aircraftId);
-    static std::vector<std::shared_ptr<AircraftModel>> getAllAircrafts(const std::string& adminId);
+    static RepositoryView<AircraftModel> viewAircrafts(const std::string& adminId);
 };
\ No newline at end of file
@@ -5,6 +5,10 @@
 #include "../../Model/include/ReservationModel.hpp"
 #include "../../Model/include/FlightModel.hpp"
 #include "../../Model/include/UserModel.hpp"
+#include "../../Model/include/WaitlistEntryModel.hpp"
+#include "../../Repositories/include/FlightRepository.hpp"
+#include "../../Repositories/include/ReservationRepository.hpp"
+#include "../../Repositories/include/RepositoryView.hpp"
 #include <string>
 #include <vector>
 
@@ -24,9 +28,9 @@
  */
 
 /**
- * @brief Retrieves all available flights for an authenticated booking manager
+ * @brief Takes a point-in-time snapshot of all flights for an authenticated booking manager
  * @param bookingManagerId The unique identifier of the booking manager
- * @return Vector of shared pointers to FlightModel objects representing all flights
+ * @return Snapshot to iterate the flights from, or nullopt if authentication fails
  */
 
 /**
@@ -39,15 +43,17 @@
  */
 
 /**
- * @brief Retrieves all passengers in the system
+ * @brief Returns a view over all users in the system, to list the passengers from
  * @param bookingManagerId The unique identifier of the booking manager
- * @return Vector of shared pointers to UserModel objects representing all passengers
+ * @return View over all users; empty if authentication fails
  */
 
 /**
- * @brief Retrieves all reservations in the system
+ * @brief Retrieves one page of the reservations in the system, sorted by reservation ID
  * @param bookingManagerId The unique identifier of the booking manager
- * @return Vector of shared pointers to ReservationModel objects representing all reservations
+ * @param after The cursor returned with the previous page, or nullopt for the first page
+ * @param limit The maximum number of reservations in the page
+ * @return The page; empty if authentication fails
  */
 
 /**
@@ -96,6 +102,38 @@
  * @return True if cancellation was successful, false otherwise
  */
 
+/**
+ * @brief Checks whether a fully booked flight may still sell a reservation without a seat
+ * @param bookingManagerId The unique identifier of the booking manager
+ * @param flightId The unique identifier of the flight
+ * @return True if the flight is fully booked but below its authorized capacity, false otherwise
+ */
+
+/**
+ * @brief Records whether the passenger of a reservation boarded or did not show up
+ * @param bookingManagerId The unique identifier of the booking manager
+ * @param reservationId The unique identifier of the reservation
+ * @param boarded True if the passenger boarded, false for a no-show
+ * @return True if the outcome was recorded, false otherwise
+ */
+
+/**
+ * @brief Puts a passenger on the waitlist of a fully booked flight
+ * @param bookingManagerId The unique identifier of the booking manager
+ * @param passengerId The unique identifier of the passenger
+ * @param flightId The unique identifier of the flight
+ * @param paymentType The payment method charged when a seat is assigned
+ * @param paymentDetails JSON object containing payment-specific details
+ * @return Optional shared pointer to the created WaitlistEntryModel object, empty if the flight has free seats or joining failed
+ */
+
+/**
+ * @brief Retrieves the number of passengers waiting for a flight
+ * @param bookingManagerId The unique identifier of the booking manager
+ * @param flightId The unique identifier of the flight
+ * @return The length of the flight's waitlist, 0 if authentication fails
+ */
+
 /**
  * @brief Processes a payment transaction
  * @param bookingManagerId The unique identifier of the booking manager
@@ -112,15 +150,19 @@
 class BookingManagerController {
         static bool authenticateBookingManager(const std::string& bookingManagerId);
     public:
-        static std::vector<std::shared_ptr<FlightModel>> getAllFlights(const std::string& bookingManagerId);
+        static std::optional<FlightRepository::Snapshot> getFlightsSnapshot(const std::string& bookingManagerId);
         static std::vector<std::shared_ptr<FlightModel>> getFlightsByRouteAndDate(
             const std::string& bookingManagerId, 
             const std::string& origin, 
             const std::string& destination, 
             const DateTime& departureDate
         );
-        static std::vector<std::shared_ptr<UserModel>> getAllPassengers(const std::string& bookingManagerId);
-        static std::vector<std::shared_ptr<ReservationModel>> getAllReservations(const std::string& bookingManagerId);
+        static RepositoryView<UserModel> viewUsers(const std::string& bookingManagerId);
+        static ReservationRepository::ReservationPage getReservationsPage(
+            const std::string& bookingManagerId,
+            const std::optional<ReservationRepository::ReservationCursor>& after,
+            std::size_t limit
+        );
 
         static std::optional<std::shared_ptr<UserModel>> getPassengerDetails(const std::string& bookingManagerId, const std::string& passengerId);
         static std::optional<std::shared_ptr<ReservationModel>> getReservationDetails(const std::string& bookingManagerId, const std::string& reservationId);
@@ -136,6 +178,16 @@ class BookingManagerController {
         );
         static bool updateReservation(const std::string& bookingManagerId, const ReservationModel& reservation);
         static bool cancelReservation(const std::string& bookingManagerId, const std::string& reservationId);
+        static bool canSellWithoutSeat(const std::string& bookingManagerId, const std::string& flightId);
+        static bool recordBoardingOutcome(const std::string& bookingManagerId, const std::string& reservationId, bool boarded);
+        static std::optional<std::shared_ptr<WaitlistEntryModel>> joinWaitlist(
+            const std::string& bookingManagerId,
+            const std::string& passengerId,
+            const std::string& flightId,
+            const std::string& paymentType,
+            const JSON& paymentDetails
+        );
+        static std::size_t getWaitlistLength(const std::string& bookingManagerId, const std::string& flightId);
         static std::string processPayment(const std::string& bookingManagerId, const std::string& paymentId);
         static std::string refundPayment(const std::string& bookingManagerId, const std::string& paymentId);
 };
\ No newline at end of file
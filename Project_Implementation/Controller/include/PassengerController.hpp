@@ -1,11 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <vector>
+#include "../../Model/include/AirportModel.hpp"
 #include "../../Model/include/UserModel.hpp"
 #include "../../Model/include/FlightModel.hpp"
 #include "../../Model/include/ReservationModel.hpp"
+#include "../../Repositories/include/FareCalendarIndex.hpp"
 
 /**
  * @brief Controller class for managing passenger operations in the airline management system.
@@ -32,7 +35,20 @@ public:
         const std::string& passengerId, 
         const std::string& origin, 
         const std::string& destination, 
-        const DateTime& departureDate
+        const DateTime& departureDate,
+        const AvailabilityFilter& filter = {}
+    );
+    static std::vector<FareCalendarDay> getFareCalendar(
+        const std::string& passengerId,
+        const std::string& origin,
+        const std::string& destination,
+        const DateTime& departureDate,
+        std::size_t daysAround
+    );
+    static std::vector<std::shared_ptr<const AirportModel>> suggestAirports(
+        const std::string& passengerId,
+        const std::string& query,
+        std::size_t limit
     );
     static std::optional<std::shared_ptr<ReservationModel>> bookFlight(
         const std::string& passengerId, 
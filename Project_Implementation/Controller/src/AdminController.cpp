@@ -84,21 +84,36 @@ bool AdminController::deleteUser(const std::string& adminId, const std::string&
 }
 
 /**
- * @brief Retrieves all users from the repository if the provided admin ID is valid.
+ * @brief Returns a view over all users if the provided admin ID is valid.
  *
  * This function checks whether the given admin ID corresponds to a valid administrator.
- * If the admin ID is confirmed, it fetches and returns a list of all users from the user repository.
- * If the admin ID is not valid, it returns an empty vector.
+ * If the admin ID is confirmed, it returns a view over the users stored in the user repository,
+ * which copies neither the users nor their shared pointers.
+ * If the admin ID is not valid, it returns an empty view.
  *
  * @param adminId The ID of the administrator requesting the user list.
- * @return std::vector<std::shared_ptr<UserModel>> A vector containing shared pointers to UserModel objects,
+ * @return RepositoryView<UserModel> A view over all users, or an empty view if the admin ID is not valid.
+ */
+RepositoryView<UserModel> AdminController::viewUsers(const std::string& adminId) {
+    if (!confirmAdmin(adminId)) {
+        return {};
+    }
+    return UserManagementService::viewUsers();
+}
+/**
+ * @brief Finds the users whose username starts with a prefix if the provided admin ID is valid.
+ *
+ * @param adminId The ID of the administrator searching the users.
+ * @param prefix The beginning of the username, matched case-insensitively.
+ * @param limit The maximum number of users returned.
+ * @return std::vector<std::shared_ptr<UserModel>> The first matching users sorted by username,
  *         or an empty vector if the admin ID is not valid.
  */
-std::vector<std::shared_ptr<UserModel>> AdminController::getAllUsers(const std::string& adminId) {
+std::vector<std::shared_ptr<UserModel>> AdminController::searchUsers(const std::string& adminId, const std::string& prefix, std::size_t limit) {
     if (!confirmAdmin(adminId)) {
         return {};
     }
-    return UserManagementService::getAllUsers();
+    return UserManagementService::searchUsersByUsername(prefix, limit);
 }
 /**
  * @brief Retrieves a user by their ID if the requesting user is an admin.
@@ -118,19 +133,32 @@ std::optional<std::shared_ptr<UserModel>> AdminController::getUserById(const std
     return UserManagementService::getUserById(userId);
 }
 /**
- * @brief Retrieves all crew members of a specified role if the requester is a confirmed admin.
+ * @brief Returns a view over all crew members if the requester is a confirmed admin.
  * 
  * @param adminId The unique identifier of the admin requesting the crew members.
- * @param role The role of crew members to retrieve (e.g., Pilot, Engineer).
- * @return std::vector<std::shared_ptr<CrewMemberModel>> 
- *         A vector of shared pointers to CrewMemberModel objects matching the specified role.
- *         Returns an empty vector if the adminId is not confirmed.
+ * @return RepositoryView<CrewMemberModel> A view over all crew members.
+ *         Returns an empty view if the adminId is not confirmed.
  */
-std::vector<std::shared_ptr<CrewMemberModel>> AdminController::getAllCrewMembers(const std::string& adminId, const CrewMemberModel::CrewType& role) {
+RepositoryView<CrewMemberModel> AdminController::viewCrewMembers(const std::string& adminId) {
     if (!confirmAdmin(adminId)) {
         return {};
     }
-    return CrewMemberService::getCrewMembersByRole(role);
+    return CrewMemberService::viewCrewMembers();
+}
+/**
+ * @brief Finds the crew members whose name starts with a prefix if the requester is a confirmed admin.
+ *
+ * @param adminId The unique identifier of the admin searching the crew members.
+ * @param prefix The beginning of the name, matched case-insensitively.
+ * @param limit The maximum number of crew members returned.
+ * @return std::vector<std::shared_ptr<CrewMemberModel>> The first matching crew members sorted by name,
+ *         or an empty vector if the adminId is not confirmed.
+ */
+std::vector<std::shared_ptr<CrewMemberModel>> AdminController::searchCrewMembers(const std::string& adminId, const std::string& prefix, std::size_t limit) {
+    if (!confirmAdmin(adminId)) {
+        return {};
+    }
+    return CrewMemberService::searchCrewMembersByName(prefix, limit);
 }
 /**
  * @brief Retrieves a crew member by their ID with admin authorization
@@ -188,19 +216,20 @@ std::optional<std::shared_ptr<FlightModel>> AdminController::addFlight(
  * @brief Removes a flight from the system if the requesting user is an admin.
  *
  * This function verifies the admin privileges of the user identified by `adminId`.
- * If the user is confirmed as an admin, it attempts to remove the flight specified
- * by `flightId` from the flight repository.
+ * If the user is confirmed as an admin, it removes the flight specified by `flightId`
+ * and moves its passengers to other flights through the ReaccommodationService.
  *
  * @param adminId The unique identifier of the admin requesting the removal.
  * @param flightId The unique identifier of the flight to be removed.
- * @return true if the flight was successfully removed; false if the user is not an admin
+ * @return std::optional<ReaccommodationService::Report> How many reservations were rebooked,
+ *         rebooked with a connection or cancelled; std::nullopt if the user is not an admin
  *         or if the removal operation failed.
  */
-bool AdminController::removeFlight(const std::string& adminId, const std::string& flightId) {
+std::optional<ReaccommodationService::Report> AdminController::removeFlight(const std::string& adminId, const std::string& flightId) {
     if (!confirmAdmin(adminId)) {
-        return false;
+        return std::nullopt;
     }
-    return FlightService::deleteFlight(flightId);
+    return ReaccommodationService::removeFlight(flightId);
 }
 
 /**
@@ -218,6 +247,7 @@ bool AdminController::updateFlight(const std::string& adminId, const FlightModel
     if (!confirmAdmin(adminId)) {
         return false;
     }
+    // Not run on the flight's shard: a route change moves the flight to another shard
     return FlightService::updateFlight(updatedFlightData);
 }
 bool AdminController::updateFlight(
@@ -232,24 +262,31 @@ bool AdminController::updateFlight(
     if (!confirmAdmin(adminId)) {
         return false;
     }
+    // Not run on the flight's shard: a route change moves the flight to another shard
     return FlightService::updateFlight(flightId, origin, destination, departureTime, arrivalTime, aircraftId);
 }
 /**
- * @brief Retrieves all flights from the flight repository if the provided admin ID is valid.
+ * @brief Retrieves one page of flights sorted by departure time if the provided admin ID is valid.
  * 
  * This function first verifies the admin's identity using the given adminId.
- * If the adminId is not valid, it returns an empty vector.
- * Otherwise, it fetches and returns all flights from the FlightRepository.
+ * If the adminId is not valid, it returns an empty page.
+ * Otherwise, it returns the flights following the given cursor, in departure order,
+ * read without blocking concurrent bookings.
  * 
  * @param adminId The unique identifier of the admin requesting the flights.
- * @return std::vector<std::shared_ptr<FlightModel>> A vector containing shared pointers to all FlightModel objects,
- *         or an empty vector if the adminId is not confirmed.
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of flights in the page.
+ * @return FlightRepository::FlightPage The page, or an empty page if the adminId is not confirmed.
  */
-std::vector<std::shared_ptr<FlightModel>> AdminController::getAllFlights(const std::string& adminId) {
+FlightRepository::FlightPage AdminController::getFlightsPage(
+    const std::string& adminId,
+    const std::optional<FlightRepository::DepartureCursor>& after,
+    std::size_t limit
+) {
     if (!confirmAdmin(adminId)) {
         return {};
     }
-    return FlightService::getAllFlights();
+    return FlightService::getFlightsPage(after, limit);
 }
 /**
  * @brief Retrieves a flight by its ID if the requesting user is an admin.
@@ -266,7 +303,9 @@ std::optional<std::shared_ptr<FlightModel>> AdminController::getFlightById(const
     if (!confirmAdmin(adminId)) {
         return std::nullopt;
     }
-    return FlightService::getFlightById(flightId);
+    std::optional<std::shared_ptr<FlightModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::getFlightById(flightId); });
+    return result;
 }
 /**
  * @brief Assigns a list of crew members to a specific flight.
@@ -284,7 +323,9 @@ bool AdminController::assignCrewToFlight(const std::string& adminId, const std::
     if (!confirmAdmin(adminId)) {
         return false;
     }
-    return FlightService::addCrewToFlight(flightId, crewIds);
+    bool result = false;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::addCrewToFlight(flightId, crewIds); });
+    return result;
 }
 /**
  * @brief Assigns a crew to a specific flight if the admin is confirmed.
@@ -301,7 +342,9 @@ bool AdminController::assignCrewToFlight(const std::string& adminId, const std::
     if (!confirmAdmin(adminId)) {
         return false;
     }
-    return FlightService::addCrewToFlight(flightId, crewId);
+    bool result = false;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::addCrewToFlight(flightId, crewId); });
+    return result;
 }
 /**
  * @brief Removes a crew member from a specific flight.
@@ -324,7 +367,9 @@ bool AdminController::removeCrewMemberFromFlight(const std::string& adminId, con
     if (!confirmAdmin(adminId)) {
         return false;
     }
-    return FlightService::removeCrewMemberFromFlight(flightId, crewMemberId);
+    bool result = false;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::removeCrewMemberFromFlight(flightId, crewMemberId); });
+    return result;
 }
 /**
  * @brief Retrieves all crew members assigned to a specific flight
@@ -393,8 +438,8 @@ std::optional<std::shared_ptr<AircraftModel>> AdminController::addAircraft(
  * @brief Updates an existing aircraft's information in the system
  * 
  * This method allows an authenticated administrator to modify the details of an existing aircraft.
- * The method first verifies the admin's credentials, then retrieves the aircraft by ID,
- * updates its properties, and persists the changes through the AircraftService.
+ * The method first verifies the admin's credentials, then updates the aircraft's
+ * properties in place and persists the changes through the AircraftService.
  * 
  * @param adminId The unique identifier of the administrator performing the update
  * @param aircraftId The unique identifier of the aircraft to be updated
@@ -419,15 +464,7 @@ bool AdminController::updateAircraft(
     if (!confirmAdmin(adminId)) {
         return false;
     }
-    auto aircraftOpt = AircraftService::getAircraftById(aircraftId);
-    if (!aircraftOpt.has_value()) {
-        return false;
-    }
-    auto aircraft = aircraftOpt.value();
-    aircraft->setModel(model);
-    aircraft->setCapacity(capacity);
-    aircraft->setNumOfRowSeats(numOfRowSeats);
-    return AircraftService::updateAircraft(*aircraft);
+    return AircraftService::updateAircraft(aircraftId, model, capacity, numOfRowSeats);
 }
 /**
  * @brief Removes an aircraft from the repository if the admin is confirmed.
@@ -448,22 +485,21 @@ bool AdminController::removeAircraft(const std::string& adminId, const std::stri
 }
 
 /**
- * @brief Retrieves all aircraft models from the repository if the admin ID is confirmed.
+ * @brief Returns a view over all aircraft models if the admin ID is confirmed.
  * 
  * This function checks whether the provided admin ID is valid and authorized.
- * If the admin ID is confirmed, it returns a vector containing shared pointers
- * to all aircraft models available in the repository. If the admin ID is not
- * confirmed, it returns an empty vector.
+ * If the admin ID is confirmed, it returns a view over the aircraft models stored
+ * in the repository, which copies neither the models nor their shared pointers.
+ * If the admin ID is not confirmed, it returns an empty view.
  * 
  * @param adminId The ID of the administrator requesting the aircraft models.
- * @return std::vector<std::shared_ptr<AircraftModel>> A vector of shared pointers to AircraftModel objects,
- *         or an empty vector if the admin ID is not confirmed.
+ * @return RepositoryView<AircraftModel> A view over all aircraft, or an empty view if the admin ID is not confirmed.
  */
-std::vector<std::shared_ptr<AircraftModel>> AdminController::getAllAircrafts(const std::string& adminId) {
+RepositoryView<AircraftModel> AdminController::viewAircrafts(const std::string& adminId) {
     if (!confirmAdmin(adminId)) {
         return {};
     }
-    return AircraftService::getAllAircrafts();
+    return AircraftService::viewAircrafts();
 }
 /**
  * @brief Retrieves an aircraft by its ID if the requesting user is an admin.
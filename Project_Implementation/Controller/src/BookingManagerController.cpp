@@ -1,6 +1,8 @@
 #include "../include/BookingManagerController.hpp"
+#include "../../Services/include/ArchiveService.hpp"
 #include "../../Services/include/FlightService.hpp"
 #include "../../Services/include/ReservationService.hpp"
+#include "../../Services/include/OverbookingService.hpp"
 #include "../../Services/include/PaymentService.hpp"
 #include "../../Services/include/UserManagementService.hpp"
 /**
@@ -19,36 +21,39 @@ bool BookingManagerController::authenticateBookingManager(const std::string& boo
     return false;
 }
 /**
- * @brief Retrieves all passengers from the system for a booking manager.
+ * @brief Retrieves one page of reservations, sorted by reservation ID, for a booking manager.
  * 
- * This method allows an authenticated booking manager to access a list of all 
- * passengers in the system. The method first validates the booking manager's 
- * authentication before proceeding with the data retrieval.
+ * This method first validates the booking manager's authentication, then returns the
+ * reservations following the given cursor. Each page costs O(log n + page size).
  * 
  * @param bookingManagerId The unique identifier of the booking manager requesting 
- *                        the passenger list. Used for authentication purposes.
- * 
- * @return std::vector<std::shared_ptr<UserModel>> A vector containing shared 
- *         pointers to all passenger user models in the system. Returns an empty 
- *         vector if authentication fails or no passengers are found.
+ *                        the reservations. Used for authentication purposes.
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of reservations in the page.
  * 
- * @throws May throw exceptions from underlying authentication or user service calls.
+ * @return ReservationRepository::ReservationPage The page. Returns an empty page
+ *         if authentication fails.
  * 
  * @note Only authenticated booking managers can access this functionality.
  * @see authenticateBookingManager()
- * @see UserManagementService::getUsersByRole()
+ * @see ReservationService::getReservationsPage()
  */
-std::vector<std::shared_ptr<ReservationModel>> BookingManagerController::getAllReservations(const std::string& bookingManagerId) {
+ReservationRepository::ReservationPage BookingManagerController::getReservationsPage(
+    const std::string& bookingManagerId,
+    const std::optional<ReservationRepository::ReservationCursor>& after,
+    std::size_t limit
+) {
     if (!authenticateBookingManager(bookingManagerId)) {
         return {};
     }
-    return ReservationService::getAllReservations();
+    return ReservationService::getReservationsPage(after, limit);
 }
 /**
  * @brief Retrieves the details of a reservation for a given booking manager.
  *
  * This function authenticates the booking manager using the provided bookingManagerId.
- * If authentication is successful, it fetches the reservation details corresponding to the reservationId.
+ * If authentication is successful, it fetches the reservation details corresponding to the reservationId,
+ * from the archive if the reservation's flight has departed; archived reservations cannot be changed.
  * If authentication fails, it returns std::nullopt.
  *
  * @param bookingManagerId The unique identifier of the booking manager.
@@ -60,7 +65,11 @@ std::optional<std::shared_ptr<ReservationModel>> BookingManagerController::getRe
     if (!authenticateBookingManager(bookingManagerId)) {
         return std::nullopt;
     }
-    return ReservationService::getReservationById(reservationId);
+    auto reservation = ReservationService::getReservationById(reservationId);
+    if (reservation.has_value()) {
+        return reservation;
+    }
+    return ArchiveService::getArchivedReservation(reservationId);
 } 
 /**
  * @brief Creates a new reservation for a passenger on a specified flight.
@@ -90,13 +99,17 @@ std::optional<std::shared_ptr<ReservationModel>> BookingManagerController::creat
     if (!authenticateBookingManager(bookingManagerId)) {
         return std::nullopt;
     }
-    return ReservationService::addReservation (
-        flightId,
-        seatNumber,
-        passengerId,
-        paymentType,
-        paymentDetails
-    );
+    std::optional<std::shared_ptr<ReservationModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] {
+        result = ReservationService::addReservation (
+            flightId,
+            seatNumber,
+            passengerId,
+            paymentType,
+            paymentDetails
+        );
+    });
+    return result;
 }
 /**
  * @brief Updates an existing reservation if the booking manager is authenticated.
@@ -105,6 +118,11 @@ std::optional<std::shared_ptr<ReservationModel>> BookingManagerController::creat
  * bookingManagerId. If authentication succeeds, it delegates the update operation
  * to the ReservationService. Returns true if the update is successful, false otherwise.
  *
+ * A change on the same flight runs as one task on the flight's shard. A change of flight
+ * is not run inside any shard task: ReservationService books the new seat, moves the
+ * reservation and releases the old seat in separate tasks on each flight's own shard, so
+ * a failed update leaves the passenger holding the old seat.
+ *
  * @param bookingManagerId The unique identifier of the booking manager attempting the update.
  * @param reservation The ReservationModel object containing updated reservation details.
  * @return true if the reservation was successfully updated; false if authentication fails or the update is unsuccessful.
@@ -113,7 +131,16 @@ bool BookingManagerController::updateReservation(const std::string& bookingManag
     if (!authenticateBookingManager(bookingManagerId)) {
         return false;
     }
-    return ReservationService::updateReservation(reservation);
+    auto previousOpt = ReservationService::getReservationById(reservation.getReservationId());
+    if (!previousOpt.has_value() || previousOpt.value() -> getVersion() != reservation.getVersion()) {
+        return false;
+    }
+    if (previousOpt.value() -> getFlightId() != reservation.getFlightId()) {
+        return ReservationService::updateReservation(reservation);
+    }
+    bool result = false;
+    FlightService::runOnFlightShard(reservation.getFlightId(), [&] { result = ReservationService::updateReservation(reservation); });
+    return result;
 }
 /**
  * @brief Cancels a reservation for a booking manager.
@@ -130,7 +157,97 @@ bool BookingManagerController::cancelReservation(const std::string& bookingManag
     if (!authenticateBookingManager(bookingManagerId)) {
         return false;
     }
-    return ReservationService::deleteReservation(reservationId);
+    auto reservation = ReservationService::getReservationById(reservationId);
+    if (!reservation.has_value()) {
+        return false;
+    }
+    bool result = false;
+    FlightService::runOnFlightShard(reservation.value() -> getFlightId(), [&] { result = ReservationService::deleteReservation(reservationId); });
+    return result;
+}
+/**
+ * @brief Checks whether a fully booked flight may still sell a reservation without a seat.
+ *
+ * @param bookingManagerId The unique identifier of the booking manager.
+ * @param flightId The unique identifier of the flight.
+ * @return true if the flight is fully booked but below its authorized capacity; false otherwise,
+ *         or if authentication fails or the flight does not exist.
+ */
+bool BookingManagerController::canSellWithoutSeat(const std::string& bookingManagerId, const std::string& flightId) {
+    if (!authenticateBookingManager(bookingManagerId)) {
+        return false;
+    }
+    auto flight = FlightService::getFlightById(flightId);
+    if (!flight.has_value()) {
+        return false;
+    }
+    bool result = false;
+    FlightService::runOnFlightShard(flightId, [&] { result = OverbookingService::canSellWithoutSeat(*flight.value()); });
+    return result;
+}
+/**
+ * @brief Records whether the passenger of a reservation boarded or did not show up.
+ *
+ * @param bookingManagerId The unique identifier of the booking manager.
+ * @param reservationId The unique identifier of the reservation.
+ * @param boarded true if the passenger boarded, false for a no-show.
+ * @return true if the outcome was recorded; false if authentication fails or the reservation
+ *         is not a confirmed one (or has no seat, for boarding).
+ */
+bool BookingManagerController::recordBoardingOutcome(const std::string& bookingManagerId, const std::string& reservationId, bool boarded) {
+    if (!authenticateBookingManager(bookingManagerId)) {
+        return false;
+    }
+    auto reservation = ReservationService::getReservationById(reservationId);
+    if (!reservation.has_value()) {
+        return false;
+    }
+    bool result = false;
+    FlightService::runOnFlightShard(reservation.value() -> getFlightId(), [&] { result = ReservationService::recordBoardingOutcome(reservationId, boarded); });
+    return result;
+}
+/**
+ * @brief Puts a passenger on the waitlist of a fully booked flight.
+ *
+ * The entry is created on the thread owning the flight's shard, like reservations, so it
+ * cannot interleave with a cancellation promoting the waitlist of the same flight.
+ *
+ * @param bookingManagerId The unique identifier of the booking manager.
+ * @param passengerId The unique identifier of the waiting passenger.
+ * @param flightId The unique identifier of the flight.
+ * @param paymentType The payment method charged when a seat is assigned.
+ * @param paymentDetails A JSON object containing payment-specific details.
+ * @return std::optional<std::shared_ptr<WaitlistEntryModel>> The waitlist entry, or empty if authentication fails,
+ *         the flight still has free seats, or the passenger or flight does not exist.
+ */
+std::optional<std::shared_ptr<WaitlistEntryModel>> BookingManagerController::joinWaitlist(
+    const std::string& bookingManagerId,
+    const std::string& passengerId,
+    const std::string& flightId,
+    const std::string& paymentType,
+    const JSON& paymentDetails
+) {
+    if (!authenticateBookingManager(bookingManagerId)) {
+        return std::nullopt;
+    }
+    std::optional<std::shared_ptr<WaitlistEntryModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] {
+        result = ReservationService::joinWaitlist(flightId, passengerId, paymentType, paymentDetails);
+    });
+    return result;
+}
+/**
+ * @brief Retrieves the number of passengers waiting for a flight.
+ *
+ * @param bookingManagerId The unique identifier of the booking manager.
+ * @param flightId The unique identifier of the flight.
+ * @return std::size_t The length of the flight's waitlist, or 0 if authentication fails.
+ */
+std::size_t BookingManagerController::getWaitlistLength(const std::string& bookingManagerId, const std::string& flightId) {
+    if (!authenticateBookingManager(bookingManagerId)) {
+        return 0;
+    }
+    return ReservationService::getWaitlistLength(flightId);
 }
 /**
  * @brief Processes a payment for a booking manager.
@@ -167,21 +284,20 @@ std::string BookingManagerController::refundPayment(const std::string& bookingMa
     return PaymentService::refundPayment(paymentId);
 }
 /**
- * @brief Retrieves all flights for a booking manager.
+ * @brief Takes a snapshot of all flights for a booking manager.
  *
- * This method authenticates the booking manager using the provided bookingManagerId.
- * If authentication is successful, it retrieves and returns a list of all available flights.
- * If authentication fails, it returns an empty vector.
+ * This function authenticates the booking manager using the provided bookingManagerId.
+ * If authentication is successful, it returns a point-in-time snapshot of all flights,
+ * which is iterated without copying the flights. If authentication fails, it returns std::nullopt.
  *
  * @param bookingManagerId The unique identifier of the booking manager requesting the flight list.
- * @return std::vector<std::shared_ptr<FlightModel>> A vector containing shared pointers to FlightModel objects if authenticated; 
- *         an empty vector otherwise.
+ * @return std::optional<FlightRepository::Snapshot> The snapshot if authenticated; std::nullopt otherwise.
  */
-std::vector<std::shared_ptr<FlightModel>> BookingManagerController::getAllFlights(const std::string& bookingManagerId) {
+std::optional<FlightRepository::Snapshot> BookingManagerController::getFlightsSnapshot(const std::string& bookingManagerId) {
     if (!authenticateBookingManager(bookingManagerId)) {
-        return {};
+        return std::nullopt;
     }
-    return FlightService::getAllFlights();
+    return FlightService::getFlightsSnapshot();
 }
 /**
  * @brief Retrieves flights matching the specified route and departure date for an authenticated booking manager.
@@ -212,30 +328,27 @@ std::vector<std::shared_ptr<FlightModel>> BookingManagerController::getFlightsBy
     return FlightService::getFlightsByRouteAndDate(origin, destination, departureDate);
 }
 /**
- * @brief Retrieves all passengers from the system for a booking manager.
+ * @brief Returns a view over all users, for a booking manager listing the passengers.
  * 
- * This method allows an authenticated booking manager to access a list of all 
- * passengers in the system. The method first validates the booking manager's 
- * authentication before proceeding with the data retrieval.
+ * This method allows an authenticated booking manager to iterate the users in the
+ * system without copying them; callers pick out the passengers by role. The method
+ * first validates the booking manager's authentication.
  * 
  * @param bookingManagerId The unique identifier of the booking manager requesting 
  *                        the passenger list. Used for authentication purposes.
  * 
- * @return std::vector<std::shared_ptr<UserModel>> A vector containing shared 
- *         pointers to all passenger user models in the system. Returns an empty 
- *         vector if authentication fails or no passengers are found.
- * 
- * @throws May throw exceptions from underlying authentication or user service calls.
+ * @return RepositoryView<UserModel> A view over all users. Returns an empty view
+ *         if authentication fails.
  * 
  * @note Only authenticated booking managers can access this functionality.
  * @see authenticateBookingManager()
- * @see UserManagementService::getUsersByRole()
+ * @see UserManagementService::viewUsers()
  */
-std::vector<std::shared_ptr<UserModel>> BookingManagerController::getAllPassengers(const std::string& bookingManagerId) {
+RepositoryView<UserModel> BookingManagerController::viewUsers(const std::string& bookingManagerId) {
     if (!authenticateBookingManager(bookingManagerId)) {
         return {};
     }
-    return UserManagementService::getUsersByRole(UserModel::UserType::Passenger);
+    return UserManagementService::viewUsers();
 }
 
 /**
@@ -286,5 +399,7 @@ std::optional<std::shared_ptr<FlightModel>> BookingManagerController::getFlightD
     if (!authenticateBookingManager(bookingManagerId)) {
         return std::nullopt;
     }
-    return FlightService::getFlightById(flightId);
+    std::optional<std::shared_ptr<FlightModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::getFlightById(flightId); });
+    return result;
 }
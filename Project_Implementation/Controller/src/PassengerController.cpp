@@ -1,4 +1,6 @@
 #include "../include/PassengerController.hpp"
+#include "../../Services/include/AirportService.hpp"
+#include "../../Services/include/ArchiveService.hpp"
 #include "../../Services/include/FlightService.hpp"
 #include "../../Services/include/ReservationService.hpp"
 #include "../../Services/include/UserManagementService.hpp"
@@ -52,6 +54,7 @@ std::vector<std::shared_ptr<FlightModel>> PassengerController::getAllFlights(con
  * @param origin The departure airport/location code
  * @param destination The arrival airport/location code  
  * @param departureDate The desired departure date for the flight search
+ * @param filter The seats the flights must have free, so that sold-out flights are left out
  * 
  * @return std::vector<std::shared_ptr<FlightModel>> A vector of shared pointers to FlightModel objects
  *         representing flights that match the search criteria. Returns an empty vector if passenger
@@ -64,12 +67,63 @@ std::vector<std::shared_ptr<FlightModel>> PassengerController::getFlightsByRoute
     const std::string& passengerId,
     const std::string& origin,
     const std::string& destination,
-    const DateTime& departureDate
+    const DateTime& departureDate,
+    const AvailabilityFilter& filter
 ) {
     if (!authenticatePassenger(passengerId)) {
         return {};
     }
-    return FlightService::getFlightsByRouteAndDate(origin, destination, departureDate);
+    return FlightService::getFlightsByRouteAndDate(origin, destination, departureDate, filter);
+}
+
+/**
+ * @brief Retrieves the free seats and lowest fare of a route around a date for an authenticated passenger.
+ * 
+ * @param passengerId The unique identifier of the passenger requesting the calendar
+ * @param origin The departure airport/location code
+ * @param destination The arrival airport/location code
+ * @param departureDate The preferred departure date
+ * @param daysAround The number of days before and after the preferred date to include
+ * 
+ * @return std::vector<FareCalendarDay> One entry per day of the window, or an empty vector
+ *         if passenger authentication fails.
+ * 
+ * @see FlightService::getFareCalendar()
+ */
+std::vector<FareCalendarDay> PassengerController::getFareCalendar(
+    const std::string& passengerId,
+    const std::string& origin,
+    const std::string& destination,
+    const DateTime& departureDate,
+    std::size_t daysAround
+) {
+    if (!authenticatePassenger(passengerId)) {
+        return {};
+    }
+    return FlightService::getFareCalendar(origin, destination, departureDate, daysAround);
+}
+
+/**
+ * @brief Suggests the airports a partially typed origin or destination may refer to.
+ * 
+ * @param passengerId The unique identifier of the passenger searching for flights
+ * @param query The origin or destination typed so far
+ * @param limit The maximum number of airports suggested
+ * 
+ * @return std::vector<std::shared_ptr<const AirportModel>> The suggested airports, or an empty
+ *         vector if passenger authentication fails or no airport resembles the query.
+ * 
+ * @see AirportService::suggestAirports()
+ */
+std::vector<std::shared_ptr<const AirportModel>> PassengerController::suggestAirports(
+    const std::string& passengerId,
+    const std::string& query,
+    std::size_t limit
+) {
+    if (!authenticatePassenger(passengerId)) {
+        return {};
+    }
+    return AirportService::suggestAirports(query, limit);
 }
 
 /**
@@ -102,19 +156,24 @@ std::optional<std::shared_ptr<ReservationModel>> PassengerController::bookFlight
     if (!authenticatePassenger(passengerId)) {
         return std::nullopt;
     }
-    return ReservationService::addReservation (
-        passengerId,
-        flightId,
-        seatNumber,
-        paymentType,
-        paymentDetails
-    );
+    std::optional<std::shared_ptr<ReservationModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] {
+        result = ReservationService::addReservation (
+            passengerId,
+            flightId,
+            seatNumber,
+            paymentType,
+            paymentDetails
+        );
+    });
+    return result;
 }
 /**
  * @brief Retrieves all reservations associated with a specific passenger.
  * 
  * This method first authenticates the passenger using their ID, and if authentication
- * is successful, fetches and returns all reservations made by that passenger.
+ * is successful, fetches and returns all reservations made by that passenger: those of
+ * active flights first, then those of departed flights read back from the archive.
  * 
  * @param passengerId The unique identifier of the passenger whose reservations are to be retrieved
  * @return std::vector<std::shared_ptr<ReservationModel>> A vector containing shared pointers to 
@@ -124,12 +183,16 @@ std::optional<std::shared_ptr<ReservationModel>> PassengerController::bookFlight
  * @note This method requires valid passenger authentication before retrieving reservations
  * @see authenticatePassenger()
  * @see ReservationService::getReservationByUserId()
+ * @see ArchiveService::getArchivedReservationsByPassenger()
  */
 std::vector<std::shared_ptr<ReservationModel>> PassengerController::getPassengerReservations(const std::string& passengerId) {
     if (!authenticatePassenger(passengerId)) {
         return {};
     }
-    return ReservationService::getReservationByUserId(passengerId);
+    auto reservations = ReservationService::getReservationByUserId(passengerId);
+    auto archived = ArchiveService::getArchivedReservationsByPassenger(passengerId);
+    reservations.insert(reservations.end(), archived.begin(), archived.end());
+    return reservations;
 }
 /**
  * @brief Retrieves flight details for an authenticated passenger
@@ -155,7 +218,9 @@ std::optional<std::shared_ptr<FlightModel>> PassengerController::getFlightDetail
     if (!authenticatePassenger(passengerId)) {
         return std::nullopt;
     }
-    return FlightService::getFlightById(flightId);
+    std::optional<std::shared_ptr<FlightModel>> result;
+    FlightService::runOnFlightShard(flightId, [&] { result = FlightService::getFlightById(flightId); });
+    return result;
 }
 /**
  * @brief Processes a payment for a passenger after authentication.
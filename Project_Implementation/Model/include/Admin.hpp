@@ -13,6 +13,8 @@
  */
 class Admin : public UserModel {
     public:
+        static constexpr UserType ROLE = UserType::Admin;
+
         Admin();
         Admin(const std::string& username, const std::string& password);
         Admin(const JSON& json);
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
+
+/**
+ * @class AirportModel
+ * @brief Represents an airport of the airport master table.
+ *
+ * Airports are identified by their three-letter IATA code, which is also what flights
+ * store as their origin and destination. Airports are read-only reference data: they
+ * are only ever constructed from the airport table.
+ *
+ * @constructor AirportModel(const JSON& json) Constructs an AirportModel from a JSON object.
+ *
+ * @method std::string getCode() const Returns the IATA code of the airport, e.g. "CAI".
+ * @method std::string getCity() const Returns the city the airport serves.
+ * @method std::string getName() const Returns the name of the airport.
+ * @method void to_json(JSON& json) const Serializes the AirportModel to a JSON object.
+ */
+class AirportModel {
+    std::string code;
+    std::string city;
+    std::string name;
+
+    public:
+        AirportModel(const JSON& json);
+
+        inline const std::string& getCode() const           { return code; }
+        inline const std::string& getCity() const           { return city; }
+        inline const std::string& getName() const           { return name; }
+
+        void to_json(JSON& json) const;
+
+        ~AirportModel() = default;
+};
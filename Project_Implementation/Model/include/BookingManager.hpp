@@ -11,6 +11,8 @@
  */
 class BookingManager : public UserModel {
     public:
+        static constexpr UserType ROLE = UserType::BookingManager;
+
         BookingManager();
         BookingManager(const std::string& username, const std::string& password);
         BookingManager(const JSON& json);
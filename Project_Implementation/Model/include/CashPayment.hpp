@@ -1,19 +1,22 @@
 #pragma once
-#include "PaymentStrategy.hpp"
+#include <string>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
 
 /**
  * @class CashPayment
- * @brief Implements the PaymentStrategy interface for cash payments.
+ * @brief Payment strategy for cash payments, one of the alternatives of PaymentStrategy.
  *
  * This class provides concrete implementations for processing and refunding payments made with cash.
  * It also provides methods to retrieve the payment type and details in JSON format.
  */
-class CashPayment : public PaymentStrategy {
+class CashPayment {
     public:
-        std::string processPayment(double amount) override;
-        std::string refundPayment(double amount) override;
-        std::string getType() const override;
-        JSON getDetails() const override;
+        std::string processPayment(double amount);
+        std::string refundPayment(double amount);
+        std::string getType() const;
+        JSON getDetails() const;
 
         ~CashPayment() = default;
 };
\ No newline at end of file
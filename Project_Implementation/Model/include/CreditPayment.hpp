@@ -1,9 +1,12 @@
 #pragma once
-#include "PaymentStrategy.hpp"
+#include <string>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
 
 /**
  * @class CreditPayment
- * @brief Implements the PaymentStrategy interface for credit card payments.
+ * @brief Payment strategy for credit card payments, one of the alternatives of PaymentStrategy.
  *
  * This class handles payment processing, refunds, and provides details for credit card transactions.
  * It stores credit card information such as card number, expiration date, and CVV.
@@ -13,25 +16,25 @@
  * @constructor CreditPayment() - Default constructor.
  * @constructor CreditPayment(std::string number, std::string expiry, std::string cvv_code) - Initializes with card details.
  *
- * @fn std::string processPayment(double amount) override
+ * @fn std::string processPayment(double amount)
  *      Processes a payment of the specified amount using credit card details.
  *      @param amount The amount to be paid.
  *      @return A string indicating the result of the payment process.
  *
- * @fn std::string refundPayment(double amount) override
+ * @fn std::string refundPayment(double amount)
  *      Processes a refund of the specified amount to the credit card.
  *      @param amount The amount to be refunded.
  *      @return A string indicating the result of the refund process.
  *
- * @fn std::string getType() const override
+ * @fn std::string getType() const
  *      Returns the type of payment strategy ("Credit").
  *      @return A string representing the payment type.
  *
- * @fn JSON getDetails() const override
+ * @fn JSON getDetails() const
  *      Retrieves the credit card details in JSON format.
  *      @return A JSON object containing card information.
  */
-class CreditPayment : public PaymentStrategy {
+class CreditPayment {
     std::string creditCardNumber;
     std::string expirationDate;
     std::string cvv;
@@ -40,10 +43,10 @@ class CreditPayment : public PaymentStrategy {
     public:
         CreditPayment() = default;
         CreditPayment(std::string number, std::string expiry, std::string cvv_code);
-        std::string processPayment(double amount) override;
-        std::string refundPayment(double amount) override;
-        std::string getType() const override;
-        JSON getDetails() const override;
+        std::string processPayment(double amount);
+        std::string refundPayment(double amount);
+        std::string getType() const;
+        JSON getDetails() const;
 
         ~CreditPayment() = default;
 };
\ No newline at end of file
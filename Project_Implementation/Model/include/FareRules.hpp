@@ -0,0 +1,114 @@
+#pragma once
+#include <array>
+#include <cstddef>
+
+/**
+ * @class FareRules
+ * @brief Base fares of the seats of a flight, before any loyalty discount.
+ *
+ * The fare of a seat is the fare of its cabin plus the premium of its column:
+ * - First class: rows 1-5 ($200)
+ * - Business class: rows 6-15 ($150)
+ * - Economy class: rows 16+ ($100)
+ * - Window seats (first and last column) add $20
+ * - Aisle seats (the two columns beside the aisle, which splits rows of four seats or
+ *   more in the middle) add $10
+ *
+ * For the usual six-seat rows these are columns 'A'/'F' and 'C'/'D'. Common row widths
+ * are priced from FareTable lookup arrays built at compile time; other widths compute the
+ * same rules at run time. Reservations sold without a seat are charged the economy fare.
+ *
+ * @enum Cabin The cabins of a flight, from first class to economy; CABIN_COUNT is their number.
+ *
+ * @method static Cabin getCabin(std::size_t row) Returns the cabin of a seat by its zero-based row.
+ * @method static float getCabinFare(Cabin cabin) Returns the fare of a cabin.
+ * @method static float getColumnPremium(std::size_t column, std::size_t seatsPerRow) Returns the premium of a column.
+ * @method static float getBaseFare(std::size_t row, std::size_t column, std::size_t seatsPerRow) Returns the fare of a seat by its zero-based row and column.
+ * @method static float getSeatlessFare() Returns the fare of a reservation sold without a seat.
+ */
+class FareRules {
+    public:
+        enum class Cabin { First, Business, Economy };
+        static constexpr std::size_t CABIN_COUNT = 3;
+        static constexpr std::size_t FIRST_CLASS_ROWS = 5;
+        static constexpr std::size_t BUSINESS_CLASS_ROWS = 10;
+
+        FareRules() = delete;
+
+        static constexpr Cabin getCabin(std::size_t row) {
+            if (row < FIRST_CLASS_ROWS) {
+                return Cabin::First;
+            }
+            return (row < FIRST_CLASS_ROWS + BUSINESS_CLASS_ROWS) ? Cabin::Business : Cabin::Economy;
+        }
+
+        static constexpr float getCabinFare(Cabin cabin) {
+            switch (cabin) {
+                case Cabin::First:      return 200.0f;
+                case Cabin::Business:   return 150.0f;
+                default:                return 100.0f;
+            }
+        }
+
+        static constexpr float getColumnPremium(std::size_t column, std::size_t seatsPerRow) {
+            if (column == 0 || column + 1 == seatsPerRow) {
+                return 20.0f;
+            }
+            if (seatsPerRow >= 4 && (column + 1 == seatsPerRow / 2 || column == seatsPerRow / 2)) {
+                return 10.0f;
+            }
+            return 0.0f;
+        }
+
+        static float getBaseFare(std::size_t row, std::size_t column, std::size_t seatsPerRow);
+        static float getSeatlessFare();
+};
+
+/**
+ * @class FareTable
+ * @brief Fare lookup arrays of one seat layout, built at compile time.
+ *
+ * The fares of the cabins and the premiums of the columns are stored in arrays computed
+ * from FareRules when the template is instantiated, so pricing a seat is two array reads
+ * and an addition. The cabin index is the number of cabin boundaries at or before the
+ * row, summed from comparisons rather than chosen by branches.
+ *
+ * @tparam SeatsPerRow The number of seats in each row.
+ * @tparam FirstClassRows The number of first class rows.
+ * @tparam BusinessClassRows The number of business class rows following them.
+ */
+template <std::size_t SeatsPerRow, std::size_t FirstClassRows, std::size_t BusinessClassRows>
+class FareTable {
+    static_assert(SeatsPerRow > 0, "A row must have at least one seat.");
+
+    static constexpr std::array<float, FareRules::CABIN_COUNT> makeCabinFares() {
+        std::array<float, FareRules::CABIN_COUNT> fares{};
+        for (std::size_t cabin = 0; cabin < FareRules::CABIN_COUNT; cabin++) {
+            fares[cabin] = FareRules::getCabinFare(static_cast<FareRules::Cabin>(cabin));
+        }
+        return fares;
+    }
+
+    static constexpr std::array<float, SeatsPerRow> makeColumnPremiums() {
+        std::array<float, SeatsPerRow> premiums{};
+        for (std::size_t column = 0; column < SeatsPerRow; column++) {
+            premiums[column] = FareRules::getColumnPremium(column, SeatsPerRow);
+        }
+        return premiums;
+    }
+
+    static constexpr std::array<float, FareRules::CABIN_COUNT> CABIN_FARES = makeCabinFares();
+    static constexpr std::array<float, SeatsPerRow> COLUMN_PREMIUMS = makeColumnPremiums();
+
+    public:
+        FareTable() = delete;
+
+        /**
+         * @brief Returns the fare of a seat by its zero-based row and column; column must be below SeatsPerRow.
+         */
+        static constexpr float getFare(std::size_t row, std::size_t column) {
+            const std::size_t cabin = static_cast<std::size_t>(row >= FirstClassRows)
+                + static_cast<std::size_t>(row >= FirstClassRows + BusinessClassRows);
+            return CABIN_FARES[cabin] + COLUMN_PREMIUMS[column];
+        }
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "../../Third_Party/json.hpp"
@@ -17,6 +18,10 @@ using JSON = nlohmann::json;
  *
  * @note Seat map is represented as a 2D vector of booleans, where each element indicates
  *       whether a seat is occupied (true) or available (false).
+ * @note The version counter is incremented by the FlightRepository on every committed change
+ *       and is used to reject updates based on a stale copy of the flight.
+ * @note fromArchive() reads an archived flight without checking that its aircraft and crew
+ *       members still exist.
  *
  */
 class FlightModel {
@@ -28,16 +33,19 @@ class FlightModel {
     std::string aircraftId;
     std::vector<std::string> crewMemberIds;
     std::vector<std::vector<bool>> seatMap;
+    std::uint64_t version = 0;
 
     private:
         std::pair<int, int> getSeatIndices(const std::string& seatNumber) const;
+        void readFields(const JSON& json);
 
     public:
         FlightModel() = default;
-        FlightModel(const std::string& origin, const std::string& destination,
-                     const DateTime& departureTime, const DateTime& arrivalTime, const std::string& aircraftId,
-                     const std::vector<std::string>& crewMemberIds = {});
+        FlightModel(std::string origin, std::string destination,
+                     const DateTime& departureTime, const DateTime& arrivalTime, std::string aircraftId,
+                     std::vector<std::string> crewMemberIds = {});
         FlightModel(const JSON& json);
+        static FlightModel fromArchive(const JSON& json);
 
         inline void setFlightId(const std::string& id)                      { flightId = id; }
         inline void setOrigin(const std::string& origin)                    { this->origin = origin;}
@@ -47,6 +55,7 @@ class FlightModel {
         inline void setAircraftId(const std::string& id)                    { this->aircraftId = id; }
         inline void setCrewMemberIds(const std::vector<std::string>& ids)   { this->crewMemberIds = ids; }
         inline void addCrewMemberId(const std::string& id)                  { crewMemberIds.push_back(id); }
+        inline void setVersion(std::uint64_t version)                       { this->version = version; }
         bool removeCrewMemberId(const std::string& id);
         void setSeatStatus(const std::string& seatNumber, bool status);
         bool isValidSeat(const std::string& seatNumber) const;
@@ -58,7 +67,9 @@ class FlightModel {
         inline const std::string& getAircraftId() const                     { return aircraftId; }
         inline const std::vector<std::string>& getCrewMemberIds() const     { return crewMemberIds; }
         inline const std::vector<std::vector<bool>>& getSeatMap() const     { return seatMap; }
+        inline std::uint64_t getVersion() const                             { return version; }
         bool getSeatStatus(const std::string& seatNumber) const;
+        bool isFullyBooked() const;
         
         void to_json(JSON& json) const;
 
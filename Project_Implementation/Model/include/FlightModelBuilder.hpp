@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include "FlightModel.hpp"
 
 /**
@@ -21,6 +22,11 @@
  *                  .addCrewMemberId("CM-002")
  *                  .build();
  * @endcode
+ *
+ * Setters take their arguments by value and move them into the builder. Called on a
+ * temporary, they return the builder as an rvalue, so the build() ending a chain like the
+ * one above (or std::move(builder).build()) moves the collected values on into the
+ * FlightModel, and no string or crew list is copied on the way.
  */
 class FlightModelBuilder {
     std::string origin = "";
@@ -31,15 +37,23 @@ class FlightModelBuilder {
     std::vector<std::string> crewMemberIds = {};
 
     public:
-        FlightModelBuilder& setOrigin(const std::string& origin);
-        FlightModelBuilder& setDestination(const std::string& destination);
-        FlightModelBuilder& setDepartureTime(const DateTime& time);
-        FlightModelBuilder& setArrivalTime(const DateTime& time);
-        FlightModelBuilder& setAircraftId(const std::string& id);
-        FlightModelBuilder& setCrewMemberIds(const std::vector<std::string>& ids);
-        FlightModelBuilder& addCrewMemberId(const std::string& id);
+        FlightModelBuilder& setOrigin(std::string origin) &;
+        FlightModelBuilder&& setOrigin(std::string origin) &&;
+        FlightModelBuilder& setDestination(std::string destination) &;
+        FlightModelBuilder&& setDestination(std::string destination) &&;
+        FlightModelBuilder& setDepartureTime(const DateTime& time) &;
+        FlightModelBuilder&& setDepartureTime(const DateTime& time) &&;
+        FlightModelBuilder& setArrivalTime(const DateTime& time) &;
+        FlightModelBuilder&& setArrivalTime(const DateTime& time) &&;
+        FlightModelBuilder& setAircraftId(std::string id) &;
+        FlightModelBuilder&& setAircraftId(std::string id) &&;
+        FlightModelBuilder& setCrewMemberIds(std::vector<std::string> ids) &;
+        FlightModelBuilder&& setCrewMemberIds(std::vector<std::string> ids) &&;
+        FlightModelBuilder& addCrewMemberId(std::string id) &;
+        FlightModelBuilder&& addCrewMemberId(std::string id) &&;
 
-        std::shared_ptr<FlightModel> build() const;
+        std::shared_ptr<FlightModel> build() const &;
+        std::shared_ptr<FlightModel> build() &&;
 
         ~FlightModelBuilder() = default;
 };
\ No newline at end of file
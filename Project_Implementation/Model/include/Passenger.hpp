@@ -16,6 +16,8 @@ class Passenger : public UserModel {
     float loyaltyPoints;
 
     public:
+        static constexpr UserType ROLE = UserType::Passenger;
+
         Passenger();
         Passenger(const std::string& username, const std::string& password, float loyaltyPoints = 0.0f);
         Passenger(const JSON& json);
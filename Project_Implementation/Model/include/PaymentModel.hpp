@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <memory>
+#include <utility>
 #include "PaymentStrategy.hpp"
 #include "../../Third_Party/json.hpp"
 #include "../../Utils/include/DateTime.hpp"
@@ -26,7 +26,7 @@ using JSON = nlohmann::json;
  * @var amount
  *      Amount of the payment.
  * @var paymentStrategy
- *      Strategy used to process the payment.
+ *      Strategy used to process the payment, held by value.
  * @var paymentDate
  *      Date and time when the payment was made.
  * @var status
@@ -37,10 +37,12 @@ using JSON = nlohmann::json;
  *
  * @constructor PaymentModel()
  *      Default constructor.
- * @constructor PaymentModel(const std::string&, double, const std::shared_ptr<PaymentStrategy>&, const PaymentStatus&, const DateTime&)
+ * @constructor PaymentModel(const std::string&, double, PaymentStrategy, const PaymentStatus&, const DateTime&)
  *      Constructs a PaymentModel with specified passenger ID, amount, payment strategy, status, and date.
  * @constructor PaymentModel(const JSON&)
- *      Constructs a PaymentModel from a JSON object.
+ *      Constructs a PaymentModel from a JSON object, checking that its passenger exists.
+ * @method fromArchive
+ *      Reads an archived payment from a JSON object without checking its passenger.
  *
  * @method getPaymentId
  *      Returns the payment's unique identifier.
@@ -50,8 +52,12 @@ using JSON = nlohmann::json;
  *      Returns the payment amount.
  * @method getPaymentStrategy
  *      Returns the payment strategy.
+ * @method getPaymentMethod
+ *      Returns the payment method, i.e. which strategy the payment holds.
  * @method getPaymentDate
  *      Returns the payment date.
+ * @method getStatus
+ *      Returns the payment status.
  *
  * @method setPaymentId
  *      Sets the payment's unique identifier.
@@ -86,25 +92,30 @@ class PaymentModel {
         std::string paymentId;
         std::string passengerId;
         double amount;
-        std::shared_ptr<PaymentStrategy> paymentStrategy;
+        PaymentStrategy paymentStrategy;
         DateTime paymentDate;
         PaymentStatus status;
+
+        void readFields(const JSON& json);
     public:
         PaymentModel() = default;
         PaymentModel(const std::string& passengerId, double amount, 
-            const std::shared_ptr<PaymentStrategy>& strategy, const PaymentStatus& status = PaymentStatus::PENDING, const DateTime& paymentDate = DateTime::now());
+            PaymentStrategy strategy, const PaymentStatus& status = PaymentStatus::PENDING, const DateTime& paymentDate = DateTime::now());
         PaymentModel(const JSON& json);
+        static PaymentModel fromArchive(const JSON& json);
 
         std::string getPaymentId() const                                            { return paymentId; }
         std::string getPassengerId() const                                          { return passengerId; }
         double getAmount() const                                                    { return amount; }
-        std::shared_ptr<PaymentStrategy> getPaymentStrategy() const                 { return paymentStrategy; }
+        const PaymentStrategy& getPaymentStrategy() const                           { return paymentStrategy; }
+        PaymentMethod getPaymentMethod() const                                      { return static_cast<PaymentMethod>(paymentStrategy.index()); }
         DateTime getPaymentDate() const                                             { return paymentDate; }
+        PaymentStatus getStatus() const                                             { return status; }
 
         void setPaymentId(const std::string& id)                                    { paymentId = id; }
         void setPassengerId(const std::string& id)                                  { passengerId = id; }
         void setAmount(double amt)                                                  { amount = amt; }
-        void setPaymentStrategy(const std::shared_ptr<PaymentStrategy>& strategy)   { paymentStrategy = strategy; }
+        void setPaymentStrategy(PaymentStrategy strategy)                           { paymentStrategy = std::move(strategy); }
         void setPaymentDate(const DateTime& date)                                   { paymentDate = date; }
 
         std::string processPayment();
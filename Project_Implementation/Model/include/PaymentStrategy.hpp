@@ -1,21 +1,31 @@
 #pragma once
 
-#include <string>
-#include "../../Third_Party/json.hpp"
-using JSON = nlohmann::json;
+#include <cstddef>
+#include <type_traits>
+#include <variant>
+#include "CreditPayment.hpp"
+#include "PaypalPayment.hpp"
+#include "CashPayment.hpp"
 
 /**
- * @brief Abstract base class for payment strategies.
+ * @brief The payment methods, in the order of the PaymentStrategy alternatives.
+ */
+enum class PaymentMethod {
+    Credit,
+    Paypal,
+    Cash
+};
+
+/**
+ * @brief A payment strategy, stored inline in the payment it belongs to.
  *
- * Defines the interface for processing and refunding payments,
- * retrieving the payment type, and obtaining payment details.
- * Concrete payment strategy implementations should inherit from this class.
+ * Every alternative processes and refunds payments, and reports its type and details in
+ * JSON format. The alternatives are closed, so a payment holds its strategy by value: no
+ * allocation or reference count per payment, and calls are dispatched with std::visit
+ * instead of virtual calls. The index of the active alternative is the PaymentMethod.
  */
-class PaymentStrategy {
-    public:
-    virtual std::string processPayment(double amount) = 0;
-    virtual std::string refundPayment(double amount) = 0;
-    virtual std::string getType() const = 0;
-    virtual JSON getDetails() const = 0;
-    virtual ~PaymentStrategy() = default;
-};
\ No newline at end of file
+using PaymentStrategy = std::variant<CreditPayment, PaypalPayment, CashPayment>;
+
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(PaymentMethod::Credit), PaymentStrategy>, CreditPayment>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(PaymentMethod::Paypal), PaymentStrategy>, PaypalPayment>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(PaymentMethod::Cash), PaymentStrategy>, CashPayment>);
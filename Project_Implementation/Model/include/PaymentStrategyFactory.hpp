@@ -1,11 +1,9 @@
 #pragma once
 
-#include <memory>
+#include <optional>
+#include <string>
 #include "PaymentStrategy.hpp"
 #include "../../Third_Party/json.hpp"
-#include "PaypalPayment.hpp"
-#include "CreditPayment.hpp"
-#include "CashPayment.hpp"
 
 using JSON = nlohmann::json;
 
@@ -13,11 +11,16 @@ using JSON = nlohmann::json;
  * @class PaymentStrategyFactory
  * @brief Factory class for creating payment strategy objects.
  *
- * This class provides a static method to instantiate different types of payment strategies
- * based on the provided type string and optional details in JSON format.
+ * This class provides static methods to translate payment method names ("credit",
+ * "paypal", "cash") to and from PaymentMethod, and to build the payment strategy of a
+ * method from its details in JSON format. Names are parsed once, when a payment is
+ * created or loaded; everything else works on the PaymentMethod.
  */
 class PaymentStrategyFactory {
     public:
         PaymentStrategyFactory() = delete;
-        static std::shared_ptr<PaymentStrategy> createPaymentStrategy(const std::string& type, const JSON& details = {});
-};
\ No newline at end of file
+        static std::optional<PaymentMethod> parsePaymentMethod(const std::string& type);
+        static const std::string& getPaymentMethodName(PaymentMethod method);
+        static PaymentStrategy createPaymentStrategy(PaymentMethod method, const JSON& details = {});
+        static PaymentStrategy createPaymentStrategy(const std::string& type, const JSON& details = {});
+};
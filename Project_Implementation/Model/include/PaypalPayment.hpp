@@ -1,25 +1,28 @@
 #pragma once
-#include "PaymentStrategy.hpp"
+#include <string>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
 
 /**
  * @class PaypalPayment
- * @brief Implements the PaymentStrategy interface for PayPal payments.
+ * @brief Payment strategy for PayPal payments, one of the alternatives of PaymentStrategy.
  *
  * This class provides functionality to process and refund payments using PayPal.
- * It stores the PayPal email address associated with the payment and overrides
- * the necessary methods from the PaymentStrategy base class.
+ * It stores the PayPal email address associated with the payment and provides
+ * the methods every PaymentStrategy alternative has.
  *
  * @note The PayPal email must be provided for payment processing.
  */
-class PaypalPayment : public PaymentStrategy {
+class PaypalPayment {
     std::string paypalEmail;
     public:
         PaypalPayment() = default;
         PaypalPayment(std::string email);
-        std::string processPayment(double amount) override;
-        std::string refundPayment(double amount) override;
-        std::string getType() const override { return "paypal"; }
-        JSON getDetails() const override;
+        std::string processPayment(double amount);
+        std::string refundPayment(double amount);
+        std::string getType() const { return "paypal"; }
+        JSON getDetails() const;
 
         ~PaypalPayment() = default;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include "../../Third_Party/json.hpp"
 
@@ -17,14 +18,19 @@ using JSON = nlohmann::json;
  * @enum ReservationStatus
  *      CONFIRMED - The reservation is confirmed.
  *      CANCELLED - The reservation has been cancelled.
+ *      BOARDED - The passenger boarded the flight.
+ *      NO_SHOW - The passenger did not show up for the flight; the seat was released.
  *
  * @constructor ReservationModel()
  *      Default constructor.
- * @constructor ReservationModel(const std::string& flightId, const std::string& passengerId, 
- *      const std::string& seatNumber, const ReservationStatus& status, const std::string& paymentId)
- *      Constructs a ReservationModel with the specified details.
+ * @constructor ReservationModel(std::string flightId, std::string passengerId,
+ *      std::string seatNumber, const ReservationStatus& status, std::string paymentId)
+ *      Constructs a ReservationModel with the specified details, moving the strings into the model.
  * @constructor ReservationModel(const JSON& json)
- *      Constructs a ReservationModel from a JSON object.
+ *      Constructs a ReservationModel from a JSON object, checking that its flight, passenger
+ *      and payment exist and booking its seat on the flight.
+ * @method static ReservationModel fromArchive(const JSON& json)
+ *      Reads an archived reservation from a JSON object without any of those checks.
  *
  * @method void to_json(JSON& json) const
  *      Serializes the reservation model to a JSON object.
@@ -36,11 +42,17 @@ using JSON = nlohmann::json;
  * @method std::string getPassengerId() const
  *      Gets the passenger ID.
  * @method std::string getSeatNumber() const
- *      Gets the seat number.
+ *      Gets the seat number; empty for a reservation sold beyond the physical seats that has no seat yet.
+ * @method bool hasSeat() const
+ *      Returns whether a seat is assigned to the reservation.
  * @method ReservationStatus getStatus() const
  *      Gets the reservation status.
+ * @method std::string getStatusLabel() const
+ *      Gets the reservation status as displayed to users, e.g. "Confirmed".
  * @method std::string getPaymentId() const
  *      Gets the payment ID.
+ * @method std::uint64_t getVersion() const
+ *      Gets the version counter, incremented by the ReservationRepository on every committed update.
  *
  * @method void setReservationId(const std::string& reservationId)
  *      Sets the reservation ID.
@@ -54,6 +66,11 @@ using JSON = nlohmann::json;
  *      Sets the reservation status.
  * @method void setPaymentId(const std::string& paymentId)
  *      Sets the payment ID.
+ * @method void assignSeatNumber(const std::string& seatNumber)
+ *      Sets the seat number of a detached copy without touching the flight's seat map;
+ *      ReservationService::updateReservation moves the seat booking when the copy is committed.
+ * @method void setVersion(std::uint64_t version)
+ *      Sets the version counter.
  *
  * @destructor ~ReservationModel()
  *      Default destructor.
@@ -62,7 +79,9 @@ class ReservationModel {
 public:
     enum class ReservationStatus {
         CONFIRMED,
-        CANCELLED
+        CANCELLED,
+        BOARDED,
+        NO_SHOW
     };
 private:
     std::string reservationId;
@@ -71,12 +90,16 @@ private:
     std::string seatNumber;
     ReservationStatus status;
     std::string paymentId;
+    std::uint64_t version = 0;
+
+    void readFields(const JSON& json);
 
 public:
     ReservationModel() = default;
-    ReservationModel(const std::string& flightId, const std::string& passengerId, 
-        const std::string& seatNumber, const ReservationStatus& status, const std::string& paymentId);
+    ReservationModel(std::string flightId, std::string passengerId,
+        std::string seatNumber, const ReservationStatus& status, std::string paymentId);
     ReservationModel(const JSON& json);
+    static ReservationModel fromArchive(const JSON& json);
 
     void to_json(JSON& json) const;
     
@@ -84,8 +107,11 @@ public:
     inline std::string getFlightId() const                          { return flightId; } 
     inline std::string getPassengerId() const                       { return passengerId; }
     inline std::string getSeatNumber() const                        { return seatNumber; }
+    inline bool hasSeat() const                                     { return !seatNumber.empty(); }
     inline ReservationStatus getStatus() const                      { return status; }
+    std::string getStatusLabel() const;
     inline std::string getPaymentId() const                         { return paymentId; }
+    inline std::uint64_t getVersion() const                         { return version; }
 
 
     inline void setReservationId(const std::string& reservationId)  { this->reservationId = reservationId; }
@@ -94,6 +120,8 @@ public:
     void setSeatNumber(const std::string& seatNumber);
     inline void setStatus(const ReservationStatus& status)          { this->status = status; }
     inline void setPaymentId(const std::string& paymentId)          { this->paymentId = paymentId; }
+    inline void assignSeatNumber(const std::string& seatNumber)     { this->seatNumber = seatNumber; }
+    inline void setVersion(std::uint64_t version)                   { this->version = version; }
 
 
     ~ReservationModel() = default;
@@ -23,6 +23,11 @@
  *     .setPaymentId("PAY-789")
  *     .build();
  * @endcode
+ *
+ * Setters take their arguments by value and move them into the builder. Called on a
+ * temporary, they return the builder as an rvalue, so the build() ending a chain like the
+ * one above (or std::move(builder).build()) moves the collected values on into the
+ * ReservationModel.
  */
 class ReservationModelBuilder {
     std::string flightId = "";
@@ -33,13 +38,19 @@ class ReservationModelBuilder {
 
     public:
         ReservationModelBuilder() = default;
-        ReservationModelBuilder& setFlightId(const std::string& flightId);
-        ReservationModelBuilder& setPassengerId(const std::string& passengerId);
-        ReservationModelBuilder& setSeatNumber(const std::string& seatNumber);
-        ReservationModelBuilder& setStatus(const ReservationModel::ReservationStatus& status);
-        ReservationModelBuilder& setPaymentId(const std::string& paymentId);
+        ReservationModelBuilder& setFlightId(std::string flightId) &;
+        ReservationModelBuilder&& setFlightId(std::string flightId) &&;
+        ReservationModelBuilder& setPassengerId(std::string passengerId) &;
+        ReservationModelBuilder&& setPassengerId(std::string passengerId) &&;
+        ReservationModelBuilder& setSeatNumber(std::string seatNumber) &;
+        ReservationModelBuilder&& setSeatNumber(std::string seatNumber) &&;
+        ReservationModelBuilder& setStatus(const ReservationModel::ReservationStatus& status) &;
+        ReservationModelBuilder&& setStatus(const ReservationModel::ReservationStatus& status) &&;
+        ReservationModelBuilder& setPaymentId(std::string paymentId) &;
+        ReservationModelBuilder&& setPaymentId(std::string paymentId) &&;
 
-        std::shared_ptr<ReservationModel> build() const;
+        std::shared_ptr<ReservationModel> build() const &;
+        std::shared_ptr<ReservationModel> build() &&;
 
         ~ReservationModelBuilder() = default;
 };
\ No newline at end of file
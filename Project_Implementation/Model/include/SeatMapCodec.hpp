@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
+
+/**
+ * @class SeatMapCodec
+ * @brief Compact JSON encoding of a flight's seat map.
+ *
+ * A seat map is written as an object holding its size and one string, instead of a nested
+ * array with a JSON boolean per seat. Seats are taken row by row, and the string is either:
+ * - "runs": the lengths of the alternating runs of free and occupied seats, in decimal and
+ *   separated by commas, starting with free seats (so a first run of 0 means the first
+ *   seat is occupied). A flight with 180 free seats is "180".
+ * - "bits": one bit per seat, 1 for occupied, packed most significant bit first and
+ *   encoded in base64.
+ * The encoder writes whichever string is shorter. For example:
+ *   {"rows": 30, "seatsPerRow": 6, "runs": "0,4,174,2"}
+ *
+ * decode() also reads the legacy nested array of booleans, so files written before the
+ * compact encoding still load.
+ *
+ * @method static JSON encode(const std::vector<std::vector<bool>>& seatMap) Encodes a seat map.
+ * @method static std::vector<std::vector<bool>> decode(const JSON& json) Decodes either encoding.
+ */
+class SeatMapCodec {
+    public:
+        SeatMapCodec() = delete;
+
+        static JSON encode(const std::vector<std::vector<bool>>& seatMap);
+        static std::vector<std::vector<bool>> decode(const JSON& json);
+};
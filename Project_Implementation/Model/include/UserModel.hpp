@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include "../../Third_Party/json.hpp"
 
@@ -13,6 +14,10 @@ using JSON = nlohmann::json;
  * BookingManager, and Admin. Supports construction from parameters or JSON, and enforces
  * serialization via the pure virtual to_json method.
  *
+ * The role is fixed at construction and always matches the derived type, so it serves as
+ * a type tag: userCast() converts to a derived type by comparing the role with the type's
+ * ROLE constant, a branch and a load, instead of a dynamic_cast.
+ *
  * @enum UserType
  *      Passenger       - Regular user who can book tickets.
  *      BookingManager  - User responsible for managing bookings.
@@ -33,7 +38,6 @@ using JSON = nlohmann::json;
  *      void setUserId(const std::string& userId)     - Sets the user ID.
  *      void setUserName(const std::string& username) - Sets the username.
  *      void setPassword(const std::string& password) - Sets the password.
- *      void setRole(const UserType& role)            - Sets the user role.
  *
  *      std::string getUserId() const      - Gets the user ID.
  *      std::string getPassword() const    - Gets the password.
@@ -65,7 +69,6 @@ class UserModel {
         inline void setUserId   (const std::string& userId)     { (this -> userId) = userId; }
         inline void setUserName (const std::string& username)   { (this -> username) = username; }
         inline void setPassword (const std::string& password)   { (this -> password) = password; }
-        inline void setRole     (const UserType& role)          { (this -> role) = role; }
 
         inline std::string  getUserId()      const              { return userId; }
         inline std::string  getPassword()    const              { return password; }
@@ -75,4 +78,34 @@ class UserModel {
         virtual void to_json(JSON& json) const = 0;
 
         virtual ~UserModel() = default;
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Converts a user to a derived user type if its role matches.
+ *
+ * @tparam User The derived type, e.g. Passenger; must declare its role as ROLE.
+ * @param user The user.
+ * @return std::shared_ptr<User> The user as the derived type, or nullptr if it is null or has another role.
+ */
+template <typename User>
+std::shared_ptr<User> userCast(const std::shared_ptr<UserModel>& user) {
+    if (!user || user -> getRole() != User::ROLE) {
+        return nullptr;
+    }
+    return std::static_pointer_cast<User>(user);
+}
+
+/**
+ * @brief Converts a user to a derived user type if its role matches.
+ *
+ * @tparam User The derived type, e.g. Passenger; must declare its role as ROLE.
+ * @param user The user.
+ * @return const User* The user as the derived type, or nullptr if it is null or has another role.
+ */
+template <typename User>
+const User* userCast(const UserModel* user) {
+    if (user == nullptr || user -> getRole() != User::ROLE) {
+        return nullptr;
+    }
+    return static_cast<const User*>(user);
+}
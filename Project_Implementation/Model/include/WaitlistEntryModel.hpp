@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "../../Third_Party/json.hpp"
+#include "../../Utils/include/DateTime.hpp"
+
+using JSON = nlohmann::json;
+
+/**
+ * @class WaitlistEntryModel
+ * @brief Represents a passenger waiting for a seat on a fully booked flight.
+ *
+ * An entry records who is waiting, for which flight, and how the seat is to be paid once
+ * one is freed. Entries are ordered by priority: the passenger's loyalty points at the
+ * time of the request first, then the order in which the requests were made.
+ *
+ * @constructor WaitlistEntryModel()
+ *      Default constructor.
+ * @constructor WaitlistEntryModel(std::string flightId, std::string passengerId, float loyaltyPoints,
+ *      std::string paymentMethod, JSON paymentDetails, std::uint64_t sequence)
+ *      Constructs a new entry requested now, generating a unique entry ID.
+ * @constructor WaitlistEntryModel(const JSON& json)
+ *      Constructs an entry from a JSON object.
+ *
+ * @method void to_json(JSON& json) const
+ *      Serializes the entry to a JSON object.
+ * @method bool hasPriorityOver(const WaitlistEntryModel& other) const
+ *      Returns whether this entry is to be served before the other one.
+ *
+ * @destructor ~WaitlistEntryModel()
+ *      Default destructor.
+ */
+class WaitlistEntryModel {
+    std::string entryId;
+    std::string flightId;
+    std::string passengerId;
+    float loyaltyPoints = 0.0f;
+    DateTime requestedAt;
+    std::uint64_t sequence = 0;
+    std::string paymentMethod;
+    JSON paymentDetails;
+
+    public:
+        WaitlistEntryModel() = default;
+        WaitlistEntryModel(std::string flightId, std::string passengerId, float loyaltyPoints,
+            std::string paymentMethod, JSON paymentDetails, std::uint64_t sequence);
+        WaitlistEntryModel(const JSON& json);
+
+        void to_json(JSON& json) const;
+        bool hasPriorityOver(const WaitlistEntryModel& other) const;
+
+        inline const std::string& getEntryId() const                    { return entryId; }
+        inline const std::string& getFlightId() const                   { return flightId; }
+        inline const std::string& getPassengerId() const                { return passengerId; }
+        inline float getLoyaltyPoints() const                           { return loyaltyPoints; }
+        inline const DateTime& getRequestedAt() const                   { return requestedAt; }
+        inline std::uint64_t getSequence() const                        { return sequence; }
+        inline const std::string& getPaymentMethod() const              { return paymentMethod; }
+        inline const JSON& getPaymentDetails() const                    { return paymentDetails; }
+
+        ~WaitlistEntryModel() = default;
+};
@@ -0,0 +1,45 @@
+#include "../include/AirportModel.hpp"
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Constructs an AirportModel object from a JSON representation.
+ *
+ * The required keys are "id", the three-letter upper-case IATA code of the airport,
+ * "city" and "name", which must not be empty.
+ *
+ * @param json The JSON object containing airport data.
+ * @throws std::invalid_argument If any required key is missing, or if any value fails validation.
+ */
+AirportModel::AirportModel(const JSON& json) {
+    const std::vector<std::string> required_keys = {"id", "city", "name"};
+    for (const auto& key : required_keys) {
+        if (!json.contains(key)) {
+            throw std::invalid_argument("Invalid JSON for AirportModel: missing key '" + key + "'.");
+        }
+    }
+    code = json.at("id").get<std::string>();
+    if (code.size() != 3 || !std::isupper(static_cast<unsigned char>(code[0])) ||
+        !std::isupper(static_cast<unsigned char>(code[1])) || !std::isupper(static_cast<unsigned char>(code[2]))) {
+        throw std::invalid_argument("Invalid IATA code for AirportModel: " + code);
+    }
+    city = json.at("city").get<std::string>();
+    name = json.at("name").get<std::string>();
+    if (city.empty() || name.empty()) {
+        throw std::invalid_argument("Airport city and name cannot be empty.");
+    }
+}
+
+/**
+ * @brief Serializes the AirportModel object to a JSON representation.
+ *
+ * @param json The JSON object to populate with the airport's data.
+ */
+void AirportModel::to_json(JSON& json) const {
+    json = JSON {
+        {"id", code},
+        {"city", city},
+        {"name", name}
+    };
+}
@@ -0,0 +1,42 @@
+#include "../include/FareRules.hpp"
+
+using RegionalFareTable = FareTable<4, FareRules::FIRST_CLASS_ROWS, FareRules::BUSINESS_CLASS_ROWS>;
+using NarrowFareTable = FareTable<5, FareRules::FIRST_CLASS_ROWS, FareRules::BUSINESS_CLASS_ROWS>;
+using SingleAisleFareTable = FareTable<6, FareRules::FIRST_CLASS_ROWS, FareRules::BUSINESS_CLASS_ROWS>;
+
+// The tables must price every seat exactly like the rules they are built from
+static_assert(SingleAisleFareTable::getFare(0, 0) == 220.0f, "First class window seat");
+static_assert(SingleAisleFareTable::getFare(5, 2) == 160.0f, "Business class aisle seat");
+static_assert(SingleAisleFareTable::getFare(15, 1) == 100.0f, "Economy middle seat");
+static_assert(SingleAisleFareTable::getFare(29, 3) == 110.0f, "Economy aisle seat");
+static_assert(RegionalFareTable::getFare(0, 3) == 220.0f, "Regional window seat");
+
+/**
+ * @brief Returns the base fare of a seat.
+ *
+ * Rows of four, five or six seats are priced from their compile-time FareTable; other
+ * row widths, and columns outside the row, are priced by evaluating the rules.
+ *
+ * @param row The zero-based row of the seat in the seat map.
+ * @param column The zero-based column of the seat in the seat map, 0 being column 'A'.
+ * @param seatsPerRow The number of seats in each row of the aircraft.
+ * @return float The fare of the cabin of the row plus the premium of the column.
+ */
+float FareRules::getBaseFare(std::size_t row, std::size_t column, std::size_t seatsPerRow) {
+    if (column < seatsPerRow) {
+        switch (seatsPerRow) {
+            case 4: return RegionalFareTable::getFare(row, column);
+            case 5: return NarrowFareTable::getFare(row, column);
+            case 6: return SingleAisleFareTable::getFare(row, column);
+            default: break;
+        }
+    }
+    return getCabinFare(getCabin(row)) + getColumnPremium(column, seatsPerRow);
+}
+
+/**
+ * @brief Returns the fare of a reservation sold without a seat, which is the economy fare.
+ */
+float FareRules::getSeatlessFare() {
+    return getCabinFare(Cabin::Economy);
+}
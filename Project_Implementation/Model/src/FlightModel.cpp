@@ -1,10 +1,12 @@
 #include "../include/FlightModel.hpp"
+#include "../include/SeatMapCodec.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/IDGenerator.hpp"
 #include "../../Repositories/include/FlightRepository.hpp"
 #include "../../Repositories/include/AircraftRepository.hpp"
 #include "../../Repositories/include/CrewMemberRepository.hpp"
 #include <stdexcept>
+#include <utility>
 
 std::pair<int, int> FlightModel::getSeatIndices(const std::string& seatNumber) const {
     auto aircraftOpt = AircraftRepository::getInstance() -> findAircraftById(aircraftId);
@@ -49,7 +51,8 @@ std::pair<int, int> FlightModel::getSeatIndices(const std::string& seatNumber) c
  * Initializes a flight with origin, destination, departure and arrival times, aircraft ID, and crew member IDs.
  * Validates that origin and destination are not empty, arrival time is after departure time, and that the specified
  * aircraft and crew members exist in their respective repositories. Initializes the seat map based on the aircraft's
- * configuration and generates a unique flight ID.
+ * configuration and generates a unique flight ID. The string and crew list arguments are taken by
+ * value and moved into the model, so callers passing rvalues (e.g. FlightModelBuilder::build() &&) copy nothing.
  *
  * @param origin The origin airport code or name.
  * @param destination The destination airport code or name.
@@ -61,12 +64,12 @@ std::pair<int, int> FlightModel::getSeatIndices(const std::string& seatNumber) c
  * @throws std::invalid_argument If origin or destination is empty, arrival time is not after departure time,
  *         the aircraft ID does not exist, or any crew member ID does not exist.
  */
-FlightModel::FlightModel(const std::string& origin, const std::string& destination,
-                     const DateTime& departureTime, const DateTime& arrivalTime, const std::string& aircraftId,
-                     const std::vector<std::string>& crewMemberIds) :
-        origin(origin), destination(destination) {
+FlightModel::FlightModel(std::string origin, std::string destination,
+                     const DateTime& departureTime, const DateTime& arrivalTime, std::string aircraftId,
+                     std::vector<std::string> crewMemberIds) :
+        origin(std::move(origin)), destination(std::move(destination)) {
 
-        if (origin.empty() || destination.empty()) {
+        if ((this -> origin).empty() || (this -> destination).empty()) {
             throw std::invalid_argument("Origin and Destination cannot be empty");
         }
         if (arrivalTime <= departureTime) {
@@ -77,19 +80,18 @@ FlightModel::FlightModel(const std::string& origin, const std::string& destinati
         
         auto airCraftOpt = AircraftRepository::getInstance() -> findAircraftById(aircraftId);
         if ( airCraftOpt.has_value() ) {
-            this -> aircraftId = aircraftId;
+            this -> aircraftId = std::move(aircraftId);
         } else {
             throw std::invalid_argument("Aircraft with ID " + aircraftId + " does not exist");
         }
         
         auto crewMemberRepository = CrewMemberRepository::getInstance();
         for (const auto& crewMemberId : crewMemberIds) {
-            if (crewMemberRepository->findCrewMemberById(crewMemberId).has_value()) {
-                (this -> crewMemberIds).push_back(crewMemberId);
-            } else {
+            if (!crewMemberRepository->findCrewMemberById(crewMemberId).has_value()) {
                 throw std::invalid_argument("Crew Member with ID " + crewMemberId + " does not exist");
             }
         }
+        this -> crewMemberIds = std::move(crewMemberIds);
 
         seatMap = std::vector<std::vector<bool>>(airCraftOpt.value() -> getNumOfRows(),
                                         std::vector<bool>(airCraftOpt.value() -> getNumOfRowSeats(), false));
@@ -101,19 +103,14 @@ FlightModel::FlightModel(const std::string& origin, const std::string& destinati
         }
 }
 /**
- * @brief Constructs a FlightModel object from a JSON representation.
- *
- * This constructor validates and initializes a FlightModel instance using the provided JSON object.
- * It checks for the presence of required keys, validates the format and values of flight details,
- * ensures the existence of referenced aircraft and crew members, and verifies the seat map dimensions.
+ * @brief Reads the fields of a flight from JSON, checking only their format.
  *
  * @param json The JSON object containing flight information.
  *
  * @throws std::invalid_argument If any required key is missing, if the flight ID format is invalid,
- *         if origin or destination is empty, if departure or arrival times are invalid or incorrectly ordered,
- *         if the referenced aircraft or crew members do not exist, or if the seat map size does not match the aircraft configuration.
+ *         if origin or destination is empty, or if departure or arrival times are invalid or incorrectly ordered.
  */
-FlightModel::FlightModel(const JSON& json) {
+void FlightModel::readFields(const JSON& json) {
     const std::vector<std::string> required_keys = {
         "id", "origin", "destination", "departureTime", "arrivalTime", "aircraftId", "crewMemberIds"
     };
@@ -147,33 +144,71 @@ FlightModel::FlightModel(const JSON& json) {
     }
 
     aircraftId = json.at("aircraftId").get<std::string>();
+    crewMemberIds = json.at("crewMemberIds").get<std::vector<std::string>>();
+    seatMap = SeatMapCodec::decode(json.at("seatMap"));
+
+    // Files written before version counters were introduced have no version.
+    version = json.value("version", std::uint64_t{0});
+}
+
+/**
+ * @brief Constructs a FlightModel object from a JSON representation.
+ *
+ * This constructor validates and initializes a FlightModel instance using the provided JSON object.
+ * It checks for the presence of required keys, validates the format and values of flight details,
+ * ensures the existence of referenced aircraft and crew members, and verifies the seat map dimensions.
+ *
+ * @param json The JSON object containing flight information.
+ *
+ * @throws std::invalid_argument If any required key is missing, if the flight ID format is invalid,
+ *         if origin or destination is empty, if departure or arrival times are invalid or incorrectly ordered,
+ *         if the referenced aircraft or crew members do not exist, or if the seat map size does not match the aircraft configuration.
+ */
+FlightModel::FlightModel(const JSON& json) {
+    readFields(json);
+
     auto aircraftOpt = AircraftRepository::getInstance()->findAircraftById(aircraftId);
     if (!aircraftOpt.has_value()) {
         throw std::invalid_argument("Aircraft with ID " + aircraftId + " does not exist.");
     }
 
-    crewMemberIds = json.at("crewMemberIds").get<std::vector<std::string>>();
     for (const auto& crewMemberId : crewMemberIds) {
         if (!CrewMemberRepository::getInstance()->findCrewMemberById(crewMemberId).has_value()) {
             throw std::invalid_argument("Crew Member with ID " + crewMemberId + " does not exist.");
         }
     }
 
-    seatMap = json.at("seatMap").get<std::vector<std::vector<bool>>>();
     int rowSize = static_cast<int>(seatMap.size());
-    int colSize = static_cast<int>(seatMap[0].size());
+    int colSize = seatMap.empty() ? 0 : static_cast<int>(seatMap[0].size());
 
     if ( colSize != aircraftOpt.value() -> getNumOfRowSeats() ||  rowSize != aircraftOpt.value() -> getNumOfRows() ) {
         throw std::invalid_argument("Invalid seat map size");
     }
 }
 
+/**
+ * @brief Reads a flight back from the archive.
+ *
+ * Its aircraft and crew members may have been deleted since the flight was archived, so
+ * only the format of the fields is checked; the seat map is kept as archived.
+ *
+ * @param json The JSON object containing flight information.
+ * @return FlightModel The archived flight.
+ * @throws std::invalid_argument If any field is missing or malformed.
+ */
+FlightModel FlightModel::fromArchive(const JSON& json) {
+    FlightModel flight;
+    flight.readFields(json);
+    return flight;
+}
+
 /**
  * @brief Serializes the FlightModel object to a JSON representation.
  *
  * This method populates the provided JSON object with the flight's details,
  * including its ID, origin, destination, departure and arrival times, aircraft ID,
- * crew member IDs, and seat map.
+ * crew member IDs, seat map, and version counter. The seat map is written in the
+ * compact SeatMapCodec encoding.
  *
  * @param json Reference to a JSON object that will be populated with the flight data.
  */
@@ -186,7 +221,8 @@ void FlightModel::to_json(JSON& json) const {
         {"arrivalTime", arrivalTime.toString()},
         {"aircraftId", aircraftId},
         {"crewMemberIds", crewMemberIds},
-        {"seatMap", seatMap}
+        {"seatMap", SeatMapCodec::encode(seatMap)},
+        {"version", version}
     };
 }
 
@@ -227,6 +263,22 @@ bool FlightModel::getSeatStatus(const std::string& seatNumber) const {
     return seatMap[seatIndices.first][seatIndices.second];
 }
 
+/**
+ * @brief Checks whether every seat of the flight is occupied.
+ *
+ * @return true if no seat is available, false otherwise.
+ */
+bool FlightModel::isFullyBooked() const {
+    for (const auto& row : seatMap) {
+        for (bool occupied : row) {
+            if (!occupied) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Removes a crew member ID from the flight's crew member list.
  *
@@ -1,4 +1,6 @@
 #include "../include/FlightModelBuilder.hpp"
+#include <stdexcept>
+#include <utility>
 
 /**
  * @brief Sets the origin for the flight model.
@@ -8,8 +10,8 @@
  * @param origin The origin location as a string.
  * @return Reference to the current FlightModelBuilder instance for method chaining.
  */
-FlightModelBuilder& FlightModelBuilder::setOrigin(const std::string& origin) {
-    (this -> origin) = origin;
+FlightModelBuilder& FlightModelBuilder::setOrigin(std::string origin) & {
+    (this -> origin) = std::move(origin);
     return *this;
 }
 /**
@@ -21,8 +23,8 @@ FlightModelBuilder& FlightModelBuilder::setOrigin(const std::string& origin) {
  * @param destination The destination to set for the flight model.
  * @return Reference to the current FlightModelBuilder instance.
  */
-FlightModelBuilder& FlightModelBuilder::setDestination(const std::string& destination) {
-    (this -> destination) = destination;
+FlightModelBuilder& FlightModelBuilder::setDestination(std::string destination) & {
+    (this -> destination) = std::move(destination);
     return *this;
 }
 /**
@@ -33,7 +35,7 @@ FlightModelBuilder& FlightModelBuilder::setDestination(const std::string& destin
  * @param time The departure time to set.
  * @return Reference to the current FlightModelBuilder instance for method chaining.
  */
-FlightModelBuilder& FlightModelBuilder::setDepartureTime(const DateTime& time) {
+FlightModelBuilder& FlightModelBuilder::setDepartureTime(const DateTime& time) & {
     (this -> departureTime) = time;
     return *this;
 }
@@ -45,7 +47,7 @@ FlightModelBuilder& FlightModelBuilder::setDepartureTime(const DateTime& time) {
  * @param time The arrival time as a DateTime object.
  * @return Reference to the current FlightModelBuilder instance for method chaining.
  */
-FlightModelBuilder& FlightModelBuilder::setArrivalTime(const DateTime& time) {
+FlightModelBuilder& FlightModelBuilder::setArrivalTime(const DateTime& time) & {
     (this -> arrivalTime) = time;
     return *this;
 }
@@ -57,8 +59,8 @@ FlightModelBuilder& FlightModelBuilder::setArrivalTime(const DateTime& time) {
  * @param id The aircraft ID to set.
  * @return Reference to the current FlightModelBuilder instance for method chaining.
  */
-FlightModelBuilder& FlightModelBuilder::setAircraftId(const std::string& id) {
-    (this -> aircraftId) = id;
+FlightModelBuilder& FlightModelBuilder::setAircraftId(std::string id) & {
+    (this -> aircraftId) = std::move(id);
     return *this;
 }
 /**
@@ -71,8 +73,8 @@ FlightModelBuilder& FlightModelBuilder::setAircraftId(const std::string& id) {
  * @param ids A vector of strings representing the crew member IDs.
  * @return Reference to the current FlightModelBuilder instance for chaining.
  */
-FlightModelBuilder& FlightModelBuilder::setCrewMemberIds(const std::vector<std::string>& ids) {
-    (this -> crewMemberIds) = ids;
+FlightModelBuilder& FlightModelBuilder::setCrewMemberIds(std::vector<std::string> ids) & {
+    (this -> crewMemberIds) = std::move(ids);
     return *this;
 }
 /**
@@ -84,26 +86,106 @@ FlightModelBuilder& FlightModelBuilder::setCrewMemberIds(const std::vector<std::
  * @param id The crew member ID to add.
  * @return Reference to the current FlightModelBuilder instance for method chaining.
  */
-FlightModelBuilder& FlightModelBuilder::addCrewMemberId(const std::string& id) {
-    (this -> crewMemberIds).push_back(id);
+FlightModelBuilder& FlightModelBuilder::addCrewMemberId(std::string id) & {
+    (this -> crewMemberIds).push_back(std::move(id));
     return *this;
 }
 
+/**
+ * @brief Sets the origin on a temporary builder.
+ *
+ * Keeps a setter chain on a temporary an rvalue, so the build() ending it moves the
+ * collected values instead of copying them.
+ *
+ * @param origin The origin location as a string.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setOrigin(std::string origin) && {
+    return std::move(this -> setOrigin(std::move(origin)));
+}
+/**
+ * @brief Sets the destination on a temporary builder.
+ *
+ * @param destination The destination to set for the flight model.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setDestination(std::string destination) && {
+    return std::move(this -> setDestination(std::move(destination)));
+}
+/**
+ * @brief Sets the departure time on a temporary builder.
+ *
+ * @param time The departure time to set.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setDepartureTime(const DateTime& time) && {
+    return std::move(this -> setDepartureTime(time));
+}
+/**
+ * @brief Sets the arrival time on a temporary builder.
+ *
+ * @param time The arrival time as a DateTime object.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setArrivalTime(const DateTime& time) && {
+    return std::move(this -> setArrivalTime(time));
+}
+/**
+ * @brief Sets the aircraft ID on a temporary builder.
+ *
+ * @param id The aircraft ID to set.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setAircraftId(std::string id) && {
+    return std::move(this -> setAircraftId(std::move(id)));
+}
+/**
+ * @brief Sets the crew member IDs on a temporary builder.
+ *
+ * @param ids A vector of strings representing the crew member IDs.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::setCrewMemberIds(std::vector<std::string> ids) && {
+    return std::move(this -> setCrewMemberIds(std::move(ids)));
+}
+/**
+ * @brief Adds a crew member ID on a temporary builder.
+ *
+ * @param id The crew member ID to add.
+ * @return Rvalue reference to the current FlightModelBuilder instance for method chaining.
+ */
+FlightModelBuilder&& FlightModelBuilder::addCrewMemberId(std::string id) && {
+    return std::move(this -> addCrewMemberId(std::move(id)));
+}
+
 /**
  * @brief Builds and returns a shared pointer to a FlightModel instance.
  *
- * This method constructs a FlightModel object using the parameters set in the builder.
- * It validates that all required parameters (origin, destination, aircraftId, crewMemberIds)
+ * This method constructs a FlightModel object from a copy of the parameters set in the
+ * builder, leaving the builder reusable. It validates that all required parameters (origin, destination, aircraftId, crewMemberIds)
  * are provided and throws std::invalid_argument if any are missing.
  *
  * @return std::shared_ptr<FlightModel> A shared pointer to the constructed FlightModel.
  * @throws std::invalid_argument If any required flight parameter is missing.
  */
-std::shared_ptr<FlightModel> FlightModelBuilder::build() const {
+std::shared_ptr<FlightModel> FlightModelBuilder::build() const & {
+    return FlightModelBuilder(*this).build();
+}
+
+/**
+ * @brief Builds a FlightModel by moving the builder's values into it.
+ *
+ * Used when the builder is an rvalue, e.g. a temporary at the end of a setter chain
+ * or std::move(builder). The builder is left in a valid but unspecified state.
+ *
+ * @return std::shared_ptr<FlightModel> A shared pointer to the constructed FlightModel.
+ * @throws std::invalid_argument If any required flight parameter is missing.
+ */
+std::shared_ptr<FlightModel> FlightModelBuilder::build() && {
     if (origin.empty() || destination.empty() || aircraftId.empty()) {
         throw std::invalid_argument("Missing required flight parameters.");
     }
     return std::make_shared<FlightModel>(
-        origin, destination, departureTime, arrivalTime, aircraftId, crewMemberIds
+        std::move(origin), std::move(destination), departureTime, arrivalTime, std::move(aircraftId), std::move(crewMemberIds)
     );
 }
\ No newline at end of file
@@ -21,12 +21,11 @@
  * @throws std::invalid_argument If any of the following conditions are met:
  *         - passengerId is empty
  *         - amount is less than or equal to zero
- *         - strategy is null
  *         - passengerId does not exist in the user repository
  */
 PaymentModel::PaymentModel(const std::string& passengerId, double amount, 
-        const std::shared_ptr<PaymentStrategy>& strategy, const PaymentStatus& status, const DateTime& paymentDate) {
-    if (passengerId.empty() || amount <= 0 || !strategy) {
+        PaymentStrategy strategy, const PaymentStatus& status, const DateTime& paymentDate) {
+    if (passengerId.empty() || amount <= 0) {
         throw std::invalid_argument("Invalid payment details provided.");
     }
     if (!UserRepository::getInstance() -> findUserById(passengerId).has_value()) {
@@ -43,7 +42,7 @@ PaymentModel::PaymentModel(const std::string& passengerId, double amount,
     paymentId = id;
     this -> passengerId = passengerId;
     this -> amount = amount;
-    this -> paymentStrategy = strategy;
+    this -> paymentStrategy = std::move(strategy);
     this -> status = status;
     if (paymentDate.isValid()) {
         this->paymentDate = paymentDate;
@@ -53,20 +52,15 @@ PaymentModel::PaymentModel(const std::string& passengerId, double amount,
 }
         
 /**
- * @brief Constructs a PaymentModel object from a JSON representation.
- *
- * This constructor initializes a PaymentModel instance using the provided JSON object.
- * It validates the presence of required fields, checks the format of the payment ID,
- * verifies the existence of the passenger ID, ensures the payment amount is positive,
- * creates the appropriate payment strategy, validates the payment date, and sets the payment status.
+ * @brief Reads the fields of a payment from JSON, checking only their format.
  *
  * @param json The JSON object containing payment information.
  *
  * @throws std::invalid_argument If any required field is missing, the payment ID format is invalid,
- *         the passenger ID does not exist, the amount is not greater than zero, the payment date is invalid,
- *         or the payment status is not recognized.
+ *         the amount is not greater than zero, the payment method is unknown, the payment date
+ *         is invalid, or the payment status is not recognized.
  */
-PaymentModel::PaymentModel(const JSON& json) {
+void PaymentModel::readFields(const JSON& json) {
     std::vector<std::string> requiredTags = {"id", "passengerId", "amount", "method", "paymentDate", "status"};
     for ( const auto& tag : requiredTags ) {
         if (!json.contains(tag)) {
@@ -79,16 +73,17 @@ PaymentModel::PaymentModel(const JSON& json) {
         throw std::invalid_argument("Invalid ID for PaymentModel");
     }
     passengerId = json.at("passengerId").get<std::string>();
-    if (!UserRepository::getInstance() -> findUserById(passengerId).has_value()) {
-        throw std::invalid_argument("Passenger ID does not exist.");
-    }
     amount = json.at("amount").get<double>();
     if (amount <= 0) {
         throw std::invalid_argument("Amount must be greater than zero.");
     }
 
     std::string strategyType = json.at("method").get<std::string>();
-    paymentStrategy = PaymentStrategyFactory::createPaymentStrategy(strategyType, json.at("details"));
+    auto method = PaymentStrategyFactory::parsePaymentMethod(strategyType);
+    if (!method.has_value()) {
+        throw std::invalid_argument("Unknown payment method: " + strategyType);
+    }
+    paymentStrategy = PaymentStrategyFactory::createPaymentStrategy(method.value(), json.at("details"));
 
     paymentDate = DateTime(json.at("paymentDate").get<std::string>());
     if (!paymentDate.isValid()) {
@@ -104,6 +99,43 @@ PaymentModel::PaymentModel(const JSON& json) {
     }
 }
 
+/**
+ * @brief Constructs a PaymentModel object from a JSON representation.
+ *
+ * This constructor initializes a PaymentModel instance using the provided JSON object.
+ * It validates the presence of required fields, checks the format of the payment ID,
+ * verifies the existence of the passenger ID, ensures the payment amount is positive,
+ * creates the appropriate payment strategy, validates the payment date, and sets the payment status.
+ *
+ * @param json The JSON object containing payment information.
+ *
+ * @throws std::invalid_argument If any required field is missing, the payment ID format is invalid,
+ *         the passenger ID does not exist, the amount is not greater than zero, the payment method is unknown,
+ *         the payment date is invalid, or the payment status is not recognized.
+ */
+PaymentModel::PaymentModel(const JSON& json) {
+    readFields(json);
+    if (!UserRepository::getInstance() -> findUserById(passengerId).has_value()) {
+        throw std::invalid_argument("Passenger ID does not exist.");
+    }
+}
+
+/**
+ * @brief Reads a payment back from the archive.
+ *
+ * Its passenger may have been deleted since the payment was archived, so only the format
+ * of the fields is checked.
+ *
+ * @param json The JSON object containing payment information.
+ * @return PaymentModel The archived payment.
+ * @throws std::invalid_argument If any field is missing or malformed.
+ */
+PaymentModel PaymentModel::fromArchive(const JSON& json) {
+    PaymentModel payment;
+    payment.readFields(json);
+    return payment;
+}
+
 /**
  * @brief Processes the payment using the assigned payment strategy.
  *
@@ -114,7 +146,7 @@ PaymentModel::PaymentModel(const JSON& json) {
  */
 std::string PaymentModel::processPayment() {
     this -> status = PaymentStatus::COMPLETED;
-    return paymentStrategy -> processPayment(amount);
+    return std::visit([this](auto& strategy) { return strategy.processPayment(amount); }, paymentStrategy);
 }
 /**
  * @brief Refunds the current payment.
@@ -126,7 +158,7 @@ std::string PaymentModel::processPayment() {
  */
 std::string PaymentModel::refundPayment() {
     this -> status = PaymentStatus::REFUNDED;
-    return paymentStrategy -> refundPayment(amount);
+    return std::visit([this](auto& strategy) { return strategy.refundPayment(amount); }, paymentStrategy);
 }
 
 
@@ -135,8 +167,7 @@ std::string PaymentModel::refundPayment() {
  *
  * This method assigns a new value to the provided JSON reference, containing the payment's details,
  * including its ID, passenger ID, amount, payment method, payment date, and status.
- * If a payment strategy is set, its type and details are included; otherwise,
- * the method is set to "unknown".
+ * The method is written from the payment's PaymentMethod, and the details from its strategy.
  *
  * @param json Reference to a JSON object that will be assigned the payment data.
  */
@@ -145,9 +176,9 @@ void PaymentModel::to_json(JSON& json) const {
         {"id", paymentId},
         {"passengerId", passengerId},
         {"amount", amount},
-        {"method", paymentStrategy ? paymentStrategy -> getType() : "UNKNOWN"},
+        {"method", PaymentStrategyFactory::getPaymentMethodName(getPaymentMethod())},
         {"paymentDate", paymentDate.toString()},
-        {"details", paymentStrategy ? paymentStrategy -> getDetails() : JSON{}}
+        {"details", std::visit([](const auto& strategy) { return strategy.getDetails(); }, paymentStrategy)}
     };
 
     switch (status) {
@@ -1,53 +1,99 @@
 #include "../include/PaymentStrategyFactory.hpp"
+#include <array>
 #include <stdexcept>
 
 /**
- * @brief Creates a payment strategy instance based on the specified type and details.
+ * @brief The names of the payment methods, indexed by PaymentMethod.
+ */
+static const std::array<std::string, std::variant_size_v<PaymentStrategy>> PAYMENT_METHOD_NAMES = {"credit", "paypal", "cash"};
+
+/**
+ * @brief Parses the name of a payment method.
  *
- * This factory method constructs and returns a shared pointer to a PaymentStrategy
- * implementation according to the provided payment type and associated details.
+ * @param type The name of the payment method ("credit", "paypal" or "cash").
+ * @return std::optional<PaymentMethod> The payment method, or std::nullopt if the name is unknown.
+ */
+std::optional<PaymentMethod> PaymentStrategyFactory::parsePaymentMethod(const std::string& type) {
+    for (std::size_t method = 0; method < PAYMENT_METHOD_NAMES.size(); method++) {
+        if (PAYMENT_METHOD_NAMES[method] == type) {
+            return static_cast<PaymentMethod>(method);
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Returns the name of a payment method, as stored in the database.
  *
- * Supported payment types:
- * - "paypal": Requires 'email' field in details.
- * - "credit": Requires 'cardNumber', 'expirationDate', and 'cvv' fields in details.
- * - "cash": Does not require any details.
+ * @param method The payment method.
+ * @return const std::string& The name of the payment method.
+ */
+const std::string& PaymentStrategyFactory::getPaymentMethodName(PaymentMethod method) {
+    return PAYMENT_METHOD_NAMES[static_cast<std::size_t>(method)];
+}
+
+/**
+ * @brief Creates the payment strategy of a payment method from its details.
  *
- * @param type The type of payment strategy to create ("paypal", "credit", "cash").
- * @param details A JSON object containing the necessary fields for the selected payment type.
- * @return std::shared_ptr<PaymentStrategy> A shared pointer to the created payment strategy.
+ * Required details:
+ * - PaymentMethod::Paypal: 'email'.
+ * - PaymentMethod::Credit: 'cardNumber', 'expirationDate' and 'cvv'.
+ * - PaymentMethod::Cash: none.
  *
- * @throws std::invalid_argument If required fields are missing, empty, or if the type is unknown.
+ * @param method The payment method.
+ * @param details A JSON object containing the necessary fields for the payment method.
+ * @return PaymentStrategy The payment strategy, holding the method's alternative.
+ *
+ * @throws std::invalid_argument If required fields are missing or empty.
  */
-std::shared_ptr<PaymentStrategy> PaymentStrategyFactory::createPaymentStrategy(const std::string& type, const JSON& details) {
-    if (type == "paypal") {
-        if (!details.contains("email")) {
-            throw std::invalid_argument("PayPal payment details require an 'email' field.");
-        }
-        auto email = details.at("email").get<std::string>();
-        if (email.empty()) {
-            throw std::invalid_argument("PayPal payment email cannot be empty.");
+PaymentStrategy PaymentStrategyFactory::createPaymentStrategy(PaymentMethod method, const JSON& details) {
+    switch (method) {
+        case PaymentMethod::Paypal: {
+            if (!details.contains("email")) {
+                throw std::invalid_argument("PayPal payment details require an 'email' field.");
+            }
+            auto email = details.at("email").get<std::string>();
+            if (email.empty()) {
+                throw std::invalid_argument("PayPal payment email cannot be empty.");
+            }
+            return PaypalPayment(email);
         }
-        return std::make_shared<PaypalPayment>(email);
-    } else if (type == "credit") {
-        if (!details.contains("cardNumber") || !details.contains("expirationDate") || !details.contains("cvv")) {
-            throw std::invalid_argument("Credit Card payment details require 'cardNumber', 'expirationDate', and 'cvv' fields.");
-        }
-        auto cardNumber = details.at("cardNumber").get<std::string>();
-        auto expirationDate = details.at("expirationDate").get<std::string>();
-        auto cvv = details.at("cvv").get<std::string>();
+        case PaymentMethod::Credit: {
+            if (!details.contains("cardNumber") || !details.contains("expirationDate") || !details.contains("cvv")) {
+                throw std::invalid_argument("Credit Card payment details require 'cardNumber', 'expirationDate', and 'cvv' fields.");
+            }
+            auto cardNumber = details.at("cardNumber").get<std::string>();
+            auto expirationDate = details.at("expirationDate").get<std::string>();
+            auto cvv = details.at("cvv").get<std::string>();
 
-        if (cardNumber.empty() || expirationDate.empty() || cvv.empty()) {
-            throw std::invalid_argument("Credit Card payment details cannot be empty.");
+            if (cardNumber.empty() || expirationDate.empty() || cvv.empty()) {
+                throw std::invalid_argument("Credit Card payment details cannot be empty.");
+            }
+            return CreditPayment(
+                cardNumber,
+                expirationDate,
+                cvv
+            );
         }
-        return std::make_shared<CreditPayment>(
-            cardNumber,
-            expirationDate,
-            cvv
-        );
-    } else if (type == "cash") {
-        // Cash payment does not require details
-        return std::make_shared<CashPayment>();
-    } else {
+        default:
+            // Cash payment does not require details
+            return CashPayment();
+    }
+}
+
+/**
+ * @brief Creates a payment strategy from the name of its payment method and its details.
+ *
+ * @param type The name of the payment method ("paypal", "credit", "cash").
+ * @param details A JSON object containing the necessary fields for the selected payment type.
+ * @return PaymentStrategy The payment strategy, holding the method's alternative.
+ *
+ * @throws std::invalid_argument If required fields are missing, empty, or if the type is unknown.
+ */
+PaymentStrategy PaymentStrategyFactory::createPaymentStrategy(const std::string& type, const JSON& details) {
+    auto method = parsePaymentMethod(type);
+    if (!method.has_value()) {
         throw std::invalid_argument("Unknown payment strategy type: " + type);
     }
-}
\ No newline at end of file
+    return createPaymentStrategy(method.value(), details);
+}
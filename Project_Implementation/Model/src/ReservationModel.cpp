@@ -6,6 +6,20 @@
 #include "../../Repositories/include/PaymentRepository.hpp"
 #include <vector>
 #include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Returns the name under which a reservation status is stored in JSON.
+ */
+static const char* getStatusName(ReservationModel::ReservationStatus status) {
+    switch (status) {
+        case ReservationModel::ReservationStatus::CONFIRMED:    return "CONFIRMED";
+        case ReservationModel::ReservationStatus::CANCELLED:    return "CANCELLED";
+        case ReservationModel::ReservationStatus::BOARDED:      return "BOARDED";
+        case ReservationModel::ReservationStatus::NO_SHOW:      return "NO_SHOW";
+    }
+    return "CONFIRMED";
+}
 
 /**
  * @brief Constructs a ReservationModel object with the provided details.
@@ -14,7 +28,8 @@
  * with a designated seat number, reservation status, and associated payment ID.
  * It performs validation to ensure that the passenger ID, flight ID, and payment ID exist
  * in their respective repositories. If any of these IDs are invalid, an exception is thrown.
- * A unique reservation ID is generated and assigned to the reservation.
+ * A unique reservation ID is generated and assigned to the reservation. The string arguments
+ * are taken by value and moved into the model.
  *
  * @param flightId The unique identifier of the flight.
  * @param passengerId The unique identifier of the passenger.
@@ -24,8 +39,8 @@
  *
  * @throws std::invalid_argument If the passenger ID, flight ID, or payment ID does not exist.
  */
-ReservationModel::ReservationModel(const std::string& flightId, const std::string& passengerId, 
-    const std::string& seatNumber, const ReservationStatus& status, const std::string& paymentId) {
+ReservationModel::ReservationModel(std::string flightId, std::string passengerId,
+    std::string seatNumber, const ReservationStatus& status, std::string paymentId) {
     auto userRepository = UserRepository::getInstance();
     if ( !userRepository -> findUserById(passengerId).has_value() ) {
         throw std::invalid_argument("Passenger ID does not exist.");
@@ -47,26 +62,22 @@ ReservationModel::ReservationModel(const std::string& flightId, const std::strin
     while ( reservationRepository -> findReservationById(reservationId).has_value() ) {
         reservationId = "RES-" + IDGenerator::generateUniqueID();
     }
-    this -> reservationId = reservationId;
-    this -> flightId = flightId;
-    this -> passengerId = passengerId;
-    this -> seatNumber = seatNumber;
+    this -> reservationId = std::move(reservationId);
+    this -> flightId = std::move(flightId);
+    this -> passengerId = std::move(passengerId);
+    this -> seatNumber = std::move(seatNumber);
     this -> status = status;
-    this -> paymentId = paymentId;
+    this -> paymentId = std::move(paymentId);
 }
 /**
- * @brief Constructs a ReservationModel object from a JSON representation.
- *
- * This constructor validates the presence of required fields in the input JSON,
- * checks the format and existence of referenced IDs (reservation, flight, passenger, payment),
- * and sets the reservation status and seat assignment accordingly.
+ * @brief Reads the fields of a reservation from JSON, checking only their format.
  *
  * @param json The JSON object containing reservation data.
  *
- * @throws std::invalid_argument If any required field is missing, if IDs are invalid or do not exist,
- *         or if the reservation status is not recognized.
+ * @throws std::invalid_argument If any required field is missing, the reservation ID is
+ *         invalid, or the reservation status is not recognized.
  */
-ReservationModel::ReservationModel(const JSON& json) {
+void ReservationModel::readFields(const JSON& json) {
     std::vector<std::string> requiredTags = {"id", "flightId", "passengerId", "seatNumber", "status", "paymentId"};
     for ( const auto& tag : requiredTags ) {
         if (!json.contains(tag)) {
@@ -78,18 +89,8 @@ ReservationModel::ReservationModel(const JSON& json) {
     if (reservationId.substr(0, 4) != "RES-") {
         throw std::invalid_argument("Invalid ID for ReservationModel");
     }
-    
     flightId = json.at("flightId").get<std::string>();
-    auto flightsRepository = FlightRepository::getInstance();
-    if ( !flightsRepository -> findFlightById(flightId).has_value() ) {
-        throw std::invalid_argument("Flight ID does not exist.");
-    }
-
     passengerId = json.at("passengerId").get<std::string>();
-    auto userRepository = UserRepository::getInstance();
-    if ( !userRepository -> findUserById(passengerId).has_value() ) {
-        throw std::invalid_argument("Passenger ID does not exist.");
-    }
 
     std::string statusStr = json.at("status").get<std::string>();
     if (statusStr == "CONFIRMED") {
@@ -97,31 +98,84 @@ ReservationModel::ReservationModel(const JSON& json) {
     }
     else if (statusStr == "CANCELLED") {
         status = ReservationStatus::CANCELLED;
+    }
+    else if (statusStr == "BOARDED") {
+        status = ReservationStatus::BOARDED;
+    }
+    else if (statusStr == "NO_SHOW") {
+        status = ReservationStatus::NO_SHOW;
     } else {
         throw std::invalid_argument("Invalid reservation status provided.");
     }
-    
+
     seatNumber = json.at("seatNumber").get<std::string>();
-    auto flightOpt = flightsRepository -> findFlightById(flightId);
-    if (!flightOpt.has_value()) {
-        throw std::invalid_argument("Flight ID does not exist (flight may have been deleted).");
+    paymentId = json.at("paymentId").get<std::string>();
+    // Files written before version counters were introduced have no version.
+    version = json.value("version", std::uint64_t{0});
+}
+
+/**
+ * @brief Constructs a ReservationModel object from a JSON representation.
+ *
+ * This constructor validates the presence of required fields in the input JSON,
+ * checks the format and existence of referenced IDs (reservation, flight, passenger, payment),
+ * and sets the reservation status and seat assignment accordingly.
+ *
+ * @param json The JSON object containing reservation data.
+ *
+ * @throws std::invalid_argument If any required field is missing, if IDs are invalid or do not exist,
+ *         or if the reservation status is not recognized.
+ */
+ReservationModel::ReservationModel(const JSON& json) {
+    readFields(json);
+
+    auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
+    if ( !flightOpt.has_value() ) {
+        throw std::invalid_argument("Flight ID does not exist.");
+    }
+
+    auto userRepository = UserRepository::getInstance();
+    if ( !userRepository -> findUserById(passengerId).has_value() ) {
+        throw std::invalid_argument("Passenger ID does not exist.");
+    }
+
+    // Reservations sold beyond the physical seats may have no seat yet, and the seat of a
+    // no-show may have been given to someone else since.
+    if (!seatNumber.empty() && status != ReservationStatus::NO_SHOW) {
+        flightOpt.value() -> setSeatStatus(seatNumber, (status == ReservationStatus::CONFIRMED || status == ReservationStatus::BOARDED));
     }
-    auto flight = flightOpt.value();
-    flight -> setSeatStatus(seatNumber, (status == ReservationStatus::CONFIRMED));
 
-    paymentId = json.at("paymentId").get<std::string>();
     auto paymentRepository = PaymentRepository::getInstance();
     if ( !paymentRepository -> findPaymentById(paymentId).has_value() ) {
         throw std::invalid_argument("Payment ID does not exist.");
     }
 }
 
+/**
+ * @brief Reads a reservation back from the archive.
+ *
+ * Archived records are history: their flight, seat and payment were archived with them,
+ * and their passenger may have been deleted since. Only the format of the fields is
+ * checked, and no seat map is touched.
+ *
+ * @param json The JSON object containing reservation data.
+ * @return ReservationModel The archived reservation.
+ * @throws std::invalid_argument If any required field is missing, the reservation ID is
+ *         invalid, or the reservation status is not recognized.
+ */
+ReservationModel ReservationModel::fromArchive(const JSON& json) {
+    ReservationModel reservation;
+    reservation.readFields(json);
+    return reservation;
+}
+
 /**
  * @brief Serializes the ReservationModel object to a JSON representation.
  *
  * This method populates the provided JSON object with the reservation's details,
- * including reservation ID, flight ID, passenger ID, seat number, status, and payment ID.
- * The status field is serialized as a string, with possible values "CONFIRMED" or "CANCELLED".
+ * including reservation ID, flight ID, passenger ID, seat number, status, payment ID, and version counter.
+ * The status field is serialized as a string, with possible values "CONFIRMED", "CANCELLED",
+ * "BOARDED" or "NO_SHOW".
  *
  * @param json Reference to a JSON object to be populated with the reservation data.
  */
@@ -131,11 +185,27 @@ void ReservationModel::to_json(JSON& json) const {
         {"flightId", flightId},
         {"passengerId", passengerId},
         {"seatNumber", seatNumber},
-        {"status", ((status == ReservationStatus::CONFIRMED) ? "CONFIRMED" : "CANCELLED")},
-        {"paymentId", paymentId}
+        {"status", getStatusName(status)},
+        {"paymentId", paymentId},
+        {"version", version}
     };
 }
 
+/**
+ * @brief Returns the reservation status as displayed to users.
+ *
+ * @return std::string "Confirmed", "Cancelled", "Boarded" or "No-show".
+ */
+std::string ReservationModel::getStatusLabel() const {
+    switch (status) {
+        case ReservationStatus::CONFIRMED:  return "Confirmed";
+        case ReservationStatus::CANCELLED:  return "Cancelled";
+        case ReservationStatus::BOARDED:    return "Boarded";
+        case ReservationStatus::NO_SHOW:    return "No-show";
+    }
+    return "Unknown";
+}
+
 void ReservationModel::setSeatNumber(const std::string& seatNumber) {
     auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
     if (!flightOpt.has_value()) {
@@ -1,4 +1,6 @@
 #include "../include/ReservationModelBuilder.hpp"
+#include <stdexcept>
+#include <utility>
 
 /**
  * @brief Sets the flight ID for the reservation model.
@@ -8,8 +10,8 @@
  * @param flightId The unique identifier of the flight to associate with the reservation.
  * @return Reference to the current ReservationModelBuilder instance for method chaining.
  */
-ReservationModelBuilder& ReservationModelBuilder::setFlightId(const std::string& flightId) {
-    (this -> flightId) = flightId;
+ReservationModelBuilder& ReservationModelBuilder::setFlightId(std::string flightId) & {
+    (this -> flightId) = std::move(flightId);
     return *this;
 }
 /**
@@ -20,8 +22,8 @@ ReservationModelBuilder& ReservationModelBuilder::setFlightId(const std::string&
  * @param passengerId The unique identifier of the passenger.
  * @return Reference to the current ReservationModelBuilder instance for method chaining.
  */
-ReservationModelBuilder& ReservationModelBuilder::setPassengerId(const std::string& passengerId) {
-    (this -> passengerId) = passengerId;
+ReservationModelBuilder& ReservationModelBuilder::setPassengerId(std::string passengerId) & {
+    (this -> passengerId) = std::move(passengerId);
     return *this;
 }
 /**
@@ -32,8 +34,8 @@ ReservationModelBuilder& ReservationModelBuilder::setPassengerId(const std::stri
  * @param seatNumber The seat number to be set.
  * @return Reference to the current ReservationModelBuilder instance for method chaining.
  */
-ReservationModelBuilder& ReservationModelBuilder::setSeatNumber(const std::string& seatNumber) {
-    (this -> seatNumber) = seatNumber;
+ReservationModelBuilder& ReservationModelBuilder::setSeatNumber(std::string seatNumber) & {
+    (this -> seatNumber) = std::move(seatNumber);
     return *this;
 }
 /**
@@ -44,7 +46,7 @@ ReservationModelBuilder& ReservationModelBuilder::setSeatNumber(const std::strin
  * @param status The reservation status to set.
  * @return Reference to the current ReservationModelBuilder instance for method chaining.
  */
-ReservationModelBuilder& ReservationModelBuilder::setStatus(const ReservationModel::ReservationStatus& status) {
+ReservationModelBuilder& ReservationModelBuilder::setStatus(const ReservationModel::ReservationStatus& status) & {
     (this -> status) = status;
     return *this;
 }
@@ -56,30 +58,91 @@ ReservationModelBuilder& ReservationModelBuilder::setStatus(const ReservationMod
  * @param paymentId The payment ID to associate with the reservation.
  * @return Reference to the current ReservationModelBuilder instance for method chaining.
  */
-ReservationModelBuilder& ReservationModelBuilder::setPaymentId(const std::string& paymentId) {
-    (this -> paymentId) = paymentId;
+ReservationModelBuilder& ReservationModelBuilder::setPaymentId(std::string paymentId) & {
+    (this -> paymentId) = std::move(paymentId);
     return *this;
 }
 
+/**
+ * @brief Sets the flight ID on a temporary builder.
+ *
+ * Keeps a setter chain on a temporary an rvalue, so the build() ending it moves the
+ * collected values instead of copying them.
+ *
+ * @param flightId The flight ID to set.
+ * @return Rvalue reference to the current ReservationModelBuilder instance for method chaining.
+ */
+ReservationModelBuilder&& ReservationModelBuilder::setFlightId(std::string flightId) && {
+    return std::move(this -> setFlightId(std::move(flightId)));
+}
+/**
+ * @brief Sets the passenger ID on a temporary builder.
+ *
+ * @param passengerId The passenger ID to set.
+ * @return Rvalue reference to the current ReservationModelBuilder instance for method chaining.
+ */
+ReservationModelBuilder&& ReservationModelBuilder::setPassengerId(std::string passengerId) && {
+    return std::move(this -> setPassengerId(std::move(passengerId)));
+}
+/**
+ * @brief Sets the seat number on a temporary builder.
+ *
+ * @param seatNumber The seat number to set.
+ * @return Rvalue reference to the current ReservationModelBuilder instance for method chaining.
+ */
+ReservationModelBuilder&& ReservationModelBuilder::setSeatNumber(std::string seatNumber) && {
+    return std::move(this -> setSeatNumber(std::move(seatNumber)));
+}
+/**
+ * @brief Sets the reservation status on a temporary builder.
+ *
+ * @param status The reservation status to set.
+ * @return Rvalue reference to the current ReservationModelBuilder instance for method chaining.
+ */
+ReservationModelBuilder&& ReservationModelBuilder::setStatus(const ReservationModel::ReservationStatus& status) && {
+    return std::move(this -> setStatus(status));
+}
+/**
+ * @brief Sets the payment ID on a temporary builder.
+ *
+ * @param paymentId The payment ID to set.
+ * @return Rvalue reference to the current ReservationModelBuilder instance for method chaining.
+ */
+ReservationModelBuilder&& ReservationModelBuilder::setPaymentId(std::string paymentId) && {
+    return std::move(this -> setPaymentId(std::move(paymentId)));
+}
+
 /**
  * @brief Builds a ReservationModel instance with the provided parameters.
  *
- * This method constructs a ReservationModel object using the parameters
- * set in the ReservationModelBuilder. It validates that all required fields
- * (flightId, passengerId, seatNumber, paymentId) are not empty before
- * creating the ReservationModel. If any required parameter is missing,
+ * This method constructs a ReservationModel object from a copy of the parameters
+ * set in the ReservationModelBuilder, leaving the builder reusable. It validates that all required fields
+ * (flightId, passengerId, paymentId) are not empty before
+ * creating the ReservationModel. The seat number may be left empty for a reservation sold
+ * beyond the physical seats of the flight, which gets its seat once one is freed. If any required parameter is missing,
  * an std::invalid_argument exception is thrown.
  *
  * @return std::shared_ptr<ReservationModel> A shared pointer to the created ReservationModel instance.
  * @throws std::invalid_argument If any required reservation parameter is missing.
  */
-std::shared_ptr<ReservationModel> ReservationModelBuilder::build() const {
-    if (flightId.empty() || passengerId.empty() ||
-        seatNumber.empty() || paymentId.empty()) {
+std::shared_ptr<ReservationModel> ReservationModelBuilder::build() const & {
+    return ReservationModelBuilder(*this).build();
+}
+
+/**
+ * @brief Builds a ReservationModel by moving the builder's values into it.
+ *
+ * Used when the builder is an rvalue, e.g. a temporary at the end of a setter chain
+ * or std::move(builder). The builder is left in a valid but unspecified state.
+ *
+ * @return std::shared_ptr<ReservationModel> A shared pointer to the created ReservationModel instance.
+ * @throws std::invalid_argument If any required reservation parameter is missing.
+ */
+std::shared_ptr<ReservationModel> ReservationModelBuilder::build() && {
+    if (flightId.empty() || passengerId.empty() || paymentId.empty()) {
         throw std::invalid_argument("Missing required reservation parameters.");
     }
     return std::make_shared<ReservationModel> (
-        flightId, passengerId, seatNumber, status, paymentId
+        std::move(flightId), std::move(passengerId), std::move(seatNumber), status, std::move(paymentId)
     );
-
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "../include/SeatMapCodec.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+static constexpr char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static std::string encodeRuns(const std::vector<std::vector<bool>>& seatMap) {
+    std::string runs;
+    bool occupied = false;
+    std::size_t length = 0;
+    for (const auto& row : seatMap) {
+        for (bool seat : row) {
+            if (seat != occupied) {
+                runs += std::to_string(length);
+                runs += ',';
+                occupied = seat;
+                length = 0;
+            }
+            length++;
+        }
+    }
+    runs += std::to_string(length);
+    return runs;
+}
+
+static std::string encodeBits(const std::vector<std::vector<bool>>& seatMap) {
+    std::vector<std::uint8_t> bytes;
+    std::size_t seat = 0;
+    for (const auto& row : seatMap) {
+        for (bool occupied : row) {
+            if (seat % 8 == 0) {
+                bytes.push_back(0);
+            }
+            if (occupied) {
+                bytes.back() = static_cast<std::uint8_t>(bytes.back() | (0x80u >> (seat % 8)));
+            }
+            seat++;
+        }
+    }
+
+    std::string bits;
+    bits.reserve((bytes.size() + 2) / 3 * 4);
+    for (std::size_t index = 0; index < bytes.size(); index += 3) {
+        const std::size_t available = std::min<std::size_t>(3, bytes.size() - index);
+        std::uint32_t group = static_cast<std::uint32_t>(bytes[index]) << 16;
+        if (available > 1) {
+            group |= static_cast<std::uint32_t>(bytes[index + 1]) << 8;
+        }
+        if (available > 2) {
+            group |= bytes[index + 2];
+        }
+        for (std::size_t character = 0; character < 4; character++) {
+            bits += character <= available ? BASE64_ALPHABET[(group >> (18 - 6 * character)) & 0x3F] : '=';
+        }
+    }
+    return bits;
+}
+
+static std::vector<bool> decodeRuns(const std::string& runs, std::size_t seats) {
+    std::vector<bool> occupancy;
+    occupancy.reserve(seats);
+    bool occupied = false;
+    std::size_t position = 0;
+    while (true) {
+        std::size_t length = 0;
+        const std::size_t start = position;
+        for (; position < runs.size() && runs[position] >= '0' && runs[position] <= '9'; position++) {
+            const auto digit = static_cast<std::size_t>(runs[position] - '0');
+            if (digit > seats || length > (seats - digit) / 10) {
+                throw std::invalid_argument("Seat map has more seats than its size.");
+            }
+            length = length * 10 + digit;
+        }
+        if (position == start || length > seats - occupancy.size()) {
+            throw std::invalid_argument("Invalid seat map runs: " + runs);
+        }
+        occupancy.insert(occupancy.end(), length, occupied);
+        if (position == runs.size()) {
+            break;
+        }
+        if (runs[position] != ',') {
+            throw std::invalid_argument("Invalid seat map runs: " + runs);
+        }
+        position++;
+        occupied = !occupied;
+    }
+    if (occupancy.size() != seats) {
+        throw std::invalid_argument("Seat map has fewer seats than its size.");
+    }
+    return occupancy;
+}
+
+static std::vector<bool> decodeBits(const std::string& bits, std::size_t seats) {
+    const std::size_t byteCount = (seats + 7) / 8;
+    if (bits.size() != (byteCount + 2) / 3 * 4) {
+        throw std::invalid_argument("Seat map bits do not match its size.");
+    }
+
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(bits.size() / 4 * 3);
+    for (std::size_t index = 0; index < bits.size(); index += 4) {
+        std::uint32_t group = 0;
+        std::size_t padding = 0;
+        for (std::size_t character = 0; character < 4; character++) {
+            const char symbol = bits[index + character];
+            std::uint32_t value = 0;
+            if (symbol == '=' && index + 4 == bits.size() && character >= 2) {
+                padding++;
+            }
+            else if (padding > 0) {
+                throw std::invalid_argument("Invalid seat map bits: " + bits);
+            }
+            else if (symbol >= 'A' && symbol <= 'Z') { value = static_cast<std::uint32_t>(symbol - 'A'); }
+            else if (symbol >= 'a' && symbol <= 'z') { value = static_cast<std::uint32_t>(symbol - 'a' + 26); }
+            else if (symbol >= '0' && symbol <= '9') { value = static_cast<std::uint32_t>(symbol - '0' + 52); }
+            else if (symbol == '+') { value = 62; }
+            else if (symbol == '/') { value = 63; }
+            else {
+                throw std::invalid_argument("Invalid seat map bits: " + bits);
+            }
+            group = (group << 6) | value;
+        }
+        for (std::size_t byte = 0; byte < 3 - padding; byte++) {
+            bytes.push_back(static_cast<std::uint8_t>(group >> (16 - 8 * byte)));
+        }
+    }
+    if (bytes.size() != byteCount) {
+        throw std::invalid_argument("Seat map bits do not match its size.");
+    }
+
+    std::vector<bool> occupancy(seats);
+    for (std::size_t seat = 0; seat < seats; seat++) {
+        occupancy[seat] = (bytes[seat / 8] & (0x80u >> (seat % 8))) != 0;
+    }
+    return occupancy;
+}
+
+/**
+ * @brief Encodes a seat map in its compact form.
+ *
+ * @param seatMap The seat map; every row must have the size of the first one.
+ * @return JSON An object with the rows, the seats per row, and either "runs" or "bits",
+ *         whichever is shorter.
+ */
+JSON SeatMapCodec::encode(const std::vector<std::vector<bool>>& seatMap) {
+    JSON json{
+        {"rows", seatMap.size()},
+        {"seatsPerRow", seatMap.empty() ? 0 : seatMap.front().size()}
+    };
+    std::string runs = encodeRuns(seatMap);
+    std::string bits = encodeBits(seatMap);
+    if (runs.size() <= bits.size()) {
+        json["runs"] = std::move(runs);
+    }
+    else {
+        json["bits"] = std::move(bits);
+    }
+    return json;
+}
+
+/**
+ * @brief Decodes a seat map from its compact form or from the legacy nested array of booleans.
+ *
+ * @param json The encoded seat map.
+ * @return std::vector<std::vector<bool>> The seat map; true marks an occupied seat.
+ * @throws std::invalid_argument If the seat map is malformed or its seats do not match its size.
+ */
+std::vector<std::vector<bool>> SeatMapCodec::decode(const JSON& json) {
+    if (json.is_array()) {
+        return json.get<std::vector<std::vector<bool>>>();
+    }
+    if (!json.is_object() || !json.contains("rows") || !json.contains("seatsPerRow")
+        || !json.at("rows").is_number_unsigned() || !json.at("seatsPerRow").is_number_unsigned()) {
+        throw std::invalid_argument("Invalid seat map format.");
+    }
+    const auto rows = json.at("rows").get<std::size_t>();
+    const auto seatsPerRow = json.at("seatsPerRow").get<std::size_t>();
+    if (seatsPerRow != 0 && rows > std::numeric_limits<std::size_t>::max() / seatsPerRow) {
+        throw std::invalid_argument("Invalid seat map size.");
+    }
+    const std::size_t seats = rows * seatsPerRow;
+
+    std::vector<bool> occupancy;
+    if (json.contains("runs")) {
+        occupancy = decodeRuns(json.at("runs").get<std::string>(), seats);
+    }
+    else if (json.contains("bits")) {
+        occupancy = decodeBits(json.at("bits").get<std::string>(), seats);
+    }
+    else {
+        throw std::invalid_argument("Seat map has neither runs nor bits.");
+    }
+
+    std::vector<std::vector<bool>> seatMap(rows, std::vector<bool>(seatsPerRow));
+    for (std::size_t seat = 0; seat < seats; seat++) {
+        seatMap[seat / seatsPerRow][seat % seatsPerRow] = occupancy[seat];
+    }
+    return seatMap;
+}
@@ -0,0 +1,102 @@
+#include "../include/WaitlistEntryModel.hpp"
+#include "../../Utils/include/IDGenerator.hpp"
+#include "../../Repositories/include/WaitlistRepository.hpp"
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Constructs a waitlist entry requested now.
+ *
+ * A unique entry ID is generated and the request time is set to the current time. The
+ * string and JSON arguments are taken by value and moved into the entry.
+ *
+ * @param flightId The unique identifier of the fully booked flight.
+ * @param passengerId The unique identifier of the waiting passenger.
+ * @param loyaltyPoints The passenger's loyalty points at the time of the request.
+ * @param paymentMethod The payment method charged when a seat is assigned.
+ * @param paymentDetails The details of the payment method.
+ * @param sequence The request order, assigned by the WaitlistRepository.
+ *
+ * @throws std::invalid_argument If the flight ID or passenger ID is empty.
+ */
+WaitlistEntryModel::WaitlistEntryModel(std::string flightId, std::string passengerId, float loyaltyPoints,
+    std::string paymentMethod, JSON paymentDetails, std::uint64_t sequence) {
+    if (flightId.empty() || passengerId.empty()) {
+        throw std::invalid_argument("Invalid waitlist entry details provided.");
+    }
+    auto waitlistRepository = WaitlistRepository::getInstance();
+    std::string entryId = "WL-" + IDGenerator::generateUniqueID();
+    while ( waitlistRepository -> findEntryById(entryId).has_value() ) {
+        entryId = "WL-" + IDGenerator::generateUniqueID();
+    }
+    this -> entryId = std::move(entryId);
+    this -> flightId = std::move(flightId);
+    this -> passengerId = std::move(passengerId);
+    this -> loyaltyPoints = loyaltyPoints;
+    this -> requestedAt = DateTime::now();
+    this -> sequence = sequence;
+    this -> paymentMethod = std::move(paymentMethod);
+    this -> paymentDetails = std::move(paymentDetails);
+}
+
+/**
+ * @brief Constructs a waitlist entry from a JSON representation.
+ *
+ * @param json The JSON object containing the entry data.
+ *
+ * @throws std::invalid_argument If a required field is missing or the entry ID is invalid.
+ */
+WaitlistEntryModel::WaitlistEntryModel(const JSON& json) {
+    std::vector<std::string> requiredTags = {"id", "flightId", "passengerId", "loyaltyPoints", "requestedAt", "sequence", "paymentMethod"};
+    for ( const auto& tag : requiredTags ) {
+        if (!json.contains(tag)) {
+            throw std::invalid_argument("Invalid JSON for WaitlistEntryModel: missing tag '" + tag + "'.");
+        }
+    }
+
+    entryId = json.at("id").get<std::string>();
+    if (entryId.substr(0, 3) != "WL-") {
+        throw std::invalid_argument("Invalid ID for WaitlistEntryModel");
+    }
+    flightId = json.at("flightId").get<std::string>();
+    passengerId = json.at("passengerId").get<std::string>();
+    loyaltyPoints = json.at("loyaltyPoints").get<float>();
+    requestedAt = DateTime(json.at("requestedAt").get<std::string>());
+    sequence = json.at("sequence").get<std::uint64_t>();
+    paymentMethod = json.at("paymentMethod").get<std::string>();
+    paymentDetails = json.value("paymentDetails", JSON::object());
+}
+
+/**
+ * @brief Serializes the waitlist entry to a JSON representation.
+ *
+ * @param json Reference to a JSON object to be populated with the entry data.
+ */
+void WaitlistEntryModel::to_json(JSON& json) const {
+    json = JSON {
+        {"id", entryId},
+        {"flightId", flightId},
+        {"passengerId", passengerId},
+        {"loyaltyPoints", loyaltyPoints},
+        {"requestedAt", requestedAt.toString()},
+        {"sequence", sequence},
+        {"paymentMethod", paymentMethod},
+        {"paymentDetails", paymentDetails}
+    };
+}
+
+/**
+ * @brief Returns whether this entry is to be served before another one.
+ *
+ * More loyalty points come first; between equal loyalty points, the earlier request wins.
+ *
+ * @param other The entry to compare with.
+ * @return true if this entry has the higher priority.
+ */
+bool WaitlistEntryModel::hasPriorityOver(const WaitlistEntryModel& other) const {
+    if (loyaltyPoints != other.loyaltyPoints) {
+        return loyaltyPoints > other.loyaltyPoints;
+    }
+    return sequence < other.sequence;
+}
@@ -1,8 +1,10 @@
 #pragma once
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <memory>
 #include "../../Model/include/AircraftModel.hpp"
+#include "RepositoryView.hpp"
 
 /**
  * @class AircraftRepository
@@ -15,7 +17,9 @@
  * Usage:
  *   - Use getInstance() to obtain the singleton instance.
  *   - Use addAircraft(), updateAircraft(), deleteAircraft() to modify the repository.
+ *   - Use modifyAircraft() to change a stored aircraft in place without copying it.
  *   - Use findAircraftById() to retrieve aircraft models by their unique ID.
+ *   - Use viewAircrafts() to iterate every aircraft without copying the collection.
  *
  * Note:
  *   - Copy and move operations are disabled to preserve singleton integrity.
@@ -33,8 +37,10 @@ class AircraftRepository {
         static std::shared_ptr<AircraftRepository> getInstance();
         std::optional<std::shared_ptr<AircraftModel>> findAircraftById(const std::string& aircraftId) const;
         std::vector<std::shared_ptr<AircraftModel>> getAllAircrafts() const;
+        inline RepositoryView<AircraftModel> viewAircrafts() const     { return RepositoryView<AircraftModel>(aircrafts); }
         bool addAircraft(const AircraftModel& newAircraft);
         bool updateAircraft(const AircraftModel& aircraft);
+        bool modifyAircraft(const std::string& aircraftId, const std::function<bool(AircraftModel&)>& mutate);
         bool deleteAircraft(const std::string& aircraftId);
 
         ~AircraftRepository();
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../../Model/include/AirportModel.hpp"
+
+/**
+ * @class AirportRepository
+ * @brief Singleton holding the airport master table and its autocomplete index.
+ *
+ * The airports are loaded once, at first use, and never change afterwards: the
+ * repository has no mutators and does not write the table back, so every lookup reads
+ * immutable data and needs no locking.
+ *
+ * Each airport is indexed under its code, its city, its name and every word of the city
+ * and the name, lower-cased, in one sorted array of (term, code) pairs. Terms sharing a
+ * prefix are contiguous in it, so findAirportsByPrefix() binary-searches the prefix and
+ * reads the matches that follow. findAirportsByApproximateName() tolerates typos: it
+ * compares the query with the beginning of the terms, allowing one edit for queries of
+ * three or four characters and two for longer ones. It walks the sorted terms like a
+ * trie, sharing the work on a common prefix and skipping every term under a prefix whose
+ * edits already exceed the allowance.
+ *
+ * Copy and move operations are deleted to enforce singleton behavior.
+ */
+class AirportRepository {
+    std::unordered_map<std::string, std::shared_ptr<AirportModel>> airports;
+    std::vector<std::pair<std::string, std::string>> searchTerms;
+
+    AirportRepository();
+    AirportRepository(const AirportRepository&) = delete;
+    AirportRepository& operator=(const AirportRepository&) = delete;
+    AirportRepository(AirportRepository&&) = delete;
+    AirportRepository& operator=(AirportRepository&&) = delete;
+
+    public:
+        static std::shared_ptr<AirportRepository> getInstance();
+
+        std::optional<std::shared_ptr<const AirportModel>> findAirportByCode(const std::string& code) const;
+        std::vector<std::shared_ptr<const AirportModel>> findAirportsByPrefix(const std::string& prefix, std::size_t limit) const;
+        std::vector<std::shared_ptr<const AirportModel>> findAirportsByApproximateName(const std::string& query, std::size_t limit) const;
+
+        ~AirportRepository() = default;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../../Model/include/FlightModel.hpp"
+#include "../../Model/include/PaymentModel.hpp"
+#include "../../Model/include/ReservationModel.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ArchiveRepository
+ * @brief Singleton read-only cold store of departed flights, their reservations and their payments.
+ *
+ * Every archived flight is one record of the archive data file: a JSON object holding the
+ * flight, its reservations and their payments, block-compressed by BlockCodec on its own.
+ * Records are only ever appended. The archive index file maps every flight ID to the
+ * offset of its record, and every reservation, payment and passenger ID to the flights
+ * holding them, so a lookup reads and decompresses the one record it needs. Only the
+ * index is kept in memory; records are read from disk on demand and never cached. The
+ * index also keeps the route of every flight and how many of its passengers boarded or
+ * did not show up, so the no-show statistics survive the reservations being archived.
+ *
+ * The index is loaded the first time the archive is used, so a process that never looks
+ * into it does not pay for it. It is only appended to, after the records it lists are
+ * written, so a crash leaves at most unreferenced bytes at the end of the data file and
+ * an index line cut short, which is skipped.
+ *
+ * Copy and move operations are deleted to enforce singleton behavior.
+ *
+ * Public Methods:
+ * - getInstance(): Returns the singleton instance of the repository.
+ * - containsFlight(): Checks whether a flight is archived.
+ * - findFlightRecord(): Reads the archived record of a flight.
+ * - findFlightById(): Reads an archived flight.
+ * - findReservationById(): Reads an archived reservation.
+ * - findReservationsByPassenger(): Reads all archived reservations of a passenger.
+ * - findPaymentById(): Reads an archived payment.
+ * - getFlightOutcomes(): Returns the boarding outcomes of the archived flights.
+ * - archiveFlights(): Appends the records of newly archived flights.
+ */
+class ArchiveRepository {
+    public:
+        struct FlightRecord {
+            std::shared_ptr<FlightModel> flight;
+            std::vector<std::shared_ptr<ReservationModel>> reservations;
+            std::vector<std::shared_ptr<PaymentModel>> payments;
+        };
+        struct FlightOutcomes {
+            std::string origin;
+            std::string destination;
+            std::uint64_t boarded = 0;
+            std::uint64_t noShows = 0;
+        };
+
+    private:
+        std::unordered_map<std::string, std::uint64_t> recordOffsets;
+        std::unordered_map<std::string, std::string> reservationFlights;
+        std::unordered_map<std::string, std::string> paymentFlights;
+        std::unordered_map<std::string, std::vector<std::string>> passengerFlights;
+        std::unordered_map<std::string, FlightOutcomes> flightOutcomes;
+        mutable std::shared_mutex mutex;
+
+        ArchiveRepository();
+        ArchiveRepository(const ArchiveRepository&) = delete;
+        ArchiveRepository& operator=(const ArchiveRepository&) = delete;
+        ArchiveRepository(ArchiveRepository&&) = delete;
+        ArchiveRepository& operator=(ArchiveRepository&&) = delete;
+
+        FlightRecord readRecord(std::uint64_t offset) const;
+        std::optional<FlightRecord> findRecordOf(const std::unordered_map<std::string, std::string>& flightIndex, const std::string& id) const;
+        void indexPassengerFlight(const std::string& passengerId, const std::string& flightId);
+        void indexRecord(const FlightRecord& record, std::uint64_t offset);
+
+    public:
+        static std::shared_ptr<ArchiveRepository> getInstance();
+        bool containsFlight(const std::string& flightId) const;
+        std::optional<FlightRecord> findFlightRecord(const std::string& flightId) const;
+        std::optional<std::shared_ptr<FlightModel>> findFlightById(const std::string& flightId) const;
+        std::optional<std::shared_ptr<ReservationModel>> findReservationById(const std::string& reservationId) const;
+        std::vector<std::shared_ptr<ReservationModel>> findReservationsByPassenger(const std::string& passengerId) const;
+        std::optional<std::shared_ptr<PaymentModel>> findPaymentById(const std::string& paymentId) const;
+        std::unordered_map<std::string, FlightOutcomes> getFlightOutcomes() const;
+        std::size_t archiveFlights(const std::vector<FlightRecord>& records);
+
+        ~ArchiveRepository() = default;
+};
@@ -2,6 +2,8 @@
 #include <string>
 #include "../../Third_Party/json.hpp"
 #include "../../Model/include/CrewMemberModel.hpp"
+#include "RepositoryView.hpp"
+#include "PrefixIndex.hpp"
 
 using JSON = nlohmann::json;
 
@@ -10,11 +12,14 @@ using JSON = nlohmann::json;
  * @brief Singleton repository for managing CrewMemberModel instances.
  *
  * Provides methods to add, update, delete, and query crew members by ID or role.
- * Utilizes an internal unordered_map for efficient storage and retrieval.
+ * Utilizes an internal unordered_map for efficient storage and retrieval;
+ * viewCrewMembers() iterates it without copying the collection. A prefix index over crew
+ * names lets findCrewMembersByNamePrefix() return the first matches without a full scan.
  * Copy and move operations are disabled to enforce singleton usage.
  */
 class CrewMemberRepository {
     std::unordered_map<std::string, std::shared_ptr<CrewMemberModel>> crewMembers;
+    PrefixIndex namePrefixes;
 
     CrewMemberRepository();
     CrewMemberRepository(const CrewMemberRepository&) = delete;
@@ -26,7 +31,9 @@ class CrewMemberRepository {
         static std::shared_ptr<CrewMemberRepository> getInstance();
         std::optional<std::shared_ptr<CrewMemberModel>> findCrewMemberById(const std::string& crewId) const;
         std::vector<std::shared_ptr<CrewMemberModel>> findCrewMembersByRole(const CrewMemberModel::CrewType& role) const;
+        std::vector<std::shared_ptr<CrewMemberModel>> findCrewMembersByNamePrefix(const std::string& prefix, std::size_t limit) const;
         std::vector<std::shared_ptr<CrewMemberModel>> getAllCrewMembers() const;
+        inline RepositoryView<CrewMemberModel> viewCrewMembers() const { return RepositoryView<CrewMemberModel>(crewMembers); }
         bool addCrewMember(const CrewMemberModel& newCrewMember);
         bool updateCrewMember(const CrewMemberModel& crewMember);
         bool deleteCrewMember(const std::string& crewId);
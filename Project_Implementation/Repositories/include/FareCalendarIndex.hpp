@@ -0,0 +1,246 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "../../Model/include/FareRules.hpp"
+#include "../../Model/include/FlightModel.hpp"
+#include "../../Utils/include/DateTime.hpp"
+
+/**
+ * @struct FareCalendarDay
+ * @brief Availability of a route on one day: its flights, their free seats and the lowest fare.
+ *
+ * lowestFare is empty when no flight of the day has a free seat.
+ */
+struct FareCalendarDay {
+    DateTime date;
+    std::size_t flights = 0;
+    std::size_t freeSeats = 0;
+    std::optional<float> lowestFare;
+};
+
+/**
+ * @struct AvailabilityFilter
+ * @brief Seats a flight must have free to be listed by a search.
+ *
+ * A flight passes if it has at least minFreeSeats free seats, counted in the given cabin
+ * only if there is one. The default filter lets every flight pass, sold out or not.
+ */
+struct AvailabilityFilter {
+    std::size_t minFreeSeats = 0;
+    std::optional<FareRules::Cabin> cabin;
+};
+
+/**
+ * @class FareCalendarIndex
+ * @brief Secondary index of the free seats and lowest fare of every route on every day.
+ *
+ * Days are kept in a map ordered by (origin, destination, date), so the days of a route
+ * within a window are contiguous and a calendar query reads them in one pass from a
+ * single seek. Each day holds its flights, their number of free seats and a multiset of
+ * their lowest free-seat fares, whose first element is the day's lowest fare.
+ *
+ * Every flight remembers the day and figures it contributed, including its free seats
+ * per cabin, so committing a changed flight only subtracts its old contribution and adds
+ * the new one; nothing else of the day or the route is recomputed. The same counters
+ * answer availability filters, so searches skip sold-out flights without reading their
+ * seat maps. Fares are FareRules base fares, before loyalty discounts.
+ *
+ * All methods are thread-safe.
+ */
+class FareCalendarIndex {
+    using DayKey = std::tuple<std::string, std::string, DateTime>;
+
+    struct Contribution {
+        DayKey day;
+        std::size_t freeSeats = 0;
+        std::array<std::size_t, FareRules::CABIN_COUNT> freeSeatsByCabin{};
+        std::optional<float> lowestFare;
+    };
+
+    struct RouteDay {
+        std::set<std::string> flightIds;
+        std::size_t freeSeats = 0;
+        std::multiset<float> lowestFares;
+    };
+
+    std::map<DayKey, RouteDay> days;
+    std::unordered_map<std::string, Contribution> contributions;
+    mutable std::shared_mutex mutex;
+
+    static DateTime startOfDay(const DateTime& time) {
+        return DateTime(time.year, time.month, time.day);
+    }
+
+    static bool passes(const Contribution& contribution, const AvailabilityFilter& filter) {
+        if (!filter.cabin.has_value()) {
+            return contribution.freeSeats >= filter.minFreeSeats;
+        }
+        return contribution.freeSeatsByCabin[static_cast<std::size_t>(filter.cabin.value())] >= filter.minFreeSeats;
+    }
+
+    void subtract(const std::string& flightId, const Contribution& contribution) {
+        auto it = days.find(contribution.day);
+        if (it == days.end()) {
+            return;
+        }
+        RouteDay& day = it -> second;
+        day.flightIds.erase(flightId);
+        day.freeSeats -= contribution.freeSeats;
+        if (contribution.lowestFare.has_value()) {
+            day.lowestFares.erase(day.lowestFares.find(contribution.lowestFare.value()));
+        }
+        if (day.flightIds.empty()) {
+            days.erase(it);
+        }
+    }
+
+    void add(const std::string& flightId, const Contribution& contribution) {
+        RouteDay& day = days[contribution.day];
+        day.flightIds.insert(flightId);
+        day.freeSeats += contribution.freeSeats;
+        if (contribution.lowestFare.has_value()) {
+            day.lowestFares.insert(contribution.lowestFare.value());
+        }
+    }
+
+    public:
+        FareCalendarIndex() = default;
+        FareCalendarIndex(const FareCalendarIndex&) = delete;
+        FareCalendarIndex& operator=(const FareCalendarIndex&) = delete;
+
+        /**
+         * @brief Indexes the current seats of a flight, replacing what it contributed before.
+         */
+        void upsert(const FlightModel& flight) {
+            Contribution contribution;
+            contribution.day = {flight.getOrigin(), flight.getDestination(), startOfDay(flight.getDepartureTime())};
+            const auto& seatMap = flight.getSeatMap();
+            for (std::size_t row = 0; row < seatMap.size(); row++) {
+                for (std::size_t column = 0; column < seatMap[row].size(); column++) {
+                    if (seatMap[row][column]) {
+                        continue;
+                    }
+                    contribution.freeSeats++;
+                    contribution.freeSeatsByCabin[static_cast<std::size_t>(FareRules::getCabin(row))]++;
+                    float fare = FareRules::getBaseFare(row, column, seatMap[row].size());
+                    if (!contribution.lowestFare.has_value() || fare < contribution.lowestFare.value()) {
+                        contribution.lowestFare = fare;
+                    }
+                }
+            }
+
+            std::unique_lock lock(mutex);
+            auto it = contributions.find(flight.getFlightId());
+            if (it != contributions.end()) {
+                subtract(flight.getFlightId(), it -> second);
+                it -> second = contribution;
+            }
+            else {
+                contributions.emplace(flight.getFlightId(), contribution);
+            }
+            add(flight.getFlightId(), contribution);
+        }
+
+        /**
+         * @brief Removes a flight from the index; does nothing if it is not indexed.
+         */
+        void erase(const std::string& flightId) {
+            std::unique_lock lock(mutex);
+            auto it = contributions.find(flightId);
+            if (it == contributions.end()) {
+                return;
+            }
+            subtract(flightId, it -> second);
+            contributions.erase(it);
+        }
+
+        /**
+         * @brief Returns the availability of a route on consecutive days.
+         *
+         * @param origin The origin of the route.
+         * @param destination The destination of the route.
+         * @param firstDay The first day of the window; its time of day is ignored.
+         * @param numberOfDays The number of days of the window.
+         * @return std::vector<FareCalendarDay> One entry per day of the window, in order,
+         *         including the days without flights.
+         */
+        std::vector<FareCalendarDay> getCalendar(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& firstDay,
+            std::size_t numberOfDays
+        ) const {
+            std::vector<FareCalendarDay> calendar(numberOfDays);
+            DateTime date = startOfDay(firstDay);
+            for (auto& day : calendar) {
+                day.date = date;
+                date = date.addDays(1);
+            }
+            if (calendar.empty()) {
+                return calendar;
+            }
+
+            std::shared_lock lock(mutex);
+            std::size_t index = 0;
+            for (auto it = days.lower_bound({origin, destination, calendar.front().date}); it != days.end(); ++it) {
+                const auto& [dayOrigin, dayDestination, dayDate] = it -> first;
+                if (dayOrigin != origin || dayDestination != destination) {
+                    break;
+                }
+                while (index < calendar.size() && calendar[index].date < dayDate) {
+                    index++;
+                }
+                if (index == calendar.size()) {
+                    break;
+                }
+                const RouteDay& day = it -> second;
+                calendar[index].flights = day.flightIds.size();
+                calendar[index].freeSeats = day.freeSeats;
+                if (!day.lowestFares.empty()) {
+                    calendar[index].lowestFare = *day.lowestFares.begin();
+                }
+            }
+            return calendar;
+        }
+
+        /**
+         * @brief Returns the flights of a route departing on a day that pass an availability filter.
+         *
+         * Only the route's day and the counters of its flights are read.
+         *
+         * @param origin The origin of the route.
+         * @param destination The destination of the route.
+         * @param departureDate The departure day; its time of day is ignored.
+         * @param filter The seats the flights must have free.
+         * @return std::vector<std::string> The IDs of the passing flights, in ID order.
+         */
+        std::vector<std::string> findFlights(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& departureDate,
+            const AvailabilityFilter& filter
+        ) const {
+            std::vector<std::string> flightIds;
+            std::shared_lock lock(mutex);
+            auto it = days.find({origin, destination, startOfDay(departureDate)});
+            if (it == days.end()) {
+                return flightIds;
+            }
+            for (const auto& flightId : it -> second.flightIds) {
+                if (passes(contributions.at(flightId), filter)) {
+                    flightIds.push_back(flightId);
+                }
+            }
+            return flightIds;
+        }
+};
@@ -1,10 +1,16 @@
 #pragma once
 
 #include "../../Model/include/FlightModel.hpp"
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include "../../Utils/include/ShardExecutor.hpp"
+#include "VersionedTable.hpp"
+#include "OrderedIndex.hpp"
+#include "FareCalendarIndex.hpp"
 
 
 /**
@@ -15,19 +21,54 @@
  * flight information using an internal unordered map. It follows the singleton pattern
  * to ensure a single instance throughout the application.
  *
+ * Flights are partitioned by a hash of their route (origin and destination) into
+ * RuntimeOptions::getShardCount() shards. With a single shard (the default) every
+ * operation runs on the calling thread. With several shards each shard is owned by one
+ * ShardExecutor worker thread: lookups by flight ID are routed through a flight-to-shard
+ * directory, route searches go to the single shard owning the route, and listing all
+ * flights scatters to every shard and gathers the results.
+ *
+ * Every committed change to a flight is also published to a VersionedTable, so reports
+ * can scan a consistent point-in-time snapshot of all flights without locking out writers.
+ * The same commits keep an ordered index of flights by departure time, which serves sorted
+ * listings one page at a time, and one by origin and departure time, which serves the
+ * flights leaving an airport from a given time on. A fare calendar index keeps the free
+ * seats and lowest fare of every route on every day, updated by each commit with the
+ * difference the committed flight makes; its per-flight free-seat counters let route
+ * searches skip flights without enough free seats.
+ *
  * Copy and move operations are deleted to maintain singleton integrity.
  *
  * Public Methods:
  * - getInstance(): Returns the singleton instance of FlightRepository.
  * - findFlightById(const std::string&): Searches for a flight by its ID.
- * - addFlight(const FlightModel&): Adds a new flight to the repository.
+ * - addFlight(const FlightModel&): Adds a copy of a new flight to the repository.
+ * - emplaceFlight(std::shared_ptr<FlightModel>): Adds a newly built flight without copying it.
  * - updateFlight(const FlightModel&): Updates an existing flight's information.
+ * - compareAndSetFlight(const FlightModel&, std::uint64_t): Updates a flight only if it is still at the expected version.
+ * - modifyFlight(const std::string&, mutate): Changes a stored flight in place without copying it.
  * - deleteFlight(const std::string&): Removes a flight from the repository by its ID.
+ * - runOnFlightShard(const std::string&, task): Runs a task on the thread owning a flight.
+ * - isRunningOnShard(): Tells whether the caller is inside a shard task.
+ * - takeSnapshot(): Returns a lock-free, point-in-time snapshot of all flights.
+ * - commitVersion(const FlightModel&): Publishes a flight changed in place to the snapshots.
+ * - getFlightsByDeparture(after, limit): Returns one page of flights sorted by departure time.
+ * - getFlightsDepartingFrom(origin, earliest): Returns the flights leaving an airport from a given time on.
+ * - getFareCalendar(origin, destination, firstDay, numberOfDays): Returns the free seats and lowest fare of a route per day.
  *
  * Destructor ensures saving the data in the database before destruction.
  */
 class FlightRepository {
-    std::unordered_map<std::string, std::shared_ptr<FlightModel>> flights;
+    using FlightMap = std::unordered_map<std::string, std::shared_ptr<FlightModel>>;
+
+    std::vector<FlightMap> shards;
+    std::unordered_map<std::string, std::size_t> flightShards;
+    mutable std::shared_mutex directoryMutex;
+    std::unique_ptr<ShardExecutor> executor;
+    VersionedTable<FlightModel> versions;
+    OrderedIndex<DateTime> departures;
+    OrderedIndex<std::pair<std::string, DateTime>> originDepartures;
+    FareCalendarIndex fareCalendar;
 
     FlightRepository();
     FlightRepository(const FlightRepository&) = delete;
@@ -36,19 +77,51 @@ class FlightRepository {
     FlightRepository& operator=(FlightRepository&&) = delete;
 
 
+    void setFlightShard(const std::string& flightId, std::size_t shard);
+    void eraseFlightShard(const std::string& flightId);
+    void publishVersion(const FlightModel& flight);
+    void unpublishVersion(const std::string& flightId);
+
     public:
+        using Snapshot = VersionedTable<FlightModel>::Snapshot;
+        using DepartureCursor = OrderedIndex<DateTime>::Cursor;
+        using FlightPage = ResultPage<std::shared_ptr<const FlightModel>, DepartureCursor>;
+
         static std::shared_ptr<FlightRepository> getInstance();
 
+        inline std::size_t getShardCount() const            { return shards.size(); }
+        std::size_t getShardForRoute(const std::string& origin, const std::string& destination) const;
+        std::optional<std::size_t> findShardOfFlight(const std::string& flightId) const;
+        void runOnShard(std::size_t shard, const std::function<void()>& task) const;
+        void runOnAllShards(const std::function<void(std::size_t)>& task) const;
+        void runOnFlightShard(const std::string& flightId, const std::function<void()>& task) const;
+        bool isRunningOnShard() const;
+
         std::optional<std::shared_ptr<FlightModel>> findFlightById(const std::string& flightId) const;
         std::vector<std::shared_ptr<FlightModel>> getAllFlights() const;
         std::vector<std::shared_ptr<FlightModel>> getFlightsByCriteria (
             const std::string& origin,
             const std::string& destination,
-            const DateTime& departureDate
+            const DateTime& departureDate,
+            const AvailabilityFilter& filter = {}
         );
         bool addFlight(const FlightModel& newFlight);
+        bool emplaceFlight(std::shared_ptr<FlightModel> newFlight);
         bool updateFlight(const FlightModel& flight);
+        bool compareAndSetFlight(const FlightModel& flight, std::uint64_t expectedVersion);
+        bool modifyFlight(const std::string& flightId, const std::function<bool(FlightModel&)>& mutate);
         bool deleteFlight(const std::string& flightId);
 
+        inline Snapshot takeSnapshot() const                { return versions.takeSnapshot(); }
+        void commitVersion(const FlightModel& flight);
+        FlightPage getFlightsByDeparture(const std::optional<DepartureCursor>& after, std::size_t limit) const;
+        std::vector<std::shared_ptr<const FlightModel>> getFlightsDepartingFrom(const std::string& origin, const DateTime& earliest) const;
+        std::vector<FareCalendarDay> getFareCalendar(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& firstDay,
+            std::size_t numberOfDays
+        ) const;
+
         ~FlightRepository();
 };
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct FlightSnapshotLayout
+ * @brief Binary layout of the shared memory segment holding published flight snapshots.
+ *
+ * The segment starts with a Header followed by two equally sized slots. The publisher
+ * always writes the slot that is not currently active and then swaps the active slot
+ * index, so readers never see a half-written snapshot through the active slot. Each slot
+ * carries its own sequence number (odd while being written) which readers check before
+ * and after copying data out, retrying if the slot was reused underneath them.
+ *
+ * Slot contents:
+ *   SlotHeader | FlightRecord[MAX_FLIGHTS] | uint32 idOrder[MAX_FLIGHTS] | seat bits
+ *
+ * Flight records are sorted by (origin, destination, departure time) so route searches
+ * are a binary search; idOrder holds record indices sorted by flight ID for seat map lookups.
+ * Seat bits are stored row-major, one bit per seat, 1 meaning occupied.
+ *
+ * @note Every structure is trivially copyable and only uses fixed-width types so that
+ *       the layout is identical in every process mapping the segment.
+ */
+struct FlightSnapshotLayout {
+    static constexpr std::uint32_t MAGIC = 0x464C534E;         // "FLSN"
+    static constexpr std::uint32_t LAYOUT_VERSION = 1;
+    static constexpr std::size_t MAX_FLIGHTS = 4096;
+    static constexpr std::size_t MAX_SEAT_BYTES = MAX_FLIGHTS * 128;
+    static constexpr std::size_t ID_LENGTH = 32;
+    static constexpr std::size_t LOCATION_LENGTH = 64;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Snapshot epochs require lock-free 64-bit atomics");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Snapshot slot index requires lock-free 32-bit atomics");
+
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t layoutVersion;
+        std::uint64_t slotBytes;
+        std::atomic<std::uint64_t> publishedEpoch;
+        std::atomic<std::uint32_t> activeSlot;
+    };
+
+    struct SlotHeader {
+        std::atomic<std::uint64_t> sequence;
+        std::uint64_t epoch;
+        std::uint32_t flightCount;
+        std::uint32_t reserved;
+        std::uint64_t seatBytesUsed;
+    };
+
+    struct FlightRecord {
+        char flightId[ID_LENGTH];
+        char origin[LOCATION_LENGTH];
+        char destination[LOCATION_LENGTH];
+        std::int32_t departure[5];
+        std::int32_t arrival[5];
+        std::uint32_t seatOffset;
+        std::uint16_t rows;
+        std::uint16_t seatsPerRow;
+    };
+
+    static constexpr std::size_t RECORDS_OFFSET = sizeof(SlotHeader);
+    static constexpr std::size_t ID_ORDER_OFFSET = RECORDS_OFFSET + MAX_FLIGHTS * sizeof(FlightRecord);
+    static constexpr std::size_t SEATS_OFFSET = ID_ORDER_OFFSET + MAX_FLIGHTS * sizeof(std::uint32_t);
+    static constexpr std::size_t SLOT_BYTES = SEATS_OFFSET + MAX_SEAT_BYTES;
+    static constexpr std::size_t SLOTS_OFFSET = (sizeof(Header) + 63) / 64 * 64;
+    static constexpr std::size_t SEGMENT_BYTES = SLOTS_OFFSET + 2 * SLOT_BYTES;
+
+    static inline std::size_t slotOffset(std::uint32_t slot)     { return SLOTS_OFFSET + slot * SLOT_BYTES; }
+};
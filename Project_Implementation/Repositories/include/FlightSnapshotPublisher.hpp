@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "../../Utils/include/SharedMemorySegment.hpp"
+
+/**
+ * @class FlightSnapshotPublisher
+ * @brief Singleton that publishes immutable, versioned flight snapshots into shared memory.
+ *
+ * When enabled, the primary process copies every flight (route, schedule and seat
+ * availability) out of the FlightRepository into the inactive slot of a shared memory
+ * segment and then atomically swaps the active slot. Reader processes on the same machine
+ * map the segment through FlightSnapshotReader and answer route searches and seat map
+ * queries without any round trip to the primary.
+ *
+ * Publication is disabled by default; services call publishIfEnabled() after every
+ * successful mutation of flights or seats, which is a no-op while disabled. It only marks
+ * the snapshot stale and wakes a background publisher thread, so bookings do not pay for
+ * rebuilding the snapshot: the thread publishes at most once per PUBLISH_INTERVAL, folding
+ * every change made in the meantime into one snapshot. Readers therefore lag the primary
+ * by up to PUBLISH_INTERVAL plus the time of one publication.
+ *
+ * Publications are serialized by a mutex. Flights that cannot be published (identifiers
+ * or locations too long for the record fields) and tables that outgrow the segment are
+ * reported on std::cerr whenever that situation starts or its extent changes.
+ *
+ * The singleton creates the FlightRepository before itself, so it is destroyed first:
+ * its destructor stops the publisher thread while the flights it reads still exist.
+ *
+ * @see FlightSnapshotLayout for the segment format.
+ * @see FlightSnapshotReader for the reader side.
+ */
+class FlightSnapshotPublisher {
+    std::unique_ptr<SharedMemorySegment> segment;
+    std::atomic<std::uint64_t> publishedEpoch{0};
+    std::mutex publishMutex;
+    std::size_t skippedFlights = 0;
+    bool overflowing = false;
+
+    std::thread publisherThread;
+    std::mutex stateMutex;
+    std::condition_variable stateChanged;
+    bool stale = false;
+    bool stopping = false;
+
+    FlightSnapshotPublisher();
+    FlightSnapshotPublisher(const FlightSnapshotPublisher&) = delete;
+    FlightSnapshotPublisher& operator=(const FlightSnapshotPublisher&) = delete;
+    FlightSnapshotPublisher(FlightSnapshotPublisher&&) = delete;
+    FlightSnapshotPublisher& operator=(FlightSnapshotPublisher&&) = delete;
+
+    void publisherLoop();
+
+    public:
+        static constexpr std::chrono::milliseconds PUBLISH_INTERVAL{50};
+
+        static std::shared_ptr<FlightSnapshotPublisher> getInstance();
+
+        void enable(const std::string& segmentName);
+        inline bool isEnabled() const                   { return segment != nullptr; }
+        inline std::uint64_t getPublishedEpoch() const  { return publishedEpoch.load(); }
+
+        bool publish();
+        bool publishIfEnabled();
+
+        ~FlightSnapshotPublisher();
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../../Utils/include/DateTime.hpp"
+#include "../../Utils/include/SharedMemorySegment.hpp"
+
+/**
+ * @struct FlightSnapshotEntry
+ * @brief Plain copy of the searchable fields of a flight taken from a published snapshot.
+ */
+struct FlightSnapshotEntry {
+    std::string flightId;
+    std::string origin;
+    std::string destination;
+    DateTime departureTime;
+    DateTime arrivalTime;
+    int availableSeats;
+};
+
+/**
+ * @class FlightSnapshotReader
+ * @brief Read-only view of the flight snapshots published by a primary process.
+ *
+ * The reader maps the shared memory segment created by FlightSnapshotPublisher and serves
+ * route searches and seat map queries directly from it, without touching the repositories
+ * or communicating with the primary. Every query reads a single consistent snapshot: if the
+ * publisher reuses the slot while a query is copying data out, the query is retried.
+ *
+ * @note Queries return copies, so results stay valid after newer snapshots are published.
+ */
+class FlightSnapshotReader {
+    SharedMemorySegment segment;
+
+    template<typename Query>
+    auto readConsistent(Query&& query) const;
+
+    public:
+        explicit FlightSnapshotReader(const std::string& segmentName);
+
+        std::uint64_t getEpoch() const;
+        std::vector<FlightSnapshotEntry> getFlightsByRouteAndDate(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& departureDate
+        ) const;
+        std::optional<std::vector<std::vector<bool>>> getSeatMap(const std::string& flightId) const;
+
+        ~FlightSnapshotReader() = default;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
+
+/**
+ * @class MutationLog
+ * @brief Singleton, append-only log of every change applied to the repositories.
+ *
+ * Each record describes one upsert (the full JSON image of the entity after the change)
+ * or one delete, and is assigned a log sequence number (LSN) starting at 1. Because the
+ * JSON database is only rewritten when the process exits, the database files plus the
+ * records logged since startup fully describe the current state; ReplicationPrimary ships
+ * these records to a follower process which replays them in LSN order.
+ *
+ * Repositories record their own add/update/delete calls. Services that mutate a model in
+ * place through a shared pointer (seat statuses, loyalty points, crew assignments) record
+ * an upsert of that model themselves.
+ *
+ * Logging is disabled by default, in which case recording is a cheap no-op.
+ *
+ * Retention: the log must keep every record, since a follower that connects later
+ * replays it from the start. Records are therefore spilled to a temporary file created
+ * by enable() and removed when the process exits; only the last TAIL_RECORDS encoded
+ * records stay in memory, which is where a follower that keeps up reads them from, plus
+ * the 8-byte file offset of every record. Older records are read back from the file.
+ *
+ * @note Records may be appended by the thread owning the repositories while another thread
+ *       reads them; all access to the record list is synchronized internally.
+ */
+class MutationLog {
+    public:
+        enum class Table { Aircraft, CrewMembers, Flights, Payments, Reservations, Users, Waitlists };
+        enum class Operation { Upsert, Delete };
+
+    private:
+        mutable std::mutex mutex;
+        mutable std::condition_variable recordAppended;
+        mutable std::fstream spill;
+        std::string spillPath;
+        std::uint64_t spillSize = 0;
+        std::vector<std::uint64_t> offsets;
+        std::deque<std::string> tail;
+        std::atomic<bool> enabled{false};
+
+        MutationLog() = default;
+        MutationLog(const MutationLog&) = delete;
+        MutationLog& operator=(const MutationLog&) = delete;
+        MutationLog(MutationLog&&) = delete;
+        MutationLog& operator=(MutationLog&&) = delete;
+
+        void append(Table table, Operation operation, const std::string& id, JSON data);
+
+    public:
+        static constexpr std::size_t TAIL_RECORDS = 1024;
+
+        static std::shared_ptr<MutationLog> getInstance();
+
+        static const char* tableName(Table table);
+        static std::optional<Table> tableFromName(const std::string& name);
+
+        void enable();
+        inline bool isEnabled() const                   { return enabled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Records the current image of an entity that was added or changed.
+         *
+         * @tparam T Model type providing to_json(JSON&) that writes an "id" field.
+         * @param table The table the entity belongs to.
+         * @param entity The entity after the change.
+         */
+        template<typename T>
+        void recordUpsert(Table table, const T& entity) {
+            if (!isEnabled()) {
+                return;
+            }
+            JSON data;
+            entity.to_json(data);
+            std::string id = data.at("id").get<std::string>();
+            append(table, Operation::Upsert, id, std::move(data));
+        }
+        void recordDelete(Table table, const std::string& id);
+
+        std::uint64_t getLastLsn() const;
+        std::optional<std::string> waitForRecord(std::uint64_t lsn, std::chrono::milliseconds timeout) const;
+
+        ~MutationLog();
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct ResultPage
+ * @brief One page of a sorted listing and the cursor to continue it from.
+ *
+ * @tparam Row The row type of the page.
+ * @tparam Cursor The keyset cursor type; next is empty on the last page.
+ */
+template <typename Row, typename Cursor>
+struct ResultPage {
+    std::vector<Row> rows;
+    std::optional<Cursor> next;
+};
+
+/**
+ * @class OrderedIndex
+ * @brief Secondary index keeping record IDs sorted by a sort key, for paginated listings.
+ *
+ * Entries are ordered by (key, ID), so records sharing a sort key still have a stable
+ * order. Pages are addressed with keyset cursors: a cursor is the (key, ID) of the last
+ * entry of the previous page, and the next page starts right after it. Fetching a page
+ * costs O(log n + page size) whatever page is requested, and a cursor stays valid while
+ * records are added or removed around it.
+ *
+ * All methods are thread-safe.
+ *
+ * @tparam Key The sort key; must be copyable and ordered by operator<.
+ */
+template <typename Key>
+class OrderedIndex {
+    public:
+        using Cursor = std::pair<Key, std::string>;
+
+        /**
+         * @brief IDs of one page, in order, and the cursor of the next page if there is one.
+         */
+        struct Page {
+            std::vector<std::string> ids;
+            std::optional<Cursor> next;
+        };
+
+    private:
+        std::set<Cursor> entries;
+        std::unordered_map<std::string, Key> keys;
+        mutable std::shared_mutex mutex;
+
+    public:
+        OrderedIndex() = default;
+        OrderedIndex(const OrderedIndex&) = delete;
+        OrderedIndex& operator=(const OrderedIndex&) = delete;
+
+        /**
+         * @brief Indexes a record under a sort key, replacing its previous key if any.
+         */
+        void upsert(const std::string& id, const Key& key) {
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            auto it = keys.find(id);
+            if (it != keys.end()) {
+                if (!(it -> second < key) && !(key < it -> second)) {
+                    return;
+                }
+                entries.erase(Cursor(it -> second, id));
+                it -> second = key;
+            } else {
+                keys.emplace(id, key);
+            }
+            entries.emplace(key, id);
+        }
+
+        /**
+         * @brief Removes a record from the index; does nothing if it is not indexed.
+         */
+        void erase(const std::string& id) {
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            auto it = keys.find(id);
+            if (it == keys.end()) {
+                return;
+            }
+            entries.erase(Cursor(it -> second, id));
+            keys.erase(it);
+        }
+
+        inline std::size_t size() const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            return entries.size();
+        }
+
+        /**
+         * @brief Returns the IDs of at most limit records following the cursor.
+         *
+         * @param after The cursor of the previous page, or std::nullopt for the first page.
+         * @param limit The maximum number of IDs in the page.
+         */
+        Page page(const std::optional<Cursor>& after, std::size_t limit) const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            Page result;
+            auto it = after.has_value() ? entries.upper_bound(after.value()) : entries.begin();
+            result.ids.reserve(limit);
+            for (; it != entries.end() && result.ids.size() < limit; ++it) {
+                result.ids.push_back(it -> second);
+            }
+            if (it != entries.end() && !result.ids.empty()) {
+                result.next = *std::prev(it);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Visits the records whose key is at least from, in order, until visit returns false.
+         *
+         * The index stays read-locked during the scan, so visit must not change it.
+         */
+        void scanFrom(const Key& from, const std::function<bool(const Key&, const std::string&)>& visit) const {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            for (auto it = entries.lower_bound(Cursor(from, std::string())); it != entries.end(); ++it) {
+                if (!visit(it -> first, it -> second)) {
+                    return;
+                }
+            }
+        }
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class OverbookingRepository
+ * @brief Singleton holding the state behind overbooking decisions.
+ *
+ * - No-show statistics per route ("ORIGIN-DESTINATION"): how many reservations ended
+ *   boarded and how many as no-shows. They are rebuilt at startup from the stored
+ *   reservations and the outcomes the archive index keeps for archived flights, and then
+ *   updated incrementally as outcomes are recorded. Every update bumps the route's
+ *   generation.
+ * - The authorized capacity of each flight, cached together with the route generation
+ *   and aircraft it was computed from, so it is only recomputed once one of them changed.
+ * - The reservations sold beyond the physical seats of each flight, which have no seat
+ *   yet, in the order they were sold (after a restart, in the order they are loaded).
+ *   Freed seats are given to them first.
+ *
+ * All access is synchronized internally.
+ *
+ * Copy and move operations are deleted to enforce singleton behavior.
+ */
+class OverbookingRepository {
+    public:
+        struct RouteStatistics {
+            std::uint64_t boarded = 0;
+            std::uint64_t noShows = 0;
+            std::uint64_t generation = 0;
+        };
+        struct CapacityLimit {
+            int authorizedCapacity = 0;
+            std::uint64_t routeGeneration = 0;
+            std::string route;
+            std::string aircraftId;
+        };
+
+    private:
+        std::unordered_map<std::string, RouteStatistics> routes;
+        std::unordered_map<std::string, CapacityLimit> limits;
+        std::unordered_map<std::string, std::deque<std::string>> unassigned;
+        mutable std::mutex mutex;
+
+        OverbookingRepository();
+        OverbookingRepository(const OverbookingRepository&) = delete;
+        OverbookingRepository& operator=(const OverbookingRepository&) = delete;
+        OverbookingRepository(OverbookingRepository&&) = delete;
+        OverbookingRepository& operator=(OverbookingRepository&&) = delete;
+
+    public:
+        static std::shared_ptr<OverbookingRepository> getInstance();
+        static std::string getRouteKey(const std::string& origin, const std::string& destination);
+
+        RouteStatistics getRouteStatistics(const std::string& route) const;
+        void recordOutcome(const std::string& route, bool boarded);
+
+        std::optional<CapacityLimit> findCapacityLimit(const std::string& flightId) const;
+        void setCapacityLimit(const std::string& flightId, CapacityLimit limit);
+
+        std::size_t countUnassigned(const std::string& flightId) const;
+        void addUnassigned(const std::string& flightId, const std::string& reservationId);
+        std::optional<std::string> popUnassigned(const std::string& flightId);
+        bool removeUnassigned(const std::string& flightId, const std::string& reservationId);
+
+        void forgetFlight(const std::string& flightId);
+
+        ~OverbookingRepository() = default;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "OrderedIndex.hpp"
+
+/**
+ * @class PrefixIndex
+ * @brief Secondary index finding records by a prefix of a name, case-insensitively.
+ *
+ * Names are kept lower-cased in an OrderedIndex, sorted by (name, ID), so every name
+ * starting with a prefix sits in one contiguous run that begins where the prefix itself
+ * would be inserted. A search seeks to that point in O(log n) and reads the first k
+ * matches in order, never touching the records outside the run.
+ *
+ * All methods are thread-safe.
+ */
+class PrefixIndex {
+    OrderedIndex<std::string> names;
+
+    static std::string normalize(const std::string& text) {
+        std::string normalized(text);
+        for (char& c : normalized) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return normalized;
+    }
+
+    public:
+        PrefixIndex() = default;
+        PrefixIndex(const PrefixIndex&) = delete;
+        PrefixIndex& operator=(const PrefixIndex&) = delete;
+
+        /**
+         * @brief Indexes a record under a name, replacing its previous name if any.
+         */
+        inline void upsert(const std::string& id, const std::string& name)      { names.upsert(id, normalize(name)); }
+
+        /**
+         * @brief Removes a record from the index; does nothing if it is not indexed.
+         */
+        inline void erase(const std::string& id)                                { names.erase(id); }
+
+        /**
+         * @brief Returns the IDs of the first records, by name, whose name starts with a prefix.
+         *
+         * @param prefix The prefix, matched case-insensitively; an empty prefix matches every name.
+         * @param limit The maximum number of IDs returned.
+         */
+        std::vector<std::string> findByPrefix(const std::string& prefix, std::size_t limit) const {
+            std::vector<std::string> ids;
+            if (limit == 0) {
+                return ids;
+            }
+            const std::string normalizedPrefix = normalize(prefix);
+            names.scanFrom(normalizedPrefix, [&](const std::string& name, const std::string& id) {
+                if (name.compare(0, normalizedPrefix.size(), normalizedPrefix) != 0) {
+                    return false;
+                }
+                ids.push_back(id);
+                return ids.size() < limit;
+            });
+            return ids;
+        }
+};
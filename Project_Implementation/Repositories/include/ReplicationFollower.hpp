@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "MutationLog.hpp"
+#include "../../Utils/include/UnixSocket.hpp"
+
+/**
+ * @struct ReplicationStatus
+ * @brief Point-in-time view of a follower's progress and measured performance.
+ *
+ * Lag is the time between a record's commit on the primary and its application on the
+ * follower. Catch-up figures cover the backlog that existed when the follower connected.
+ */
+struct ReplicationStatus {
+    bool connected = false;
+    bool caughtUp = false;
+    bool promoted = false;
+    std::string error;
+
+    std::uint64_t appliedLsn = 0;
+    std::uint64_t primaryLsn = 0;
+    std::uint64_t recordsApplied = 0;
+    std::uint64_t bytesApplied = 0;
+
+    double lastLagMillis = 0.0;
+    double averageLagMillis = 0.0;
+    double maxLagMillis = 0.0;
+
+    std::uint64_t catchUpRecords = 0;
+    double catchUpSeconds = 0.0;
+    double catchUpRecordsPerSecond = 0.0;
+    double catchUpBytesPerSecond = 0.0;
+};
+
+/**
+ * @class ReplicationFollower
+ * @brief Hot-standby side of log shipping: continuously applies a primary's MutationLog.
+ *
+ * On construction the follower disables saving of the database files (they belong to
+ * the primary), connects to the primary's socket and starts a thread that replays every
+ * received record into the local repositories in LSN order.
+ *
+ * Until promote() is called the repositories belong to the apply thread, so the rest
+ * of the process must not access them. Promotion stops the apply thread, re-enables
+ * saving and hands the repositories over to the calling thread; this is the failover
+ * path when the primary disconnects, but it may also be requested while it is alive.
+ *
+ * @note Copy and move operations are disabled.
+ */
+class ReplicationFollower {
+    UnixSocket connection;
+    std::thread applier;
+    std::atomic<bool> stopping{false};
+    mutable std::mutex statusMutex;
+    ReplicationStatus status;
+    std::uint64_t catchUpTarget = 0;
+    std::chrono::steady_clock::time_point connectedAt;
+    double totalLagMillis = 0.0;
+    std::uint64_t lagSamples = 0;
+
+    void run(std::uint64_t nextLsn);
+    void apply(const JSON& record);
+    void recordApplied(std::uint64_t lsn, std::size_t bytes, std::int64_t commitTime);
+
+    public:
+        explicit ReplicationFollower(const std::string& socketPath);
+
+        ReplicationFollower(const ReplicationFollower&) = delete;
+        ReplicationFollower& operator=(const ReplicationFollower&) = delete;
+        ReplicationFollower(ReplicationFollower&&) = delete;
+        ReplicationFollower& operator=(ReplicationFollower&&) = delete;
+
+        ReplicationStatus getStatus() const;
+        void promote();
+
+        ~ReplicationFollower();
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include "../../Utils/include/UnixSocket.hpp"
+
+/**
+ * @class ReplicationPrimary
+ * @brief Singleton that ships the MutationLog to a hot-standby follower process.
+ *
+ * Once started, the primary enables the MutationLog and listens on a Unix socket. A
+ * background thread serves one follower at a time: after the handshake it sends every
+ * record from the LSN the follower asked for, then keeps streaming new records as they
+ * are appended, batching whatever is already available into a single write. When the
+ * follower disconnects, the thread goes back to waiting for the next one, which replays
+ * the log from the start.
+ *
+ * The shipping thread only reads the log; it never touches the repositories.
+ *
+ * @see ReplicationProtocol for the wire format.
+ * @see ReplicationFollower for the receiving side.
+ */
+class ReplicationPrimary {
+    UnixSocket listener;
+    std::thread shipper;
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> followerConnected{false};
+    std::uint64_t baseline = 0;
+
+    ReplicationPrimary() = default;
+    ReplicationPrimary(const ReplicationPrimary&) = delete;
+    ReplicationPrimary& operator=(const ReplicationPrimary&) = delete;
+    ReplicationPrimary(ReplicationPrimary&&) = delete;
+    ReplicationPrimary& operator=(ReplicationPrimary&&) = delete;
+
+    void run();
+    void serve(const UnixSocket& connection);
+
+    public:
+        static std::shared_ptr<ReplicationPrimary> getInstance();
+
+        void start(const std::string& socketPath);
+        inline bool isRunning() const                   { return shipper.joinable(); }
+        inline bool hasFollower() const                 { return followerConnected.load(); }
+
+        ~ReplicationPrimary();
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class ReplicationProtocol
+ * @brief Wire format shared by ReplicationPrimary and ReplicationFollower.
+ *
+ * The follower connects to the primary's Unix socket and sends a Hello message naming
+ * the database baseline it loaded and the first LSN it needs. The primary answers with
+ * a HelloReply and then streams frames: a FrameHeader followed by `length` bytes of a
+ * JSON-encoded MutationLog record. A frame with length 0 is a heartbeat, sent while the
+ * log is idle so that the follower keeps an up-to-date view of the primary's LSN.
+ *
+ * Both processes run on the same machine, so integers are sent in native byte order.
+ *
+ * @note This class cannot be instantiated.
+ */
+class ReplicationProtocol {
+    public:
+        ReplicationProtocol() = delete;
+
+        static constexpr std::uint32_t MAGIC = 0x57414C31;      // "WAL1"
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::uint32_t MAX_RECORD_BYTES = 16 * 1024 * 1024;
+        static constexpr int HEARTBEAT_INTERVAL_MILLIS = 1000;
+
+        enum HandshakeStatus : std::uint32_t {
+            ACCEPTED = 0,
+            INCOMPATIBLE_VERSION = 1,
+            BASELINE_MISMATCH = 2
+        };
+
+        struct Hello {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t baseline;
+            std::uint64_t nextLsn;
+        };
+
+        struct HelloReply {
+            std::uint32_t status;
+            std::uint32_t reserved;
+            std::uint64_t primaryLsn;
+        };
+
+        struct FrameHeader {
+            std::uint32_t length;
+            std::uint32_t reserved;
+            std::uint64_t primaryLsn;
+        };
+
+        static std::uint64_t computeBaseline();
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class RepositoryView
+ * @brief Read-only range over the records stored in a repository map.
+ *
+ * Iterating a view yields the stored records as const references, straight out of the
+ * repository's own map: nothing is allocated and no shared_ptr is copied, so no reference
+ * count is touched. A view is only valid until the repository is next modified; take it,
+ * iterate it, and drop it.
+ *
+ * A view can be split into pages. page() returns a view over at most limit records
+ * starting at a cursor; the end() of a page is the cursor of the next one:
+ *
+ * @code
+ * auto aircrafts = AircraftRepository::getInstance() -> viewAircrafts();
+ * for (auto page = aircrafts.page(aircrafts.begin(), 20); !page.empty();
+ *      page = aircrafts.page(page.end(), 20)) {
+ *     for (const AircraftModel& aircraft : page) { ... }
+ * }
+ * @endcode
+ *
+ * A default-constructed view is empty.
+ *
+ * @tparam T The record type.
+ */
+template <typename T>
+class RepositoryView {
+    using Map = std::unordered_map<std::string, std::shared_ptr<T>>;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Forward iterator dereferencing to the stored record.
+         */
+        class Iterator {
+            typename Map::const_iterator position{};
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                Iterator() = default;
+                explicit Iterator(typename Map::const_iterator position) : position(position) {}
+
+                inline reference operator*() const                      { return *position -> second; }
+                inline pointer operator->() const                       { return position -> second.get(); }
+                inline Iterator& operator++()                           { ++position; return *this; }
+                inline Iterator operator++(int)                         { Iterator old = *this; ++position; return old; }
+                inline bool operator==(const Iterator& other) const     { return position == other.position; }
+                inline bool operator!=(const Iterator& other) const     { return position != other.position; }
+        };
+
+        /**
+         * @brief Position of the first record of a page.
+         */
+        using Cursor = Iterator;
+
+    private:
+        Iterator first;
+        Iterator last;
+        std::size_t count = 0;
+
+        RepositoryView(Iterator first, Iterator last, std::size_t count) : first(first), last(last), count(count) {}
+
+    public:
+        RepositoryView() = default;
+        explicit RepositoryView(const Map& map) : first(map.cbegin()), last(map.cend()), count(map.size()) {}
+
+        inline Iterator begin() const                               { return first; }
+        inline Iterator end() const                                 { return last; }
+        inline std::size_t size() const                             { return count; }
+        inline bool empty() const                                   { return count == 0; }
+
+        /**
+         * @brief Returns a view over at most limit records starting at the cursor.
+         *
+         * @param cursor Where the page starts: begin(), or the end() of the previous page.
+         * @param limit The maximum number of records in the page.
+         */
+        RepositoryView page(Cursor cursor, std::size_t limit) const {
+            Iterator pageEnd = cursor;
+            std::size_t pageSize = 0;
+            while (pageSize < limit && pageEnd != last) {
+                ++pageEnd;
+                pageSize++;
+            }
+            return RepositoryView(cursor, pageEnd, pageSize);
+        }
+};
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../../Model/include/ReservationModel.hpp"
+#include "OrderedIndex.hpp"
+#include <functional>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -12,7 +16,12 @@
  *
  * This class provides methods to add, update, delete, and query reservations.
  * It ensures only one instance exists using the singleton pattern.
- * Reservations are stored in an unordered map, indexed by reservation ID.
+ * Reservations are stored in unordered maps indexed by reservation ID, one map per
+ * FlightRepository shard: a reservation lives in the shard owning its flight and is
+ * only accessed from that shard's thread. A reservation-to-shard directory routes
+ * lookups by ID; queries by passenger scatter to every shard. An ordered index of
+ * reservation IDs serves sorted listings one page at a time. A reservation whose flight
+ * moves it to another shard is moved outside of any shard task, one shard at a time.
  *
  * Copy and move operations are deleted to enforce singleton behavior.
  *
@@ -20,12 +29,23 @@
  * - getInstance(): Returns the singleton instance of the repository.
  * - findReservationById(): Finds a reservation by its ID.
  * - findReservationsByPassenger(): Finds all reservations for a given passenger ID.
- * - addReservation(): Adds a new reservation.
+ * - findReservationsByFlight(): Finds all reservations of a given flight, searching its shard only.
+ * - forEachReservation(): Visits every reservation without copying the collection.
+ * - getReservationsById(): Returns one page of reservations sorted by reservation ID.
+ * - addReservation(): Adds a copy of a new reservation.
+ * - emplaceReservation(): Adds a newly built reservation without copying it.
  * - updateReservation(): Updates an existing reservation.
+ * - compareAndSetReservation(): Updates a reservation only if it is still at the expected version.
+ * - modifyReservation(): Changes a stored reservation in place without copying it.
  * - deleteReservation(): Deletes a reservation by its ID.
  */
 class ReservationRepository {
-    std::unordered_map<std::string, std::shared_ptr<ReservationModel>> reservations;
+    using ReservationMap = std::unordered_map<std::string, std::shared_ptr<ReservationModel>>;
+
+    std::vector<ReservationMap> shards;
+    std::unordered_map<std::string, std::size_t> reservationShards;
+    mutable std::shared_mutex directoryMutex;
+    OrderedIndex<std::string> reservationOrder;
 
     ReservationRepository();
     ReservationRepository(const ReservationRepository&) = delete;
@@ -33,14 +53,30 @@ class ReservationRepository {
     ReservationRepository(ReservationRepository&&) = delete;
     ReservationRepository& operator=(ReservationRepository&&) = delete;
 
+    std::size_t getShardForFlight(const std::string& flightId) const;
+    std::optional<std::size_t> findShardOfReservation(const std::string& reservationId) const;
+    void setReservationShard(const std::string& reservationId, std::size_t shard);
+    void eraseReservationShard(const std::string& reservationId);
+    void moveReservationShard(const std::shared_ptr<ReservationModel>& reservation, std::size_t fromShard, std::size_t toShard);
+
     public:
+        using ReservationCursor = OrderedIndex<std::string>::Cursor;
+        using ReservationPage = ResultPage<std::shared_ptr<ReservationModel>, ReservationCursor>;
+
         static std::shared_ptr<ReservationRepository> getInstance();
         std::optional<std::shared_ptr<ReservationModel>> findReservationById(const std::string& reservationId) const;
         std::vector<std::shared_ptr<ReservationModel>> findReservationsByPassenger(const std::string& passengerId) const;
+        std::vector<std::shared_ptr<ReservationModel>> findReservationsByFlight(const std::string& flightId) const;
         std::vector<std::shared_ptr<ReservationModel>> getAllReservations() const;
+        void forEachReservation(const std::function<void(const ReservationModel&)>& visit) const;
+        ReservationPage getReservationsById(const std::optional<ReservationCursor>& after, std::size_t limit) const;
         bool addReservation(const ReservationModel& newReservation);
+        bool emplaceReservation(std::shared_ptr<ReservationModel> newReservation);
         bool updateReservation(const ReservationModel& reservation);
+        bool compareAndSetReservation(const ReservationModel& reservation, std::uint64_t expectedVersion);
+        bool modifyReservation(const std::string& reservationId, const std::function<bool(ReservationModel&)>& mutate);
         bool deleteReservation(const std::string& reservationId);
+        void moveFlightReservations(const std::string& flightId, std::size_t fromShard, std::size_t toShard);
 
         ~ReservationRepository();
 };
\ No newline at end of file
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <array>
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <vector>
 #include "../../Model/include/UserModel.hpp"
+#include "../../Model/include/Passenger.hpp"
+#include "RepositoryView.hpp"
+#include "PrefixIndex.hpp"
 
 /**
  * @class UserRepository
@@ -12,13 +17,23 @@
  *
  * Maintains a collection of users and provides methods for querying,
  * adding, updating, and deleting user records. Uses an unordered map
- * for efficient lookup by user ID and username.
+ * for efficient lookup by user ID and username. modifyUser() changes a stored
+ * user in place, without the JSON round trip through UserFactory that updateUser() needs
+ * to rebuild the right derived type. viewUsers() iterates every user without copying
+ * the collection. A prefix index over usernames, kept up to date by every change, lets
+ * findUsersByUsernamePrefix() return the first matches without scanning all users.
+ * Users are also stored per role, so getUsersByRole() visits only the users of the role
+ * and findPassengerById() returns a passenger, loyalty points and all, from the passenger
+ * table with a static cast instead of a dynamic_pointer_cast.
  *
  * Copy and move operations are deleted to enforce singleton pattern.
  */
 class UserRepository {
     std::unordered_map<std::string, std::shared_ptr<UserModel>> users;
     std::unordered_map<std::string, std::string> usernameToIdMap;
+    PrefixIndex usernamePrefixes;
+    static constexpr std::size_t ROLE_COUNT = static_cast<std::size_t>(UserModel::UserType::INVALID);
+    std::array<std::unordered_map<std::string, std::shared_ptr<UserModel>>, ROLE_COUNT> usersByRole;
     
     UserRepository();
     UserRepository(const UserRepository&) = delete;
@@ -26,15 +41,21 @@ class UserRepository {
     UserRepository(UserRepository&&) = delete;
     UserRepository& operator=(UserRepository&&) = delete;
 
+    void indexRole(const std::shared_ptr<UserModel>& user);
+    void unindexRole(const UserModel& user);
 
     public:
         static std::shared_ptr<UserRepository> getInstance();
         std::optional<std::shared_ptr<UserModel>> findUserById(const std::string& userId) const;
         std::optional<std::shared_ptr<UserModel>> findUserByUsername(const std::string& username) const;
+        std::optional<std::shared_ptr<Passenger>> findPassengerById(const std::string& passengerId) const;
+        std::vector<std::shared_ptr<UserModel>> findUsersByUsernamePrefix(const std::string& prefix, std::size_t limit) const;
         std::vector<std::shared_ptr<UserModel>> getAllUsers() const;
+        inline RepositoryView<UserModel> viewUsers() const             { return RepositoryView<UserModel>(users); }
         std::vector<std::shared_ptr<UserModel>> getUsersByRole(const UserModel::UserType& role) const;
         bool addUser(const UserModel& newUser);
         bool updateUser(const UserModel& user);
+        bool modifyUser(const std::string& userId, const std::function<bool(UserModel&)>& mutate);
         bool deleteUser(const std::string& userId);
 
         ~UserRepository();
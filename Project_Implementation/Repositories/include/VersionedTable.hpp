@@ -0,0 +1,215 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../Utils/include/EpochManager.hpp"
+
+/**
+ * @class VersionedTable
+ * @brief Multi-version copy of a repository table for lock-free, point-in-time reads.
+ *
+ * Every committed change publishes a new immutable version of the table. Readers take a
+ * Snapshot, which pins the current version through the EpochManager and never takes a
+ * lock, so a long-running scan sees one consistent state while writers keep committing.
+ * Old versions are reclaimed once the last snapshot that can see them is gone.
+ *
+ * Rows are split into BUCKET_COUNT immutable buckets. A commit copies the bucket array and
+ * the single bucket holding the row, so it costs O(n / BUCKET_COUNT) row pointer copies
+ * rather than O(n), plus one copy of the changed row itself (for a flight, its whole seat
+ * map). Rows are never copied for a read. Writers are serialized among themselves only.
+ *
+ * @tparam T The row type; rows are stored as immutable copies.
+ */
+template <typename T>
+class VersionedTable {
+    public:
+        using Row = std::shared_ptr<const T>;
+
+    private:
+        static constexpr std::size_t BUCKET_COUNT = 64;
+
+        using Bucket = std::unordered_map<std::string, Row>;
+
+        struct Version {
+            std::uint64_t number = 0;
+            std::size_t size = 0;
+            std::array<std::shared_ptr<const Bucket>, BUCKET_COUNT> buckets;
+        };
+
+        std::shared_ptr<EpochManager> epochs;
+        std::atomic<const Version*> current;
+        std::mutex writeMutex;
+
+        static std::size_t getBucket(const std::string& id) {
+            return std::hash<std::string>{}(id) % BUCKET_COUNT;
+        }
+
+        /**
+         * @brief Publishes a copy of the current version with one bucket replaced.
+         *
+         * @param id The row whose bucket changes.
+         * @param change Applies the change to the copied bucket; returns the change in row count.
+         */
+        void commit(const std::string& id, const std::function<long(Bucket&)>& change) {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            const Version* old = current.load();
+            auto next = std::make_unique<Version>(*old);
+            std::size_t index = getBucket(id);
+            auto bucket = std::make_shared<Bucket>(*old -> buckets[index]);
+            long delta = change(*bucket);
+            next -> buckets[index] = std::move(bucket);
+            next -> size = static_cast<std::size_t>(static_cast<long>(next -> size) + delta);
+            next -> number = old -> number + 1;
+            current.store(next.release());
+            epochs -> retire([old] { delete old; });
+        }
+
+    public:
+        /**
+         * @class Snapshot
+         * @brief A consistent, read-only view of the table as of one version.
+         *
+         * Keeps its version alive until destroyed; hold it only for the duration of a read.
+         * Iterating a snapshot yields its rows as const references without copying any Row.
+         */
+        class Snapshot {
+            EpochManager::Guard guard;
+            const Version* version;
+
+            public:
+                /**
+                 * @class Iterator
+                 * @brief Forward iterator over the rows of every bucket of one version.
+                 */
+                class Iterator {
+                    const Version* version = nullptr;
+                    std::size_t bucket = BUCKET_COUNT;
+                    typename Bucket::const_iterator position{};
+
+                    void skipEmptyBuckets() {
+                        while (bucket < BUCKET_COUNT && position == version -> buckets[bucket] -> end()) {
+                            if (++bucket < BUCKET_COUNT) {
+                                position = version -> buckets[bucket] -> begin();
+                            }
+                        }
+                        if (bucket == BUCKET_COUNT) {
+                            position = {};
+                        }
+                    }
+
+                    public:
+                        using iterator_category = std::forward_iterator_tag;
+                        using value_type = T;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = const T*;
+                        using reference = const T&;
+
+                        Iterator() = default;
+                        explicit Iterator(const Version* version) : version(version), bucket(0), position(version -> buckets[0] -> begin()) {
+                            skipEmptyBuckets();
+                        }
+
+                        inline reference operator*() const                      { return *position -> second; }
+                        inline pointer operator->() const                       { return position -> second.get(); }
+                        inline Iterator& operator++()                           { ++position; skipEmptyBuckets(); return *this; }
+                        inline Iterator operator++(int)                         { Iterator old = *this; ++(*this); return old; }
+                        inline bool operator==(const Iterator& other) const     { return bucket == other.bucket && position == other.position; }
+                        inline bool operator!=(const Iterator& other) const     { return !(*this == other); }
+                };
+
+                Snapshot(EpochManager::Guard guard, const Version* version) : guard(std::move(guard)), version(version) {}
+
+                inline Iterator begin() const                       { return Iterator(version); }
+                inline Iterator end() const                         { return Iterator(); }
+                inline bool empty() const                           { return version -> size == 0; }
+
+                inline std::uint64_t getVersionNumber() const       { return version -> number; }
+                inline std::size_t size() const                     { return version -> size; }
+
+                std::optional<Row> find(const std::string& id) const {
+                    const auto& bucket = *version -> buckets[getBucket(id)];
+                    auto it = bucket.find(id);
+                    if (it == bucket.end()) {
+                        return std::nullopt;
+                    }
+                    return it -> second;
+                }
+
+                template <typename Function>
+                void forEach(Function&& function) const {
+                    for (const auto& bucket : version -> buckets) {
+                        for (const auto& [id, row] : *bucket) {
+                            function(row);
+                        }
+                    }
+                }
+
+                std::vector<Row> getAll() const {
+                    std::vector<Row> rows;
+                    rows.reserve(version -> size);
+                    forEach([&rows](const Row& row) { rows.push_back(row); });
+                    return rows;
+                }
+        };
+
+        VersionedTable() : epochs(EpochManager::getInstance()) {
+            auto initial = std::make_unique<Version>();
+            auto empty = std::make_shared<const Bucket>();
+            initial -> buckets.fill(empty);
+            current.store(initial.release());
+        }
+
+        VersionedTable(const VersionedTable&) = delete;
+        VersionedTable& operator=(const VersionedTable&) = delete;
+        VersionedTable(VersionedTable&&) = delete;
+        VersionedTable& operator=(VersionedTable&&) = delete;
+
+        /**
+         * @brief Returns a snapshot of the latest committed version without taking any lock.
+         */
+        Snapshot takeSnapshot() const {
+            EpochManager::Guard guard = epochs -> pin();
+            return Snapshot(std::move(guard), current.load());
+        }
+
+        inline std::uint64_t getVersionNumber() const       { return current.load() -> number; }
+
+        /**
+         * @brief Commits a new version in which the row has the given value.
+         *
+         * The value is copied once into the new immutable row.
+         */
+        void put(const std::string& id, const T& value) {
+            Row row = std::make_shared<const T>(value);
+            commit(id, [&id, &row](Bucket& bucket) {
+                return bucket.insert_or_assign(id, row).second ? 1L : 0L;
+            });
+        }
+
+        /**
+         * @brief Commits a new version without the row; does nothing if it does not exist.
+         */
+        void remove(const std::string& id) {
+            if (!takeSnapshot().find(id).has_value()) {
+                return;
+            }
+            commit(id, [&id](Bucket& bucket) {
+                return -static_cast<long>(bucket.erase(id));
+            });
+        }
+
+        ~VersionedTable() {
+            delete current.load();
+            epochs -> reclaim();
+        }
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../../Model/include/WaitlistEntryModel.hpp"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class WaitlistRepository
+ * @brief Singleton repository for the waitlists of fully booked flights.
+ *
+ * Every flight has its own waitlist, kept as a binary heap ordered by
+ * WaitlistEntryModel::hasPriorityOver(), so the next passenger to serve is always at the
+ * front: joining a waitlist and taking its first entry are both O(log n). Entries are also
+ * indexed by ID and persisted to the waitlists database file.
+ *
+ * Waitlists of flights owned by different shards may be used concurrently; all access is
+ * synchronized internally.
+ *
+ * Copy and move operations are deleted to enforce singleton behavior.
+ *
+ * Public Methods:
+ * - getInstance(): Returns the singleton instance of the repository.
+ * - findEntryById(): Finds a waitlist entry by its ID.
+ * - getWaitlistLength(): Returns the number of passengers waiting for a flight.
+ * - nextSequence(): Returns the request order number of the next entry.
+ * - addEntry(): Adds an entry to its flight's waitlist.
+ * - popNextEntry(): Removes and returns the highest-priority entry of a flight's waitlist.
+ * - deleteEntry(): Removes an entry by its ID.
+ * - deleteWaitlist(): Removes the whole waitlist of a flight.
+ */
+class WaitlistRepository {
+    using EntryMap = std::unordered_map<std::string, std::shared_ptr<WaitlistEntryModel>>;
+    using Heap = std::vector<std::shared_ptr<WaitlistEntryModel>>;
+
+    EntryMap entries;
+    std::unordered_map<std::string, Heap> waitlists;
+    std::uint64_t sequence = 0;
+    mutable std::mutex mutex;
+
+    WaitlistRepository();
+    WaitlistRepository(const WaitlistRepository&) = delete;
+    WaitlistRepository& operator=(const WaitlistRepository&) = delete;
+    WaitlistRepository(WaitlistRepository&&) = delete;
+    WaitlistRepository& operator=(WaitlistRepository&&) = delete;
+
+    public:
+        static std::shared_ptr<WaitlistRepository> getInstance();
+        std::optional<std::shared_ptr<WaitlistEntryModel>> findEntryById(const std::string& entryId) const;
+        std::size_t getWaitlistLength(const std::string& flightId) const;
+        std::uint64_t nextSequence();
+        bool addEntry(std::shared_ptr<WaitlistEntryModel> entry);
+        std::optional<std::shared_ptr<WaitlistEntryModel>> popNextEntry(const std::string& flightId);
+        bool deleteEntry(const std::string& entryId);
+        void deleteWaitlist(const std::string& flightId);
+
+        ~WaitlistRepository();
+};
@@ -1,4 +1,5 @@
 #include "../include/AircraftRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
 #include <stdexcept>
@@ -82,6 +83,7 @@ bool AircraftRepository::addAircraft(const AircraftModel& newAircraft) {
         return false;
     }
     aircrafts[newAircraft.getAircraftId()] = std::make_shared<AircraftModel>(newAircraft);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Aircraft, newAircraft);
     return true;
 }
 /**
@@ -99,6 +101,25 @@ bool AircraftRepository::updateAircraft(const AircraftModel& aircraft) {
         return false;
     }
     aircrafts[aircraft.getAircraftId()] = std::make_shared<AircraftModel>(aircraft);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Aircraft, aircraft);
+    return true;
+}
+/**
+ * @brief Changes a stored aircraft in place.
+ *
+ * The mutator receives the stored aircraft itself, so no copy is made. It returns false
+ * if it made no change, in which case nothing is recorded.
+ *
+ * @param aircraftId The unique identifier of the aircraft to change.
+ * @param mutate Applies the change; returns whether anything changed.
+ * @return true if the aircraft exists and was changed; false otherwise.
+ */
+bool AircraftRepository::modifyAircraft(const std::string& aircraftId, const std::function<bool(AircraftModel&)>& mutate) {
+    auto it = aircrafts.find(aircraftId);
+    if (it == aircrafts.end() || !mutate(*it -> second)) {
+        return false;
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Aircraft, *it -> second);
     return true;
 }
 /**
@@ -116,6 +137,7 @@ bool AircraftRepository::deleteAircraft(const std::string& aircraftId) {
         return false;
     }
     aircrafts.erase(aircraftId);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Aircraft, aircraftId);
     return true;
 }
 
@@ -128,6 +150,6 @@ bool AircraftRepository::deleteAircraft(const std::string& aircraftId) {
  * object is destroyed.
  */
 AircraftRepository::~AircraftRepository() {
-    JSONManager::saveToJSON(aircrafts, AIRCRAFT_DATABASE_PATH);
+    JSONManager::saveToJSON(std::move(aircrafts), AIRCRAFT_DATABASE_PATH);
     aircrafts.clear();
 }
\ No newline at end of file
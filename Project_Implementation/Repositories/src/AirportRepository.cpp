@@ -0,0 +1,221 @@
+#include "../include/AirportRepository.hpp"
+#include "../../Utils/include/JSONManager.hpp"
+#include "../../Utils/include/DatabasePathResolver.hpp"
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <unordered_set>
+
+const std::string AIRPORT_DATABASE_PATH = DatabasePathResolver::getDatabasePath() + "airports.json";
+
+/**
+ * @brief Lower-cases a search term or query and trims surrounding whitespace.
+ */
+static std::string normalize(const std::string& text) {
+    const auto first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return "";
+    }
+    const auto last = text.find_last_not_of(" \t\r\n");
+    std::string normalized = text.substr(first, last - first + 1);
+    for (char& c : normalized) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return normalized;
+}
+
+/**
+ * @brief Finds, for every airport, the fewest edits turning a query into a prefix of one of
+ *        its terms, keeping only the airports within maxEdits.
+ *
+ * Edits are insertions, deletions, substitutions and swaps of two adjacent characters,
+ * so "cario" is one edit away from "cairo". The sorted terms are walked like a trie: the
+ * dynamic programming keeps one row per character of the term, so a term only computes
+ * the rows past the prefix it shares with the term before it. Once every entry of a row
+ * exceeds maxEdits, no longer prefix of a term beginning with it can match, so all of
+ * those terms are settled at once with the best edits found above that row.
+ */
+static std::unordered_map<std::string, std::size_t> findClosestCodes(const std::vector<std::pair<std::string, std::string>>& terms, const std::string& query, std::size_t maxEdits) {
+    std::unordered_map<std::string, std::size_t> closest;
+    const std::size_t columns = query.size() + 1;
+    // rows[d][i] is the number of edits between the first i characters of the query and the first d of the term
+    std::vector<std::vector<std::size_t>> rows(1, std::vector<std::size_t>(columns));
+    for (std::size_t i = 0; i < columns; i++) {
+        rows[0][i] = i;
+    }
+    // A prefix of the term may end anywhere, so bestEnding[d] is the best last column of rows 0 to d
+    std::vector<std::size_t> bestEnding(1, query.size());
+    const std::string* previousTerm = nullptr;
+    std::size_t computedRows = 0;
+
+    std::size_t index = 0;
+    while (index < terms.size()) {
+        const std::string& term = terms[index].first;
+        std::size_t depth = 0;
+        if (previousTerm != nullptr) {
+            const std::size_t shared = std::min(computedRows, term.size());
+            while (depth < shared && (*previousTerm)[depth] == term[depth]) {
+                depth++;
+            }
+        }
+        bool pruned = false;
+        for (; depth < term.size(); depth++) {
+            const std::size_t d = depth + 1;
+            if (rows.size() <= d) {
+                rows.emplace_back(columns);
+                bestEnding.push_back(0);
+            }
+            std::vector<std::size_t>& current = rows[d];
+            const std::vector<std::size_t>& previous = rows[d - 1];
+            current[0] = d;
+            std::size_t rowMinimum = current[0];
+            for (std::size_t i = 1; i < columns; i++) {
+                std::size_t cost = (query[i - 1] == term[d - 1]) ? 0 : 1;
+                current[i] = std::min({previous[i] + 1, current[i - 1] + 1, previous[i - 1] + cost});
+                if (d > 1 && i > 1 && term[d - 1] == query[i - 2] && term[d - 2] == query[i - 1]) {
+                    current[i] = std::min(current[i], rows[d - 2][i - 2] + 1);
+                }
+                rowMinimum = std::min(rowMinimum, current[i]);
+            }
+            bestEnding[d] = std::min(bestEnding[d - 1], current[columns - 1]);
+            if (rowMinimum > maxEdits) {
+                pruned = true;
+                break;
+            }
+        }
+        previousTerm = &term;
+        computedRows = depth;
+        // Past a pruned row the edits cannot drop, so every term under its prefix ends with the best so far
+        const std::size_t edits = bestEnding[depth];
+        const std::size_t prefixLength = pruned ? depth + 1 : term.size();
+        do {
+            if (edits <= maxEdits) {
+                auto it = closest.find(terms[index].second);
+                if (it == closest.end() || edits < it -> second) {
+                    closest[terms[index].second] = edits;
+                }
+            }
+            index++;
+        } while (pruned && index < terms.size() && terms[index].first.compare(0, prefixLength, term, 0, prefixLength) == 0);
+    }
+    return closest;
+}
+
+/**
+ * @brief Constructs the AirportRepository from the airport table and builds its search index.
+ */
+AirportRepository::AirportRepository() {
+    JSONManager::parseJSON(airports, AIRPORT_DATABASE_PATH);
+    for (const auto& [code, airport] : airports) {
+        std::unordered_set<std::string> terms = {normalize(code), normalize(airport -> getCity()), normalize(airport -> getName())};
+        for (const auto& text : {airport -> getCity(), airport -> getName()}) {
+            std::istringstream words(text);
+            std::string word;
+            while (words >> word) {
+                terms.insert(normalize(word));
+            }
+        }
+        for (const auto& term : terms) {
+            searchTerms.emplace_back(term, code);
+        }
+    }
+    std::sort(searchTerms.begin(), searchTerms.end());
+    searchTerms.shrink_to_fit();
+}
+
+/**
+ * @brief Returns a shared pointer to the singleton instance of AirportRepository.
+ *
+ * @return std::shared_ptr<AirportRepository> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<AirportRepository> AirportRepository::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<AirportRepository> instance(new AirportRepository());
+    return instance;
+}
+
+/**
+ * @brief Finds an airport by its IATA code.
+ *
+ * @param code The IATA code, in any case.
+ * @return std::optional<std::shared_ptr<const AirportModel>> The airport, or std::nullopt if the code is unknown.
+ */
+std::optional<std::shared_ptr<const AirportModel>> AirportRepository::findAirportByCode(const std::string& code) const {
+    std::string upperCode = normalize(code);
+    for (char& c : upperCode) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    auto it = airports.find(upperCode);
+    if (it == airports.end()) {
+        return std::nullopt;
+    }
+    return it -> second;
+}
+
+/**
+ * @brief Finds the airports whose code, city, name or a word of them starts with a prefix.
+ *
+ * The airport whose code is the prefix itself comes first; the others follow in the
+ * order of their matching terms. Only the matching terms are read.
+ *
+ * @param prefix The prefix, matched case-insensitively.
+ * @param limit The maximum number of airports returned.
+ * @return std::vector<std::shared_ptr<const AirportModel>> The matching airports, each once.
+ */
+std::vector<std::shared_ptr<const AirportModel>> AirportRepository::findAirportsByPrefix(const std::string& prefix, std::size_t limit) const {
+    std::vector<std::shared_ptr<const AirportModel>> matches;
+    const std::string normalizedPrefix = normalize(prefix);
+    if (normalizedPrefix.empty() || limit == 0) {
+        return matches;
+    }
+    std::unordered_set<std::string> seen;
+    auto exact = findAirportByCode(normalizedPrefix);
+    if (exact.has_value()) {
+        matches.push_back(exact.value());
+        seen.insert(exact.value() -> getCode());
+    }
+    auto it = std::lower_bound(searchTerms.begin(), searchTerms.end(), std::make_pair(normalizedPrefix, std::string()));
+    for (; it != searchTerms.end() && matches.size() < limit; ++it) {
+        if (it -> first.compare(0, normalizedPrefix.size(), normalizedPrefix) != 0) {
+            break;
+        }
+        if (seen.insert(it -> second).second) {
+            matches.push_back(airports.at(it -> second));
+        }
+    }
+    return matches;
+}
+
+/**
+ * @brief Finds the airports whose code, city, name or a word of them begins almost like a query.
+ *
+ * Queries of three or four characters may be one edit away from the beginning of a term,
+ * longer ones two; shorter queries would resemble nearly every term and match none.
+ * The airports are sorted by the fewest edits, then by airport code.
+ *
+ * @param query The query, matched case-insensitively.
+ * @param limit The maximum number of airports returned.
+ * @return std::vector<std::shared_ptr<const AirportModel>> The closest airports, each once.
+ */
+std::vector<std::shared_ptr<const AirportModel>> AirportRepository::findAirportsByApproximateName(const std::string& query, std::size_t limit) const {
+    std::vector<std::shared_ptr<const AirportModel>> matches;
+    const std::string normalizedQuery = normalize(query);
+    if (normalizedQuery.size() < 3 || limit == 0) {
+        return matches;
+    }
+    const std::size_t maxEdits = (normalizedQuery.size() <= 4) ? 1 : 2;
+    const auto closest = findClosestCodes(searchTerms, normalizedQuery, maxEdits);
+    std::vector<std::pair<std::size_t, std::string>> ranked;
+    ranked.reserve(closest.size());
+    for (const auto& [code, edits] : closest) {
+        ranked.emplace_back(edits, code);
+    }
+    std::sort(ranked.begin(), ranked.end());
+    for (const auto& [edits, code] : ranked) {
+        if (matches.size() == limit) {
+            break;
+        }
+        matches.push_back(airports.at(code));
+    }
+    return matches;
+}
@@ -0,0 +1,401 @@
+#include "../include/ArchiveRepository.hpp"
+#include "../../Utils/include/BlockCodec.hpp"
+#include "../../Utils/include/DatabasePathResolver.hpp"
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+/**
+ * @brief Path to the archive data file, holding one compressed record per archived flight.
+ */
+const std::string ARCHIVE_DATA_PATH = DatabasePathResolver::getDatabasePath() + "archive.dat";
+
+/**
+ * @brief Path to the archive index file, holding one JSON line per archived flight.
+ *
+ * Each line names a flight, the offset of its record in the data file, its reservations
+ * with their passengers, their payments, and the flight's route with how many of its
+ * passengers boarded and how many did not show up.
+ */
+const std::string ARCHIVE_INDEX_PATH = DatabasePathResolver::getDatabasePath() + "archive_index.jsonl";
+
+/**
+ * @brief Builds the JSON document of an archived flight's record.
+ */
+static JSON recordToJSON(const ArchiveRepository::FlightRecord& record) {
+    JSON json{{"flight", JSON::object()}, {"reservations", JSON::array()}, {"payments", JSON::array()}};
+    record.flight -> to_json(json["flight"]);
+    for (const auto& reservation : record.reservations) {
+        JSON element;
+        reservation -> to_json(element);
+        json["reservations"].push_back(std::move(element));
+    }
+    for (const auto& payment : record.payments) {
+        JSON element;
+        payment -> to_json(element);
+        json["payments"].push_back(std::move(element));
+    }
+    return json;
+}
+
+/**
+ * @brief Counts how many passengers of an archived flight boarded and how many did not show up.
+ */
+static ArchiveRepository::FlightOutcomes countOutcomes(const ArchiveRepository::FlightRecord& record) {
+    ArchiveRepository::FlightOutcomes outcomes;
+    outcomes.origin = record.flight -> getOrigin();
+    outcomes.destination = record.flight -> getDestination();
+    for (const auto& reservation : record.reservations) {
+        if (reservation -> getStatus() == ReservationModel::ReservationStatus::BOARDED) {
+            outcomes.boarded++;
+        } else if (reservation -> getStatus() == ReservationModel::ReservationStatus::NO_SHOW) {
+            outcomes.noShows++;
+        }
+    }
+    return outcomes;
+}
+
+/**
+ * @brief Tells whether a file is empty or ends with a complete line.
+ */
+static bool endsWithNewline(const std::string& filePath) {
+    std::ifstream input(filePath, std::ios::binary | std::ios::ate);
+    if (!input.is_open() || input.tellg() <= 0) {
+        return true;
+    }
+    input.seekg(-1, std::ios::end);
+    return input.get() == '\n';
+}
+
+/**
+ * @brief Constructs an ArchiveRepository object and loads the archive index.
+ *
+ * A missing index is an empty archive. A line cut short by a crash while the index was
+ * appended is skipped: the process died before its flight was removed from the hot
+ * repositories, so the flight is archived again by the next archiving. Lines written
+ * before the index kept the boarding outcomes have their record read once to count them.
+ */
+ArchiveRepository::ArchiveRepository() {
+    std::ifstream input(ARCHIVE_INDEX_PATH, std::ios::binary);
+    std::string line;
+    while (std::getline(input, line)) {
+        JSON entry = JSON::parse(line, nullptr, false);
+        if (entry.is_discarded() || !entry.is_object() || !entry.contains("flight") || !entry.contains("offset")
+            || !entry.contains("reservations") || !entry.contains("payments")) {
+            continue;
+        }
+        const std::string flightId = entry.at("flight").get<std::string>();
+        recordOffsets[flightId] = entry.at("offset").get<std::uint64_t>();
+        for (const auto& [reservationId, passengerId] : entry.at("reservations").items()) {
+            reservationFlights[reservationId] = flightId;
+            indexPassengerFlight(passengerId.get<std::string>(), flightId);
+        }
+        for (const auto& paymentId : entry.at("payments")) {
+            paymentFlights[paymentId.get<std::string>()] = flightId;
+        }
+        if (!entry.contains("boarded") || !entry.contains("noShows")) {
+            try {
+                flightOutcomes[flightId] = countOutcomes(readRecord(recordOffsets[flightId]));
+            } catch (const std::exception&) {
+                // An unreadable record still leaves its flight findable; it just counts no outcomes
+            }
+            continue;
+        }
+        FlightOutcomes outcomes;
+        outcomes.origin = entry.contains("origin") ? entry.at("origin").get<std::string>() : std::string();
+        outcomes.destination = entry.contains("destination") ? entry.at("destination").get<std::string>() : std::string();
+        outcomes.boarded = entry.at("boarded").get<std::uint64_t>();
+        outcomes.noShows = entry.at("noShows").get<std::uint64_t>();
+        flightOutcomes[flightId] = std::move(outcomes);
+    }
+}
+
+/**
+ * @brief Returns a shared pointer to the singleton instance of ArchiveRepository.
+ *
+ * @return std::shared_ptr<ArchiveRepository> Singleton instance of ArchiveRepository.
+ */
+std::shared_ptr<ArchiveRepository> ArchiveRepository::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<ArchiveRepository> instance(new ArchiveRepository());
+    return instance;
+}
+
+/**
+ * @brief Reads and decompresses the record starting at an offset of the data file.
+ *
+ * Called without holding the lock: records are never changed once written. The models
+ * are read with their fromArchive() factories, which skip the checks against the working
+ * set: the passenger, aircraft or crew of an archived flight may have been deleted since.
+ *
+ * @param offset The offset of the record, as listed by the index.
+ * @return FlightRecord The archived flight with its reservations and payments.
+ * @throws std::runtime_error If the data file cannot be read or the record is corrupt.
+ */
+ArchiveRepository::FlightRecord ArchiveRepository::readRecord(std::uint64_t offset) const {
+    std::ifstream input(ARCHIVE_DATA_PATH, std::ios::binary);
+    if (!input.is_open()) {
+        throw std::runtime_error("Archive \"" + ARCHIVE_DATA_PATH + "\" could not be opened for reading.");
+    }
+    input.seekg(static_cast<std::streamoff>(offset));
+    BlockDecompressingBuffer buffer(input.rdbuf());
+    std::istream decompressed(&buffer);
+    JSON json;
+    decompressed >> json;
+
+    FlightRecord record;
+    record.flight = std::make_shared<FlightModel>(FlightModel::fromArchive(json.at("flight")));
+    for (const auto& element : json.at("reservations")) {
+        record.reservations.push_back(std::make_shared<ReservationModel>(ReservationModel::fromArchive(element)));
+    }
+    for (const auto& element : json.at("payments")) {
+        record.payments.push_back(std::make_shared<PaymentModel>(PaymentModel::fromArchive(element)));
+    }
+    return record;
+}
+
+/**
+ * @brief Reads the record of the flight an index maps an ID to.
+ *
+ * @param flightIndex The index from reservation or payment IDs to flight IDs.
+ * @param id The ID to look up.
+ * @return std::optional<FlightRecord> The record, or std::nullopt if the ID is not archived.
+ */
+std::optional<ArchiveRepository::FlightRecord> ArchiveRepository::findRecordOf(
+    const std::unordered_map<std::string, std::string>& flightIndex,
+    const std::string& id
+) const {
+    std::uint64_t offset = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = flightIndex.find(id);
+        if (it == flightIndex.end()) {
+            return std::nullopt;
+        }
+        offset = recordOffsets.at(it -> second);
+    }
+    return readRecord(offset);
+}
+
+/**
+ * @brief Checks whether a flight is archived.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return true if the archive holds a record of the flight; false otherwise.
+ */
+bool ArchiveRepository::containsFlight(const std::string& flightId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return recordOffsets.count(flightId) != 0;
+}
+
+/**
+ * @brief Reads the archived record of a flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<FlightRecord> The flight with its reservations and payments, or std::nullopt if it is not archived.
+ */
+std::optional<ArchiveRepository::FlightRecord> ArchiveRepository::findFlightRecord(const std::string& flightId) const {
+    std::uint64_t offset = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = recordOffsets.find(flightId);
+        if (it == recordOffsets.end()) {
+            return std::nullopt;
+        }
+        offset = it -> second;
+    }
+    return readRecord(offset);
+}
+
+/**
+ * @brief Reads an archived flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::shared_ptr<FlightModel>> A copy of the flight, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<FlightModel>> ArchiveRepository::findFlightById(const std::string& flightId) const {
+    auto record = findFlightRecord(flightId);
+    if (!record.has_value()) {
+        return std::nullopt;
+    }
+    return record -> flight;
+}
+
+/**
+ * @brief Reads an archived reservation.
+ *
+ * @param reservationId The unique identifier of the reservation.
+ * @return std::optional<std::shared_ptr<ReservationModel>> A copy of the reservation, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<ReservationModel>> ArchiveRepository::findReservationById(const std::string& reservationId) const {
+    auto record = findRecordOf(reservationFlights, reservationId);
+    if (!record.has_value()) {
+        return std::nullopt;
+    }
+    for (const auto& reservation : record -> reservations) {
+        if (reservation -> getReservationId() == reservationId) {
+            return reservation;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Reads all archived reservations of a passenger.
+ *
+ * Only the records of the flights the index lists for the passenger are read.
+ *
+ * @param passengerId The unique identifier of the passenger.
+ * @return std::vector<std::shared_ptr<ReservationModel>> Copies of the passenger's archived reservations.
+ */
+std::vector<std::shared_ptr<ReservationModel>> ArchiveRepository::findReservationsByPassenger(const std::string& passengerId) const {
+    std::vector<std::shared_ptr<ReservationModel>> passengerReservations;
+    std::vector<std::uint64_t> offsets;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = passengerFlights.find(passengerId);
+        if (it == passengerFlights.end()) {
+            return passengerReservations;
+        }
+        for (const auto& flightId : it -> second) {
+            offsets.push_back(recordOffsets.at(flightId));
+        }
+    }
+    for (std::uint64_t offset : offsets) {
+        for (const auto& reservation : readRecord(offset).reservations) {
+            if (reservation -> getPassengerId() == passengerId) {
+                passengerReservations.push_back(reservation);
+            }
+        }
+    }
+    return passengerReservations;
+}
+
+/**
+ * @brief Reads an archived payment.
+ *
+ * @param paymentId The unique identifier of the payment.
+ * @return std::optional<std::shared_ptr<PaymentModel>> A copy of the payment, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<PaymentModel>> ArchiveRepository::findPaymentById(const std::string& paymentId) const {
+    auto record = findRecordOf(paymentFlights, paymentId);
+    if (!record.has_value()) {
+        return std::nullopt;
+    }
+    for (const auto& payment : record -> payments) {
+        if (payment -> getPaymentId() == paymentId) {
+            return payment;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Returns how many passengers of every archived flight boarded and how many did not show up.
+ *
+ * Read from the index alone, without opening any record.
+ *
+ * @return std::unordered_map<std::string, FlightOutcomes> The route and outcomes of each archived flight, by flight ID.
+ */
+std::unordered_map<std::string, ArchiveRepository::FlightOutcomes> ArchiveRepository::getFlightOutcomes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return flightOutcomes;
+}
+
+/**
+ * @brief Lists a flight among a passenger's archived flights, once however many reservations they had on it.
+ */
+void ArchiveRepository::indexPassengerFlight(const std::string& passengerId, const std::string& flightId) {
+    auto& flights = passengerFlights[passengerId];
+    if (flights.empty() || flights.back() != flightId) {
+        flights.push_back(flightId);
+    }
+}
+
+/**
+ * @brief Adds a record's flight, reservations, payments, passengers and boarding outcomes to the in-memory index.
+ */
+void ArchiveRepository::indexRecord(const FlightRecord& record, std::uint64_t offset) {
+    const std::string& flightId = record.flight -> getFlightId();
+    recordOffsets[flightId] = offset;
+    for (const auto& reservation : record.reservations) {
+        reservationFlights[reservation -> getReservationId()] = flightId;
+        indexPassengerFlight(reservation -> getPassengerId(), flightId);
+    }
+    for (const auto& payment : record.payments) {
+        paymentFlights[payment -> getPaymentId()] = flightId;
+    }
+    flightOutcomes[flightId] = countOutcomes(record);
+}
+
+/**
+ * @brief Appends the records of newly archived flights to the archive.
+ *
+ * The records are appended to the data file first, each compressed on its own; their
+ * index entries are appended afterwards, so an entry never refers to a record that was
+ * not fully written. Flights that are already archived are skipped.
+ *
+ * @param records The flights to archive, with their reservations and payments.
+ * @return std::size_t The number of flights added to the archive.
+ * @throws std::runtime_error If the data or index file cannot be written; flights whose
+ *         index entries were not written are not archived.
+ */
+std::size_t ArchiveRepository::archiveFlights(const std::vector<FlightRecord>& records) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    std::ofstream data(ARCHIVE_DATA_PATH, std::ios::binary | std::ios::app);
+    if (!data.is_open()) {
+        throw std::runtime_error("Archive \"" + ARCHIVE_DATA_PATH + "\" could not be opened for writing.");
+    }
+    data.seekp(0, std::ios::end);
+
+    std::vector<std::pair<const FlightRecord*, std::uint64_t>> written;
+    std::unordered_set<std::string> seen;
+    for (const auto& record : records) {
+        const std::string& flightId = record.flight -> getFlightId();
+        if (recordOffsets.count(flightId) != 0 || !seen.insert(flightId).second) {
+            continue;
+        }
+        const std::uint64_t offset = static_cast<std::uint64_t>(data.tellp());
+        BlockCompressingBuffer compressor(data.rdbuf());
+        std::ostream compressed(&compressor);
+        compressed << recordToJSON(record).dump();
+        compressor.finish();
+        written.emplace_back(&record, offset);
+    }
+    data.flush();
+    if (!data) {
+        throw std::runtime_error("Archive \"" + ARCHIVE_DATA_PATH + "\" could not be written.");
+    }
+
+    // A line left incomplete by a crash must not swallow the first entry appended after it
+    const bool complete = endsWithNewline(ARCHIVE_INDEX_PATH);
+    std::ofstream index(ARCHIVE_INDEX_PATH, std::ios::binary | std::ios::app);
+    if (!complete) {
+        index << '\n';
+    }
+    for (const auto& [record, offset] : written) {
+        JSON entry{{"flight", record -> flight -> getFlightId()}, {"offset", offset}, {"reservations", JSON::object()}, {"payments", JSON::array()}};
+        for (const auto& reservation : record -> reservations) {
+            entry["reservations"][reservation -> getReservationId()] = reservation -> getPassengerId();
+        }
+        for (const auto& payment : record -> payments) {
+            entry["payments"].push_back(payment -> getPaymentId());
+        }
+        const FlightOutcomes outcomes = countOutcomes(*record);
+        entry["origin"] = outcomes.origin;
+        entry["destination"] = outcomes.destination;
+        entry["boarded"] = outcomes.boarded;
+        entry["noShows"] = outcomes.noShows;
+        index << entry.dump() << '\n';
+    }
+    index.flush();
+    if (!index) {
+        throw std::runtime_error("Archive index \"" + ARCHIVE_INDEX_PATH + "\" could not be written.");
+    }
+    for (const auto& [record, offset] : written) {
+        indexRecord(*record, offset);
+    }
+    return written.size();
+}
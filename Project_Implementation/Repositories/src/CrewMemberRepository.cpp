@@ -1,4 +1,5 @@
 #include "../include/CrewMemberRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/IDGenerator.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
@@ -14,10 +15,14 @@ const std::string CREW_MEMBER_DATABASE_PATH = DatabasePathResolver::getDatabaseP
  * @brief Constructs a CrewMemberRepository object and initializes the crewMembers collection.
  *
  * This constructor loads crew member data from the JSON database file specified by
- * CREW_MEMBER_DATABASE_PATH using the JSONManager::parseJSON function.
+ * CREW_MEMBER_DATABASE_PATH using the JSONManager::parseJSON function, and indexes
+ * the crew members by name.
  */
 CrewMemberRepository::CrewMemberRepository() {
     JSONManager::parseJSON(crewMembers, CREW_MEMBER_DATABASE_PATH);
+    for (const auto& [id, crewMember] : crewMembers) {
+        namePrefixes.upsert(id, crewMember -> getName());
+    }
 }
 
 /**
@@ -97,6 +102,25 @@ std::vector<std::shared_ptr<CrewMemberModel>> CrewMemberRepository::findCrewMemb
 
     return members;
 }
+/**
+ * @brief Finds the crew members whose name starts with a prefix.
+ *
+ * The matches are read from the name prefix index, so only they are visited.
+ *
+ * @param prefix The prefix, matched case-insensitively.
+ * @param limit The maximum number of crew members returned.
+ * @return std::vector<std::shared_ptr<CrewMemberModel>> The first matching crew members, sorted by name.
+ */
+std::vector<std::shared_ptr<CrewMemberModel>> CrewMemberRepository::findCrewMembersByNamePrefix(const std::string& prefix, std::size_t limit) const {
+    std::vector<std::shared_ptr<CrewMemberModel>> members;
+    for ( const auto& crewId : namePrefixes.findByPrefix(prefix, limit) ) {
+        auto it = crewMembers.find(crewId);
+        if ( it != crewMembers.end() ) {
+            members.push_back(it -> second);
+        }
+    }
+    return members;
+}
 /**
  * @brief Adds a new crew member to the repository.
  *
@@ -114,6 +138,8 @@ bool CrewMemberRepository::addCrewMember(const CrewMemberModel& newCrewMember) {
         return false;
     }
     crewMembers[newCrewMember.getCrewId()] = std::make_shared<CrewMemberModel>(newCrewMember);
+    namePrefixes.upsert(newCrewMember.getCrewId(), newCrewMember.getName());
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::CrewMembers, newCrewMember);
     return true;
 }
 /**
@@ -131,6 +157,8 @@ bool CrewMemberRepository::updateCrewMember(const CrewMemberModel& crewMember) {
         return false;
     }
     crewMembers[crewMember.getCrewId()] = std::make_shared<CrewMemberModel>(crewMember);
+    namePrefixes.upsert(crewMember.getCrewId(), crewMember.getName());
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::CrewMembers, crewMember);
     return true;
 }
 /**
@@ -148,6 +176,8 @@ bool CrewMemberRepository::deleteCrewMember(const std::string& crewId) {
         return false;
     }
     crewMembers.erase(crewId);
+    namePrefixes.erase(crewId);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::CrewMembers, crewId);
     return true;
 }
 
@@ -161,6 +191,6 @@ bool CrewMemberRepository::deleteCrewMember(const std::string& crewId) {
  * before the repository is destroyed.
  */
 CrewMemberRepository::~CrewMemberRepository() {
-    JSONManager::saveToJSON(crewMembers, CREW_MEMBER_DATABASE_PATH);
+    JSONManager::saveToJSON(std::move(crewMembers), CREW_MEMBER_DATABASE_PATH);
     crewMembers.clear();
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include "../include/FlightRepository.hpp"
+#include "../include/ReservationRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
+#include "../../Utils/include/RuntimeOptions.hpp"
+#include <mutex>
 
 /**
  * @brief Path to the flight database JSON file.
@@ -14,10 +18,22 @@ const std::string FLIGHT_DATABASE_PATH = DatabasePathResolver::getDatabasePath()
  * @brief Constructs a FlightRepository object and initializes the flights data.
  *
  * This constructor parses the flight data from the JSON database file specified
- * by FLIGHT_DATABASE_PATH and populates the flights container using JSONManager.
+ * by FLIGHT_DATABASE_PATH using JSONManager and distributes the flights over the
+ * configured number of shards, and publishes them as the first snapshot version. Worker threads are only started when more than one
+ * shard is configured, after the initial data has been distributed.
  */
-FlightRepository::FlightRepository() {
+FlightRepository::FlightRepository() : shards(RuntimeOptions::getShardCount()) {
+    FlightMap flights;
     JSONManager::parseJSON(flights, FLIGHT_DATABASE_PATH);
+    for (auto& [id, flight] : flights) {
+        std::size_t shard = getShardForRoute(flight -> getOrigin(), flight -> getDestination());
+        flightShards[id] = shard;
+        publishVersion(*flight);
+        shards[shard][id] = std::move(flight);
+    }
+    if (shards.size() > 1) {
+        executor = std::make_unique<ShardExecutor>(shards.size());
+    }
 }
 
 /**
@@ -34,10 +50,137 @@ std::shared_ptr<FlightRepository> FlightRepository::getInstance() {
     return instance;
 }
 
+/**
+ * @brief Returns the shard owning a route.
+ *
+ * All flights between the same origin and destination live in the same shard, so a
+ * route search only ever involves a single shard.
+ *
+ * @param origin The origin of the route.
+ * @param destination The destination of the route.
+ * @return std::size_t The shard index.
+ */
+std::size_t FlightRepository::getShardForRoute(const std::string& origin, const std::string& destination) const {
+    std::size_t hash = std::hash<std::string>{}(origin);
+    hash ^= std::hash<std::string>{}(destination) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash % shards.size();
+}
+
+/**
+ * @brief Looks up the shard holding a flight in the flight-to-shard directory.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::size_t> The shard index, or std::nullopt if the flight does not exist.
+ */
+std::optional<std::size_t> FlightRepository::findShardOfFlight(const std::string& flightId) const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex);
+    auto it = flightShards.find(flightId);
+    if (it == flightShards.end()) {
+        return std::nullopt;
+    }
+    return it -> second;
+}
+
+/**
+ * @brief Records the shard of a flight in the directory.
+ */
+void FlightRepository::setFlightShard(const std::string& flightId, std::size_t shard) {
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    flightShards[flightId] = shard;
+}
+
+/**
+ * @brief Removes a flight from the directory.
+ */
+void FlightRepository::eraseFlightShard(const std::string& flightId) {
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    flightShards.erase(flightId);
+}
+
+/**
+ * @brief Publishes a committed flight to the snapshots and the secondary indexes.
+ *
+ * @param flight The flight as committed.
+ */
+void FlightRepository::publishVersion(const FlightModel& flight) {
+    versions.put(flight.getFlightId(), flight);
+    departures.upsert(flight.getFlightId(), flight.getDepartureTime());
+    originDepartures.upsert(flight.getFlightId(), {flight.getOrigin(), flight.getDepartureTime()});
+    fareCalendar.upsert(flight);
+}
+
+/**
+ * @brief Removes a deleted flight from the snapshots and the secondary indexes.
+ *
+ * @param flightId The unique identifier of the deleted flight.
+ */
+void FlightRepository::unpublishVersion(const std::string& flightId) {
+    versions.remove(flightId);
+    departures.erase(flightId);
+    originDepartures.erase(flightId);
+    fareCalendar.erase(flightId);
+}
+
+/**
+ * @brief Runs a task on the thread owning a shard and waits for it.
+ *
+ * With a single shard the task runs on the calling thread.
+ *
+ * @param shard The shard index.
+ * @param task The task to run.
+ */
+void FlightRepository::runOnShard(std::size_t shard, const std::function<void()>& task) const {
+    if (!executor) {
+        task();
+        return;
+    }
+    executor -> run(shard, task);
+}
+
+/**
+ * @brief Tells whether the calling thread is running a shard task.
+ *
+ * Work that has to wait on more than one shard must not run inside a task, since the
+ * worker of the other shard may be waiting on this one.
+ *
+ * @return true inside a shard task; false otherwise, and always without sharding.
+ */
+bool FlightRepository::isRunningOnShard() const {
+    return executor && ShardExecutor::isWorkerThread();
+}
+
+/**
+ * @brief Runs a task on every shard, in parallel when sharding is enabled, and waits for all of them.
+ *
+ * @param task The task to run; it receives the shard index.
+ */
+void FlightRepository::runOnAllShards(const std::function<void(std::size_t)>& task) const {
+    if (!executor) {
+        task(0);
+        return;
+    }
+    executor -> runOnAll(task);
+}
+
+/**
+ * @brief Runs a task on the thread owning a flight and waits for it.
+ *
+ * Used by the controllers to execute whole requests concerning one flight (booking,
+ * seat changes, crew changes) on the shard that owns the flight, its seat map and its
+ * reservations. Unknown flights are routed to the first shard, where the task will
+ * simply not find them.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param task The task to run.
+ */
+void FlightRepository::runOnFlightShard(const std::string& flightId, const std::function<void()>& task) const {
+    runOnShard(findShardOfFlight(flightId).value_or(0), task);
+}
+
 /**
  * @brief Finds a flight by its unique identifier.
  *
- * Searches the internal flight collection for a flight matching the provided flightId.
+ * Looks up the owning shard in the directory and searches that shard only.
  * If found, returns a shared pointer to the FlightModel instance wrapped in std::optional.
  * If not found, returns std::nullopt.
  *
@@ -45,47 +188,81 @@ std::shared_ptr<FlightRepository> FlightRepository::getInstance() {
  * @return std::optional<std::shared_ptr<FlightModel>> Shared pointer to the flight model if found, std::nullopt otherwise.
  */
 std::optional<std::shared_ptr<FlightModel>> FlightRepository::findFlightById(const std::string& flightId) const {
-    if (flights.find(flightId) == flights.end()) {
+    auto shard = findShardOfFlight(flightId);
+    if (!shard.has_value()) {
         return std::nullopt;
     }
-    return flights.at(flightId);
+    std::optional<std::shared_ptr<FlightModel>> result;
+    runOnShard(shard.value(), [&] {
+        auto it = shards[shard.value()].find(flightId);
+        if (it != shards[shard.value()].end()) {
+            result = it -> second;
+        }
+    });
+    return result;
 }
 /**
  * @brief Retrieves all flights stored in the repository.
  *
  * This method returns a vector containing shared pointers to all FlightModel
- * instances currently managed by the FlightRepository. Each element in the
- * returned vector represents a flight.
+ * instances currently managed by the FlightRepository. When sharding is enabled,
+ * every shard collects its flights in parallel and the results are concatenated.
  *
  * @return std::vector<std::shared_ptr<FlightModel>> A vector of shared pointers to FlightModel objects.
  */
 std::vector<std::shared_ptr<FlightModel>> FlightRepository::getAllFlights() const {
+    std::vector<std::vector<std::shared_ptr<FlightModel>>> perShard(shards.size());
+    runOnAllShards([&](std::size_t shard) {
+        perShard[shard].reserve(shards[shard].size());
+        for (const auto& pair : shards[shard]) {
+            perShard[shard].push_back(pair.second);
+        }
+    });
     std::vector<std::shared_ptr<FlightModel>> allFlights;
-    for (const auto& pair : flights) {
-        allFlights.push_back(pair.second);
+    for (auto& flights : perShard) {
+        allFlights.insert(allFlights.end(), flights.begin(), flights.end());
     }
     return allFlights;
 }
+/**
+ * @brief Retrieves the flights of a route departing on a given day.
+ *
+ * The flights are found through the fare calendar index, which also applies the
+ * availability filter from its free-seat counters, so neither the other flights of the
+ * shard nor any seat map is read. Only the shard owning the route is entered.
+ *
+ * @param origin The origin of the flight.
+ * @param destination The destination of the flight.
+ * @param departureDate The departure day.
+ * @param filter The seats the flights must have free; by default every flight matches.
+ * @return std::vector<std::shared_ptr<FlightModel>> The matching flights.
+ */
 std::vector<std::shared_ptr<FlightModel>> FlightRepository::getFlightsByCriteria (
             const std::string& origin,
             const std::string& destination,
-            const DateTime& departureDate
+            const DateTime& departureDate,
+            const AvailabilityFilter& filter
 ) {
     std::vector<std::shared_ptr<FlightModel>> filteredFlights;
-    for (const auto& pair : flights) {
-        const auto& flight = pair.second;
-        if (flight->getOrigin() == origin &&
-            flight->getDestination() == destination &&
-            flight -> getDepartureTime().sameDay(departureDate)) {
-            filteredFlights.push_back(flight);
-        }
+    auto flightIds = fareCalendar.findFlights(origin, destination, departureDate, filter);
+    if (flightIds.empty()) {
+        return filteredFlights;
     }
+    std::size_t shard = getShardForRoute(origin, destination);
+    runOnShard(shard, [&] {
+        for (const auto& flightId : flightIds) {
+            auto it = shards[shard].find(flightId);
+            if (it != shards[shard].end()) {
+                filteredFlights.push_back(it -> second);
+            }
+        }
+    });
     return filteredFlights;
 }
 /**
  * @brief Adds a new flight to the repository.
  *
- * This method attempts to add a new flight to the internal flights collection.
+ * This method attempts to add a new flight to the shard owning its route.
  * If a flight with the same flight ID already exists, the method returns false
  * and does not add the flight. Otherwise, the flight is added and the method returns true.
  *
@@ -93,10 +270,33 @@ std::vector<std::shared_ptr<FlightModel>> FlightRepository::getFlightsByCriteria
  * @return true if the flight was successfully added; false if a flight with the same ID already exists.
  */
 bool FlightRepository::addFlight(const FlightModel& newFlight) {
-    if (flights.find(newFlight.getFlightId()) != flights.end()) {
+    if (findShardOfFlight(newFlight.getFlightId()).has_value()) {
+        return false;
+    }
+    return emplaceFlight(std::make_shared<FlightModel>(newFlight));
+}
+/**
+ * @brief Adds a newly built flight to the repository without copying it.
+ *
+ * The repository takes shared ownership of the given flight, so the caller's pointer
+ * refers to the stored flight afterwards. Returns false and stores nothing if a flight
+ * with the same flight ID already exists.
+ *
+ * @param newFlight The flight to store, typically fresh from FlightModelBuilder::build() &&.
+ * @return true if the flight was successfully added; false if a flight with the same ID already exists.
+ */
+bool FlightRepository::emplaceFlight(std::shared_ptr<FlightModel> newFlight) {
+    const std::string& flightId = newFlight -> getFlightId();
+    if (findShardOfFlight(flightId).has_value()) {
         return false;
     }
-    flights[newFlight.getFlightId()] = std::make_shared<FlightModel>(newFlight);
+    std::size_t shard = getShardForRoute(newFlight -> getOrigin(), newFlight -> getDestination());
+    runOnShard(shard, [&] {
+        shards[shard].emplace(flightId, newFlight);
+    });
+    setFlightShard(flightId, shard);
+    publishVersion(*newFlight);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *newFlight);
     return true;
 }
 
@@ -105,16 +305,100 @@ bool FlightRepository::addFlight(const FlightModel& newFlight) {
  *
  * This method checks if a flight with the given flight ID exists in the repository.
  * If it exists, the flight information is updated with the provided flight model.
+ * If the route changed, the flight and its reservations move to the shard owning the new route.
  * If the flight does not exist, the method returns false and no update is performed.
  *
  * @param flight The FlightModel object containing updated flight information.
  * @return true if the flight was successfully updated; false if the flight does not exist.
  */
 bool FlightRepository::updateFlight(const FlightModel& flight) {
-    if (flights.find(flight.getFlightId()) == flights.end()) {
+    auto currentShard = findShardOfFlight(flight.getFlightId());
+    if (!currentShard.has_value()) {
+        return false;
+    }
+    std::size_t shard = getShardForRoute(flight.getOrigin(), flight.getDestination());
+    if (shard != currentShard.value()) {
+        runOnShard(currentShard.value(), [&] {
+            shards[currentShard.value()].erase(flight.getFlightId());
+        });
+        setFlightShard(flight.getFlightId(), shard);
+    }
+    runOnShard(shard, [&] {
+        shards[shard][flight.getFlightId()] = std::make_shared<FlightModel>(flight);
+    });
+    if (shard != currentShard.value()) {
+        ReservationRepository::getInstance() -> moveFlightReservations(flight.getFlightId(), currentShard.value(), shard);
+    }
+    publishVersion(flight);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, flight);
+    return true;
+}
+
+/**
+ * @brief Updates a flight only if nobody committed a change since it was read.
+ *
+ * Optimistic concurrency control: the update succeeds only if the stored flight is still
+ * at expectedVersion, in which case it is replaced by the given data with the version
+ * incremented. The check and the write run as one task on the thread owning the flight
+ * (see modifyFlight()); if the route changed, the flight moves shards after that task.
+ *
+ * @param flight The FlightModel object containing updated flight information.
+ * @param expectedVersion The version of the flight the update is based on.
+ * @return true if the flight was updated; false if it does not exist or was changed in the meantime.
+ */
+bool FlightRepository::compareAndSetFlight(const FlightModel& flight, std::uint64_t expectedVersion) {
+    return modifyFlight(flight.getFlightId(), [&flight, expectedVersion](FlightModel& stored) {
+        if (stored.getVersion() != expectedVersion) {
+            return false;
+        }
+        stored = flight;
+        stored.setVersion(expectedVersion);
+        return true;
+    });
+}
+
+/**
+ * @brief Changes a stored flight in place.
+ *
+ * The mutator runs on the thread owning the flight and receives the stored flight itself,
+ * so no copy of the flight is made. It returns false if it made no change, in which case
+ * nothing is committed. Otherwise the version is incremented, the change is published to
+ * the snapshots and the mutation log, and the flight moves shards if its route changed.
+ *
+ * @param flightId The unique identifier of the flight to change.
+ * @param mutate Applies the change; returns whether anything changed.
+ * @return true if the flight exists and was changed; false otherwise.
+ */
+bool FlightRepository::modifyFlight(const std::string& flightId, const std::function<bool(FlightModel&)>& mutate) {
+    auto shard = findShardOfFlight(flightId);
+    if (!shard.has_value()) {
+        return false;
+    }
+    std::shared_ptr<FlightModel> flight;
+    runOnShard(shard.value(), [&] {
+        auto it = shards[shard.value()].find(flightId);
+        if (it == shards[shard.value()].end() || !mutate(*it -> second)) {
+            return;
+        }
+        flight = it -> second;
+        flight -> setVersion(flight -> getVersion() + 1);
+        publishVersion(*flight);
+    });
+    if (!flight) {
         return false;
     }
-    flights[flight.getFlightId()] = std::make_shared<FlightModel>(flight);
+    std::size_t newShard = getShardForRoute(flight -> getOrigin(), flight -> getDestination());
+    if (newShard != shard.value()) {
+        runOnShard(shard.value(), [&] {
+            shards[shard.value()].erase(flightId);
+        });
+        runOnShard(newShard, [&] {
+            shards[newShard][flightId] = flight;
+        });
+        setFlightShard(flightId, newShard);
+        ReservationRepository::getInstance() -> moveFlightReservations(flightId, shard.value(), newShard);
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
     return true;
 }
 
@@ -122,20 +406,123 @@ bool FlightRepository::updateFlight(const FlightModel& flight) {
  * @brief Deletes a flight from the repository by its flight ID.
  *
  * This method searches for a flight with the specified flight ID in the repository.
- * If the flight exists, it is removed from the repository and the method returns true.
+ * If the flight exists, it is removed from its shard and the method returns true.
  * If the flight does not exist, the method returns false.
  *
  * @param flightId The unique identifier of the flight to be deleted.
  * @return true if the flight was found and deleted; false otherwise.
  */
 bool FlightRepository::deleteFlight(const std::string& flightId) {
-    if (flights.find(flightId) == flights.end()) {
+    auto shard = findShardOfFlight(flightId);
+    if (!shard.has_value()) {
         return false;
     }
-    flights.erase(flightId);
+    runOnShard(shard.value(), [&] {
+        shards[shard.value()].erase(flightId);
+    });
+    eraseFlightShard(flightId);
+    unpublishVersion(flightId);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Flights, flightId);
     return true;
 }
 
+/**
+ * @brief Publishes the current state of a flight that was changed in place.
+ *
+ * Services that modify a stored flight directly (seat bookings, crew assignments) call
+ * this after the change is complete. The stored flight's version is incremented, so that
+ * updates based on an older copy are rejected, and snapshots taken from now on include it.
+ *
+ * @param flight The changed flight.
+ */
+void FlightRepository::commitVersion(const FlightModel& flight) {
+    auto shard = findShardOfFlight(flight.getFlightId());
+    if (!shard.has_value()) {
+        return;
+    }
+    runOnShard(shard.value(), [&] {
+        auto it = shards[shard.value()].find(flight.getFlightId());
+        if (it == shards[shard.value()].end()) {
+            return;
+        }
+        it -> second -> setVersion(it -> second -> getVersion() + 1);
+        publishVersion(*it -> second);
+    });
+}
+
+/**
+ * @brief Returns one page of flights sorted by departure time, then flight ID.
+ *
+ * The page is located through the departure index in O(log n) and its flights are read
+ * from a snapshot, so listing never waits for shard workers. Flights deleted between the
+ * index lookup and the read are skipped.
+ *
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of flights in the page.
+ * @return FlightPage The flights of the page and, unless it is the last one, the cursor of the next.
+ */
+FlightRepository::FlightPage FlightRepository::getFlightsByDeparture(const std::optional<DepartureCursor>& after, std::size_t limit) const {
+    auto snapshot = takeSnapshot();
+    auto page = departures.page(after, limit);
+    FlightPage result;
+    result.rows.reserve(page.ids.size());
+    for (const auto& flightId : page.ids) {
+        auto flight = snapshot.find(flightId);
+        if (flight.has_value()) {
+            result.rows.push_back(flight.value());
+        }
+    }
+    result.next = page.next;
+    return result;
+}
+
+/**
+ * @brief Retrieves the flights leaving an airport at or after a given time, sorted by departure time.
+ *
+ * The flights are found through the index by origin and departure time and read from a
+ * snapshot, so only the matching flights are visited and no shard is entered.
+ *
+ * @param origin The airport the flights leave from.
+ * @param earliest The earliest departure time.
+ * @return std::vector<std::shared_ptr<const FlightModel>> The flights as of their last commit.
+ */
+std::vector<std::shared_ptr<const FlightModel>> FlightRepository::getFlightsDepartingFrom(const std::string& origin, const DateTime& earliest) const {
+    auto snapshot = takeSnapshot();
+    std::vector<std::shared_ptr<const FlightModel>> flights;
+    originDepartures.scanFrom({origin, earliest}, [&](const std::pair<std::string, DateTime>& key, const std::string& flightId) {
+        if (key.first != origin) {
+            return false;
+        }
+        auto flight = snapshot.find(flightId);
+        if (flight.has_value()) {
+            flights.push_back(flight.value());
+        }
+        return true;
+    });
+    return flights;
+}
+
+/**
+ * @brief Retrieves the free seats and lowest fare of a route on consecutive days.
+ *
+ * The days are read from the fare calendar index in one pass; no flight and no shard
+ * is visited.
+ *
+ * @param origin The origin of the route.
+ * @param destination The destination of the route.
+ * @param firstDay The first day of the window.
+ * @param numberOfDays The number of days of the window.
+ * @return std::vector<FareCalendarDay> One entry per day of the window, in order.
+ */
+std::vector<FareCalendarDay> FlightRepository::getFareCalendar(
+    const std::string& origin,
+    const std::string& destination,
+    const DateTime& firstDay,
+    std::size_t numberOfDays
+) const {
+    return fareCalendar.getCalendar(origin, destination, firstDay, numberOfDays);
+}
+
 /**
  * @brief Destructor for the FlightRepository class.
  *
@@ -145,6 +532,11 @@ bool FlightRepository::deleteFlight(const std::string& flightId) {
  * to the file specified by FLIGHT_DATABASE_PATH using the JSONManager utility.
  */
 FlightRepository::~FlightRepository() {
-    JSONManager::saveToJSON(flights, FLIGHT_DATABASE_PATH);
-    flights.clear();
+    executor.reset();
+    FlightMap flights;
+    for (auto& shard : shards) {
+        flights.merge(shard);
+    }
+    JSONManager::saveToJSON(std::move(flights), FLIGHT_DATABASE_PATH);
+    shards.clear();
 }
\ No newline at end of file
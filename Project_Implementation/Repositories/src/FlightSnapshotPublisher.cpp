@@ -0,0 +1,267 @@
+#include "../include/FlightSnapshotPublisher.hpp"
+#include "../include/FlightSnapshotLayout.hpp"
+#include "../include/FlightRepository.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <tuple>
+#include <vector>
+
+using Layout = FlightSnapshotLayout;
+
+/**
+ * @brief Returns a typed pointer to the object stored at a byte offset from a base address.
+ */
+template<typename T>
+static T* at(void* base, std::size_t offset) {
+    return static_cast<T*>(static_cast<void*>(static_cast<char*>(base) + offset));
+}
+
+/**
+ * @brief Copies a string into a fixed-size, NUL-padded record field.
+ */
+static void copyField(char* destination, std::size_t capacity, const std::string& value) {
+    std::memset(destination, 0, capacity);
+    std::memcpy(destination, value.data(), value.size());
+}
+
+/**
+ * @brief Copies the components of a DateTime into a record field.
+ */
+static void copyDateTime(std::int32_t* destination, const DateTime& value) {
+    destination[0] = value.year;
+    destination[1] = value.month;
+    destination[2] = value.day;
+    destination[3] = value.hour;
+    destination[4] = value.minute;
+}
+
+/**
+ * @brief Returns the sort key used to order snapshot records by route and departure time.
+ */
+static auto routeKey(const FlightModel& flight) {
+    const DateTime& departure = flight.getDepartureTime();
+    return std::tie(flight.getOrigin(), flight.getDestination(),
+                    departure.year, departure.month, departure.day, departure.hour, departure.minute);
+}
+
+/**
+ * @brief Constructs the publisher, creating the FlightRepository first so that it outlives the publisher thread.
+ */
+FlightSnapshotPublisher::FlightSnapshotPublisher() {
+    FlightRepository::getInstance();
+}
+
+/**
+ * @brief Returns the singleton instance of FlightSnapshotPublisher.
+ *
+ * @return std::shared_ptr<FlightSnapshotPublisher> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<FlightSnapshotPublisher> FlightSnapshotPublisher::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<FlightSnapshotPublisher> instance(new FlightSnapshotPublisher());
+    return instance;
+}
+
+/**
+ * @brief Creates the shared memory segment, publishes the first snapshot and starts the publisher thread.
+ *
+ * The segment header is initialized before the first publication so that readers
+ * attaching early see an empty but well-formed snapshot rather than garbage.
+ *
+ * @param segmentName Name of the shared memory segment to create.
+ * @throws std::runtime_error If the segment cannot be created.
+ */
+void FlightSnapshotPublisher::enable(const std::string& segmentName) {
+    segment = std::make_unique<SharedMemorySegment>(segmentName, Layout::SEGMENT_BYTES);
+
+    void* base = segment -> data();
+    for (std::uint32_t slot = 0; slot < 2; slot++) {
+        new (at<void>(base, Layout::slotOffset(slot))) Layout::SlotHeader();
+    }
+    auto* header = new (base) Layout::Header();
+    header -> magic = Layout::MAGIC;
+    header -> layoutVersion = Layout::LAYOUT_VERSION;
+    header -> slotBytes = Layout::SLOT_BYTES;
+    header -> activeSlot.store(0, std::memory_order_release);
+    header -> publishedEpoch.store(0, std::memory_order_release);
+
+    publish();
+    publisherThread = std::thread(&FlightSnapshotPublisher::publisherLoop, this);
+}
+
+/**
+ * @brief Publisher thread: publishes a snapshot whenever it is stale, at most once per PUBLISH_INTERVAL.
+ */
+void FlightSnapshotPublisher::publisherLoop() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    while (true) {
+        stateChanged.wait(lock, [this] { return stopping || stale; });
+        if (stopping) {
+            return;
+        }
+        stale = false;
+        lock.unlock();
+        publish();
+        lock.lock();
+        // Changes made during the interval are folded into the next snapshot
+        stateChanged.wait_for(lock, PUBLISH_INTERVAL, [this] { return stopping; });
+    }
+}
+
+/**
+ * @brief Publishes a new snapshot of all flights and their seat maps.
+ *
+ * The flights are read from a point-in-time snapshot of the FlightRepository, so the
+ * published data is consistent even while other shards keep committing.
+ * The snapshot is written into the inactive slot, whose sequence number is odd for the
+ * duration of the write. Once complete, the slot becomes the active one and the
+ * published epoch is incremented. Flights whose identifiers or locations do not fit the
+ * fixed-size record fields are left out of the snapshot and reported.
+ *
+ * Publications are serialized: the publisher thread and enable() may both publish.
+ *
+ * @return true if a snapshot was published; false if publication is disabled or the
+ *         flights do not fit in the segment, in which case the previous snapshot stays
+ *         active and the overflow is reported.
+ */
+bool FlightSnapshotPublisher::publish() {
+    std::lock_guard<std::mutex> lock(publishMutex);
+    if (!segment) {
+        return false;
+    }
+
+    std::vector<std::shared_ptr<const FlightModel>> flights;
+    std::size_t seatBytes = 0;
+    std::size_t skipped = 0;
+    FlightRepository::getInstance() -> takeSnapshot().forEach([&](const std::shared_ptr<const FlightModel>& flight) {
+        if (flight -> getFlightId().size() >= Layout::ID_LENGTH ||
+            flight -> getOrigin().size() >= Layout::LOCATION_LENGTH ||
+            flight -> getDestination().size() >= Layout::LOCATION_LENGTH) {
+            skipped++;
+            return;
+        }
+        const auto& seatMap = flight -> getSeatMap();
+        std::size_t seats = seatMap.empty() ? 0 : seatMap.size() * seatMap[0].size();
+        seatBytes += (seats + 7) / 8;
+        flights.push_back(flight);
+    });
+    if (skipped != skippedFlights) {
+        skippedFlights = skipped;
+        if (skipped > 0) {
+            std::cerr << "Warning: " << skipped << " flight(s) left out of the published snapshot: flight IDs must be shorter than "
+                      << Layout::ID_LENGTH << " characters and locations shorter than " << Layout::LOCATION_LENGTH << "." << std::endl;
+        }
+    }
+    const bool overflow = flights.size() > Layout::MAX_FLIGHTS || seatBytes > Layout::MAX_SEAT_BYTES;
+    if (overflow != overflowing) {
+        overflowing = overflow;
+        if (overflow) {
+            std::cerr << "Warning: " << flights.size() << " flights with " << seatBytes << " bytes of seats exceed the snapshot segment ("
+                      << Layout::MAX_FLIGHTS << " flights, " << Layout::MAX_SEAT_BYTES << " bytes); replicas keep serving the snapshot of epoch "
+                      << publishedEpoch.load() << "." << std::endl;
+        }
+        else {
+            std::cerr << "Snapshot publication resumed." << std::endl;
+        }
+    }
+    if (overflow) {
+        return false;
+    }
+    std::sort(flights.begin(), flights.end(), [](const auto& lhs, const auto& rhs) {
+        return routeKey(*lhs) < routeKey(*rhs);
+    });
+
+    void* base = segment -> data();
+    auto* header = at<Layout::Header>(base, 0);
+    std::uint32_t target = 1 - header -> activeSlot.load(std::memory_order_relaxed);
+    void* slotBase = at<void>(base, Layout::slotOffset(target));
+    auto* slot = at<Layout::SlotHeader>(slotBase, 0);
+    auto* records = at<Layout::FlightRecord>(slotBase, Layout::RECORDS_OFFSET);
+    auto* idOrder = at<std::uint32_t>(slotBase, Layout::ID_ORDER_OFFSET);
+    auto* seats = at<unsigned char>(slotBase, Layout::SEATS_OFFSET);
+
+    std::uint64_t sequence = slot -> sequence.load(std::memory_order_relaxed);
+    slot -> sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::uint32_t seatOffset = 0;
+    for (std::size_t index = 0; index < flights.size(); index++) {
+        const FlightModel& flight = *flights[index];
+        Layout::FlightRecord& record = records[index];
+        copyField(record.flightId, Layout::ID_LENGTH, flight.getFlightId());
+        copyField(record.origin, Layout::LOCATION_LENGTH, flight.getOrigin());
+        copyField(record.destination, Layout::LOCATION_LENGTH, flight.getDestination());
+        copyDateTime(record.departure, flight.getDepartureTime());
+        copyDateTime(record.arrival, flight.getArrivalTime());
+
+        const auto& seatMap = flight.getSeatMap();
+        record.rows = static_cast<std::uint16_t>(seatMap.size());
+        record.seatsPerRow = static_cast<std::uint16_t>(seatMap.empty() ? 0 : seatMap[0].size());
+        record.seatOffset = seatOffset;
+
+        std::size_t seatCount = static_cast<std::size_t>(record.rows) * record.seatsPerRow;
+        std::size_t byteCount = (seatCount + 7) / 8;
+        std::memset(seats + seatOffset, 0, byteCount);
+        std::size_t bit = 0;
+        for (const auto& row : seatMap) {
+            for (bool occupied : row) {
+                if (occupied) {
+                    seats[seatOffset + bit / 8] = static_cast<unsigned char>(seats[seatOffset + bit / 8] | (1u << (bit % 8)));
+                }
+                bit++;
+            }
+        }
+        seatOffset += static_cast<std::uint32_t>(byteCount);
+        idOrder[index] = static_cast<std::uint32_t>(index);
+    }
+    std::sort(idOrder, idOrder + flights.size(), [records](std::uint32_t lhs, std::uint32_t rhs) {
+        return std::strncmp(records[lhs].flightId, records[rhs].flightId, Layout::ID_LENGTH) < 0;
+    });
+
+    const std::uint64_t epoch = publishedEpoch.load() + 1;
+    slot -> epoch = epoch;
+    slot -> flightCount = static_cast<std::uint32_t>(flights.size());
+    slot -> seatBytesUsed = seatOffset;
+    slot -> sequence.store(sequence + 2, std::memory_order_release);
+
+    header -> activeSlot.store(target, std::memory_order_release);
+    header -> publishedEpoch.store(epoch, std::memory_order_release);
+    publishedEpoch.store(epoch);
+    return true;
+}
+
+/**
+ * @brief Marks the published snapshot stale if publication has been enabled.
+ *
+ * Intended to be called by services after every successful change to flights or seats.
+ * Returns at once; the publisher thread publishes the change within PUBLISH_INTERVAL.
+ *
+ * @return true if a publication was scheduled; false if publication is disabled.
+ */
+bool FlightSnapshotPublisher::publishIfEnabled() {
+    if (!isEnabled()) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stale = true;
+    }
+    stateChanged.notify_one();
+    return true;
+}
+
+/**
+ * @brief Destructor. Stops the publisher thread; changes not yet published are dropped with the process.
+ */
+FlightSnapshotPublisher::~FlightSnapshotPublisher() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    stateChanged.notify_all();
+    if (publisherThread.joinable()) {
+        publisherThread.join();
+    }
+}
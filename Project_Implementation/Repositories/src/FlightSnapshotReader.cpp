@@ -0,0 +1,198 @@
+#include "../include/FlightSnapshotReader.hpp"
+#include "../include/FlightSnapshotLayout.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+using Layout = FlightSnapshotLayout;
+
+/**
+ * @brief Returns a typed pointer to the object stored at a byte offset from a base address.
+ */
+template<typename T>
+static const T* at(const void* base, std::size_t offset) {
+    return static_cast<const T*>(static_cast<const void*>(static_cast<const char*>(base) + offset));
+}
+
+/**
+ * @brief Reads a NUL-padded record field into a string.
+ */
+static std::string readField(const char* field, std::size_t capacity) {
+    return std::string(field, strnlen(field, capacity));
+}
+
+/**
+ * @brief Converts a record date field back into a DateTime.
+ */
+static DateTime readDateTime(const std::int32_t* field) {
+    return DateTime(field[0], field[1], field[2], field[3], field[4]);
+}
+
+/**
+ * @brief Returns whether a seat map stored in a record lies within the slot's seat area.
+ */
+static bool seatsInBounds(const Layout::FlightRecord& record) {
+    std::size_t byteCount = (static_cast<std::size_t>(record.rows) * record.seatsPerRow + 7) / 8;
+    return static_cast<std::size_t>(record.seatOffset) + byteCount <= Layout::MAX_SEAT_BYTES;
+}
+
+/**
+ * @brief Attaches to a published flight snapshot segment.
+ *
+ * @param segmentName Name of the shared memory segment created by the primary process.
+ *
+ * @throws std::runtime_error If the segment cannot be opened or does not contain a
+ *         flight snapshot with a compatible layout.
+ */
+FlightSnapshotReader::FlightSnapshotReader(const std::string& segmentName) : segment(segmentName) {
+    if (segment.getSize() < Layout::SEGMENT_BYTES) {
+        throw std::runtime_error("Shared memory segment \"" + segmentName + "\" is too small for a flight snapshot.");
+    }
+    const auto* header = at<Layout::Header>(segment.data(), 0);
+    if (header -> magic != Layout::MAGIC || header -> layoutVersion != Layout::LAYOUT_VERSION ||
+        header -> slotBytes != Layout::SLOT_BYTES) {
+        throw std::runtime_error("Shared memory segment \"" + segmentName + "\" does not hold a compatible flight snapshot.");
+    }
+}
+
+/**
+ * @brief Runs a query against the active slot and retries until it observed a stable snapshot.
+ *
+ * The slot's sequence number is read before and after the query; an odd value or a
+ * change between the two reads means the publisher was rewriting the slot, in which
+ * case the partial result is discarded and the query runs again on the new active slot.
+ *
+ * @param query Callable receiving the slot base address and its header.
+ * @return The result of the first query that completed on a stable snapshot.
+ */
+template<typename Query>
+auto FlightSnapshotReader::readConsistent(Query&& query) const {
+    const void* base = segment.data();
+    const auto* header = at<Layout::Header>(base, 0);
+    while (true) {
+        std::uint32_t active = header -> activeSlot.load(std::memory_order_acquire) & 1u;
+        const void* slotBase = at<void>(base, Layout::slotOffset(active));
+        const auto* slot = at<Layout::SlotHeader>(slotBase, 0);
+
+        std::uint64_t before = slot -> sequence.load(std::memory_order_acquire);
+        if (before % 2 == 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto result = query(slotBase, *slot);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot -> sequence.load(std::memory_order_relaxed) == before) {
+            return result;
+        }
+    }
+}
+
+/**
+ * @brief Returns the epoch of the most recently published snapshot.
+ *
+ * @return std::uint64_t The published epoch; 0 if nothing has been published yet.
+ */
+std::uint64_t FlightSnapshotReader::getEpoch() const {
+    return at<Layout::Header>(segment.data(), 0) -> publishedEpoch.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Retrieves the flights of a route departing on a given day from the active snapshot.
+ *
+ * Records are sorted by route and departure time, so the matching flights are located
+ * with a binary search and form a contiguous range.
+ *
+ * @param origin The origin of the flight.
+ * @param destination The destination of the flight.
+ * @param departureDate The departure day; the time of day is ignored.
+ * @return std::vector<FlightSnapshotEntry> The matching flights, ordered by departure time.
+ */
+std::vector<FlightSnapshotEntry> FlightSnapshotReader::getFlightsByRouteAndDate(
+    const std::string& origin,
+    const std::string& destination,
+    const DateTime& departureDate
+) const {
+    return readConsistent([&](const void* slotBase, const Layout::SlotHeader& slot) {
+        std::vector<FlightSnapshotEntry> result;
+        const auto* records = at<Layout::FlightRecord>(slotBase, Layout::RECORDS_OFFSET);
+        const auto* seats = at<unsigned char>(slotBase, Layout::SEATS_OFFSET);
+        std::size_t count = std::min<std::size_t>(slot.flightCount, Layout::MAX_FLIGHTS);
+
+        auto compareRoute = [&](const Layout::FlightRecord& record) {
+            int cmp = std::strncmp(record.origin, origin.c_str(), Layout::LOCATION_LENGTH);
+            if (cmp == 0) {
+                cmp = std::strncmp(record.destination, destination.c_str(), Layout::LOCATION_LENGTH);
+            }
+            return cmp;
+        };
+        const std::int32_t day[3] = {departureDate.year, departureDate.month, departureDate.day};
+        const auto* first = std::lower_bound(records, records + count, 0, [&](const Layout::FlightRecord& record, int) {
+            int cmp = compareRoute(record);
+            if (cmp != 0) {
+                return cmp < 0;
+            }
+            return std::lexicographical_compare(record.departure, record.departure + 3, day, day + 3);
+        });
+
+        for (const auto* record = first; record != records + count; record++) {
+            if (compareRoute(*record) != 0 || !std::equal(day, day + 3, record -> departure)) {
+                break;
+            }
+            int occupied = 0;
+            if (seatsInBounds(*record)) {
+                std::size_t byteCount = (static_cast<std::size_t>(record -> rows) * record -> seatsPerRow + 7) / 8;
+                for (std::size_t byte = 0; byte < byteCount; byte++) {
+                    for (unsigned char bits = seats[record -> seatOffset + byte]; bits != 0; bits = static_cast<unsigned char>(bits & (bits - 1))) {
+                        occupied++;
+                    }
+                }
+            }
+            result.push_back(FlightSnapshotEntry{
+                readField(record -> flightId, Layout::ID_LENGTH),
+                readField(record -> origin, Layout::LOCATION_LENGTH),
+                readField(record -> destination, Layout::LOCATION_LENGTH),
+                readDateTime(record -> departure),
+                readDateTime(record -> arrival),
+                record -> rows * record -> seatsPerRow - occupied
+            });
+        }
+        return result;
+    });
+}
+
+/**
+ * @brief Retrieves the seat map of a flight from the active snapshot.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::vector<std::vector<bool>>> The seat map (true meaning occupied)
+ *         if the flight is part of the snapshot, std::nullopt otherwise.
+ */
+std::optional<std::vector<std::vector<bool>>> FlightSnapshotReader::getSeatMap(const std::string& flightId) const {
+    return readConsistent([&](const void* slotBase, const Layout::SlotHeader& slot) -> std::optional<std::vector<std::vector<bool>>> {
+        const auto* records = at<Layout::FlightRecord>(slotBase, Layout::RECORDS_OFFSET);
+        const auto* idOrder = at<std::uint32_t>(slotBase, Layout::ID_ORDER_OFFSET);
+        const auto* seats = at<unsigned char>(slotBase, Layout::SEATS_OFFSET);
+        std::size_t count = std::min<std::size_t>(slot.flightCount, Layout::MAX_FLIGHTS);
+
+        const auto* position = std::lower_bound(idOrder, idOrder + count, flightId, [&](std::uint32_t index, const std::string& id) {
+            return index < count && std::strncmp(records[index].flightId, id.c_str(), Layout::ID_LENGTH) < 0;
+        });
+        if (position == idOrder + count || *position >= count ||
+            std::strncmp(records[*position].flightId, flightId.c_str(), Layout::ID_LENGTH) != 0) {
+            return std::nullopt;
+        }
+        const Layout::FlightRecord& record = records[*position];
+        if (!seatsInBounds(record)) {
+            return std::nullopt;
+        }
+        std::vector<std::vector<bool>> seatMap(record.rows, std::vector<bool>(record.seatsPerRow, false));
+        std::size_t bit = 0;
+        for (auto& row : seatMap) {
+            for (std::size_t column = 0; column < row.size(); column++, bit++) {
+                row[column] = (seats[record.seatOffset + bit / 8] >> (bit % 8)) & 1u;
+            }
+        }
+        return seatMap;
+    });
+}
@@ -0,0 +1,178 @@
+#include "../include/MutationLog.hpp"
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Returns the singleton instance of MutationLog.
+ *
+ * @return std::shared_ptr<MutationLog> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<MutationLog> MutationLog::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<MutationLog> instance(new MutationLog());
+    return instance;
+}
+
+/**
+ * @brief Returns the name under which a table appears in log records.
+ *
+ * The names match the database file names without their extension.
+ *
+ * @param table The table.
+ * @return const char* The table name.
+ */
+const char* MutationLog::tableName(Table table) {
+    switch (table) {
+        case Table::Aircraft:       return "aircrafts";
+        case Table::CrewMembers:    return "crew_members";
+        case Table::Flights:        return "flights";
+        case Table::Payments:       return "payments";
+        case Table::Reservations:   return "reservations";
+        case Table::Users:          return "users";
+        case Table::Waitlists:      return "waitlists";
+    }
+    return "";
+}
+
+/**
+ * @brief Resolves a table name found in a log record.
+ *
+ * @param name The table name.
+ * @return std::optional<Table> The table, or std::nullopt if the name is unknown.
+ */
+std::optional<MutationLog::Table> MutationLog::tableFromName(const std::string& name) {
+    for (Table table : {Table::Aircraft, Table::CrewMembers, Table::Flights,
+                        Table::Payments, Table::Reservations, Table::Users, Table::Waitlists}) {
+        if (name == tableName(table)) {
+            return table;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Creates the spill file and starts recording mutations. Changes made before this call are not logged.
+ *
+ * @throws std::runtime_error If the spill file cannot be created.
+ */
+void MutationLog::enable() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!spill.is_open()) {
+            std::ostringstream name;
+            name << "airline_mutation_log_" << std::hex << std::chrono::system_clock::now().time_since_epoch().count();
+            spillPath = (std::filesystem::temp_directory_path() / name.str()).string();
+            spill.open(spillPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!spill.is_open()) {
+                throw std::runtime_error("Mutation log \"" + spillPath + "\" could not be created.");
+            }
+        }
+    }
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Encodes a record, assigns it the next LSN and wakes up waiting readers.
+ *
+ * Records carry their commit time (microseconds since the Unix epoch) so that a
+ * follower on the same machine can measure its replication lag. The record is written
+ * to the spill file and kept in the in-memory tail, which drops its oldest record once
+ * it holds TAIL_RECORDS.
+ *
+ * @param table The table the entity belongs to.
+ * @param operation Whether the entity was upserted or deleted.
+ * @param id The entity identifier.
+ * @param data The entity image for upserts; null for deletes.
+ * @throws std::runtime_error If the record cannot be written to the spill file.
+ */
+void MutationLog::append(Table table, Operation operation, const std::string& id, JSON data) {
+    auto commitTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    JSON record = {
+        {"commitTime", commitTime},
+        {"table", tableName(table)},
+        {"op", (operation == Operation::Upsert) ? "upsert" : "delete"},
+        {"id", id},
+        {"data", std::move(data)}
+    };
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        record["lsn"] = offsets.size() + 1;
+        std::string encoded = record.dump();
+        spill.seekp(static_cast<std::streamoff>(spillSize));
+        spill.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+        spill.put('\n');
+        if (!spill) {
+            throw std::runtime_error("Mutation log \"" + spillPath + "\" could not be written.");
+        }
+        offsets.push_back(spillSize);
+        spillSize += encoded.size() + 1;
+        tail.push_back(std::move(encoded));
+        if (tail.size() > TAIL_RECORDS) {
+            tail.pop_front();
+        }
+    }
+    recordAppended.notify_all();
+}
+
+/**
+ * @brief Records that an entity was deleted.
+ *
+ * @param table The table the entity belonged to.
+ * @param id The identifier of the deleted entity.
+ */
+void MutationLog::recordDelete(Table table, const std::string& id) {
+    if (!isEnabled()) {
+        return;
+    }
+    append(table, Operation::Delete, id, nullptr);
+}
+
+/**
+ * @brief Returns the LSN of the most recent record.
+ *
+ * @return std::uint64_t The last LSN; 0 if nothing has been logged.
+ */
+std::uint64_t MutationLog::getLastLsn() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return offsets.size();
+}
+
+/**
+ * @brief Returns the encoded record with the given LSN, waiting for it to be appended.
+ *
+ * Recent records come from the in-memory tail; older ones are read back from the spill file.
+ *
+ * @param lsn The log sequence number to read (starting at 1).
+ * @param timeout Maximum time to wait for the record.
+ * @return std::optional<std::string> The JSON-encoded record, or std::nullopt on timeout.
+ */
+std::optional<std::string> MutationLog::waitForRecord(std::uint64_t lsn, std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!recordAppended.wait_for(lock, timeout, [&] { return offsets.size() >= lsn; }) || lsn == 0) {
+        return std::nullopt;
+    }
+    const std::uint64_t firstTailLsn = offsets.size() - tail.size() + 1;
+    if (lsn >= firstTailLsn) {
+        return tail[lsn - firstTailLsn];
+    }
+    std::string record;
+    spill.seekg(static_cast<std::streamoff>(offsets[lsn - 1]));
+    std::getline(spill, record);
+    if (!spill) {
+        throw std::runtime_error("Mutation log \"" + spillPath + "\" could not be read.");
+    }
+    return record;
+}
+
+/**
+ * @brief Destructor. Removes the spill file.
+ */
+MutationLog::~MutationLog() {
+    if (spill.is_open()) {
+        spill.close();
+        std::error_code error;
+        std::filesystem::remove(spillPath, error);
+    }
+}
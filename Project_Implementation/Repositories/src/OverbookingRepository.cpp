@@ -0,0 +1,218 @@
+#include "../include/OverbookingRepository.hpp"
+#include "../include/ArchiveRepository.hpp"
+#include "../include/FlightRepository.hpp"
+#include "../include/ReservationRepository.hpp"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Constructs the OverbookingRepository from the stored reservations.
+ *
+ * Boarded and no-show reservations are counted into the statistics of their flight's
+ * route; confirmed reservations without a seat are queued for the next freed seat.
+ * Reservations are collected first and their flights looked up afterwards, so that no
+ * shard is entered from another shard's thread. The outcomes of archived flights are
+ * added from the archive index, except for a flight still in the working set, whose
+ * reservations were already counted.
+ */
+OverbookingRepository::OverbookingRepository() {
+    struct Outcome {
+        std::string reservationId;
+        std::string flightId;
+        ReservationModel::ReservationStatus status;
+        bool hasSeat;
+    };
+    std::vector<Outcome> outcomes;
+    ReservationRepository::getInstance() -> forEachReservation([&outcomes](const ReservationModel& reservation) {
+        outcomes.push_back({reservation.getReservationId(), reservation.getFlightId(), reservation.getStatus(), reservation.hasSeat()});
+    });
+    auto flightRepository = FlightRepository::getInstance();
+    for (const auto& outcome : outcomes) {
+        if (outcome.status == ReservationModel::ReservationStatus::CONFIRMED) {
+            if (!outcome.hasSeat) {
+                unassigned[outcome.flightId].push_back(outcome.reservationId);
+            }
+            continue;
+        }
+        if (outcome.status != ReservationModel::ReservationStatus::BOARDED &&
+            outcome.status != ReservationModel::ReservationStatus::NO_SHOW) {
+            continue;
+        }
+        auto flight = flightRepository -> findFlightById(outcome.flightId);
+        if (!flight.has_value()) {
+            continue;
+        }
+        auto& statistics = routes[getRouteKey(flight.value() -> getOrigin(), flight.value() -> getDestination())];
+        if (outcome.status == ReservationModel::ReservationStatus::BOARDED) {
+            statistics.boarded++;
+        } else {
+            statistics.noShows++;
+        }
+    }
+    for (const auto& [flightId, archived] : ArchiveRepository::getInstance() -> getFlightOutcomes()) {
+        if (flightRepository -> findFlightById(flightId).has_value()) {
+            continue;
+        }
+        auto& statistics = routes[getRouteKey(archived.origin, archived.destination)];
+        statistics.boarded += archived.boarded;
+        statistics.noShows += archived.noShows;
+    }
+}
+
+/**
+ * @brief Returns a shared pointer to the singleton instance of OverbookingRepository.
+ *
+ * @return std::shared_ptr<OverbookingRepository> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<OverbookingRepository> OverbookingRepository::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<OverbookingRepository> instance(new OverbookingRepository());
+    return instance;
+}
+
+/**
+ * @brief Returns the key under which the statistics of a route are kept.
+ *
+ * @param origin The origin of the route.
+ * @param destination The destination of the route.
+ * @return std::string The route key, "ORIGIN-DESTINATION".
+ */
+std::string OverbookingRepository::getRouteKey(const std::string& origin, const std::string& destination) {
+    return origin + "-" + destination;
+}
+
+/**
+ * @brief Returns the no-show statistics of a route.
+ *
+ * @param route The route key.
+ * @return RouteStatistics The statistics; all zero for a route without recorded outcomes.
+ */
+OverbookingRepository::RouteStatistics OverbookingRepository::getRouteStatistics(const std::string& route) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = routes.find(route);
+    return (it == routes.end()) ? RouteStatistics{} : it -> second;
+}
+
+/**
+ * @brief Counts the outcome of one reservation into the statistics of its route.
+ *
+ * The route's generation is bumped, which invalidates the cached capacity limits of
+ * every flight on the route.
+ *
+ * @param route The route key.
+ * @param boarded true if the passenger boarded, false for a no-show.
+ */
+void OverbookingRepository::recordOutcome(const std::string& route, bool boarded) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& statistics = routes[route];
+    if (boarded) {
+        statistics.boarded++;
+    } else {
+        statistics.noShows++;
+    }
+    statistics.generation++;
+}
+
+/**
+ * @brief Looks up the cached capacity limit of a flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<CapacityLimit> The cached limit, or std::nullopt if none was computed yet.
+ */
+std::optional<OverbookingRepository::CapacityLimit> OverbookingRepository::findCapacityLimit(const std::string& flightId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = limits.find(flightId);
+    if (it == limits.end()) {
+        return std::nullopt;
+    }
+    return it -> second;
+}
+
+/**
+ * @brief Caches the capacity limit computed for a flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param limit The limit and the route generation and aircraft it was computed from.
+ */
+void OverbookingRepository::setCapacityLimit(const std::string& flightId, CapacityLimit limit) {
+    std::lock_guard<std::mutex> lock(mutex);
+    limits[flightId] = std::move(limit);
+}
+
+/**
+ * @brief Returns the number of reservations of a flight still waiting for a seat.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::size_t The number of reservations sold beyond the physical seats.
+ */
+std::size_t OverbookingRepository::countUnassigned(const std::string& flightId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = unassigned.find(flightId);
+    return (it == unassigned.end()) ? 0 : it -> second.size();
+}
+
+/**
+ * @brief Queues a reservation sold without a seat.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param reservationId The unique identifier of the reservation.
+ */
+void OverbookingRepository::addUnassigned(const std::string& flightId, const std::string& reservationId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    unassigned[flightId].push_back(reservationId);
+}
+
+/**
+ * @brief Removes and returns the reservation without a seat that was sold first.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::string> The reservation ID, or std::nullopt if every reservation has a seat.
+ */
+std::optional<std::string> OverbookingRepository::popUnassigned(const std::string& flightId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = unassigned.find(flightId);
+    if (it == unassigned.end()) {
+        return std::nullopt;
+    }
+    std::string reservationId = std::move(it -> second.front());
+    it -> second.pop_front();
+    if (it -> second.empty()) {
+        unassigned.erase(it);
+    }
+    return reservationId;
+}
+
+/**
+ * @brief Removes a reservation from the queue of a flight, e.g. when it is cancelled.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param reservationId The unique identifier of the reservation.
+ * @return true if the reservation was queued; false otherwise.
+ */
+bool OverbookingRepository::removeUnassigned(const std::string& flightId, const std::string& reservationId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = unassigned.find(flightId);
+    if (it == unassigned.end()) {
+        return false;
+    }
+    auto position = std::find(it -> second.begin(), it -> second.end(), reservationId);
+    if (position == it -> second.end()) {
+        return false;
+    }
+    it -> second.erase(position);
+    if (it -> second.empty()) {
+        unassigned.erase(it);
+    }
+    return true;
+}
+
+/**
+ * @brief Drops the cached limit and the queue of a deleted flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ */
+void OverbookingRepository::forgetFlight(const std::string& flightId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    limits.erase(flightId);
+    unassigned.erase(flightId);
+}
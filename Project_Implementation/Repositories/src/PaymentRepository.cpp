@@ -1,4 +1,5 @@
 #include "../include/PaymentRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
 /**
@@ -66,6 +67,7 @@ bool PaymentRepository::addPayment(const PaymentModel& newPayment) {
         return false;
     }
     payments[newPayment.getPaymentId()] = std::make_shared<PaymentModel>(newPayment);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Payments, newPayment);
     return true;
 }
 /**
@@ -83,6 +85,7 @@ bool PaymentRepository::updatePayment(const PaymentModel& payment) {
         return false;
     }
     payments[payment.getPaymentId()] = std::make_shared<PaymentModel>(payment);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Payments, payment);
     return true;
 }
 /**
@@ -96,10 +99,11 @@ bool PaymentRepository::updatePayment(const PaymentModel& payment) {
  * @return true if the payment was successfully deleted; false if the payment does not exist.
  */
 bool PaymentRepository::deletePayment(const std::string& paymentId) {
-    if (payments.find(paymentId) != payments.end()) {
+    if (payments.find(paymentId) == payments.end()) {
         return false;
     }
     payments.erase(paymentId);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Payments, paymentId);
     return true;
 }
 
@@ -112,6 +116,6 @@ bool PaymentRepository::deletePayment(const std::string& paymentId) {
  * object is destroyed.
  */
 PaymentRepository::~PaymentRepository() {
-    JSONManager::saveToJSON(payments, PAYMENT_DATABASE_PATH);
+    JSONManager::saveToJSON(std::move(payments), PAYMENT_DATABASE_PATH);
     payments.clear();
 }
\ No newline at end of file
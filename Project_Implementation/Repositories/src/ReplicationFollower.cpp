@@ -0,0 +1,287 @@
+#include "../include/ReplicationFollower.hpp"
+#include "../include/ReplicationProtocol.hpp"
+#include "../include/AircraftRepository.hpp"
+#include "../include/CrewMemberRepository.hpp"
+#include "../include/FlightRepository.hpp"
+#include "../include/PaymentRepository.hpp"
+#include "../include/ReservationRepository.hpp"
+#include "../include/UserRepository.hpp"
+#include "../include/WaitlistRepository.hpp"
+#include "../../Model/include/UserFactory.hpp"
+#include "../../Utils/include/JSONManager.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Connects to a primary and starts applying its mutation log.
+ *
+ * Saving of the database files is disabled before anything else happens, so a follower
+ * that exits without being promoted leaves the primary's files untouched.
+ *
+ * @param socketPath Filesystem path of the primary's replication socket.
+ *
+ * @throws std::runtime_error If the primary cannot be reached or refuses the follower,
+ *         e.g. because the two processes did not start from the same database files.
+ */
+ReplicationFollower::ReplicationFollower(const std::string& socketPath) {
+    JSONManager::setSavingEnabled(false);
+    connection = UnixSocket::connectTo(socketPath);
+
+    ReplicationProtocol::Hello hello{
+        ReplicationProtocol::MAGIC, ReplicationProtocol::VERSION, ReplicationProtocol::computeBaseline(), 1
+    };
+    ReplicationProtocol::HelloReply reply{};
+    if (!connection.sendAll(&hello, sizeof(hello)) || !connection.receiveAll(&reply, sizeof(reply))) {
+        throw std::runtime_error("Replication handshake with the primary failed.");
+    }
+    if (reply.status == ReplicationProtocol::INCOMPATIBLE_VERSION) {
+        throw std::runtime_error("The primary uses an incompatible replication protocol.");
+    }
+    if (reply.status == ReplicationProtocol::BASELINE_MISMATCH) {
+        throw std::runtime_error("The primary was started from different database files.");
+    }
+
+    connectedAt = std::chrono::steady_clock::now();
+    catchUpTarget = reply.primaryLsn;
+    status.connected = true;
+    status.primaryLsn = reply.primaryLsn;
+    status.caughtUp = (catchUpTarget == 0);
+    applier = std::thread(&ReplicationFollower::run, this, hello.nextLsn);
+}
+
+/**
+ * @brief Apply thread: receives frames and replays their records until stopped.
+ *
+ * A missing LSN or a record that cannot be applied stops replication, since every later
+ * record may depend on it; the error is reported through getStatus().
+ *
+ * @param nextLsn The LSN expected in the first record.
+ */
+void ReplicationFollower::run(std::uint64_t nextLsn) {
+    std::string error;
+    std::string payload;
+    while (!stopping.load()) {
+        ReplicationProtocol::FrameHeader header{};
+        if (!connection.receiveAll(&header, sizeof(header))) {
+            error = stopping.load() ? "" : "Primary disconnected.";
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(statusMutex);
+            status.primaryLsn = header.primaryLsn;
+        }
+        if (header.length == 0) {
+            continue; // Heartbeat
+        }
+        if (header.length > ReplicationProtocol::MAX_RECORD_BYTES) {
+            error = "Received an oversized log record.";
+            break;
+        }
+        payload.resize(header.length);
+        if (!connection.receiveAll(&payload[0], payload.size())) {
+            error = stopping.load() ? "" : "Primary disconnected.";
+            break;
+        }
+
+        try {
+            JSON record = JSON::parse(payload);
+            std::uint64_t lsn = record.at("lsn").get<std::uint64_t>();
+            if (lsn != nextLsn) {
+                error = "Expected LSN " + std::to_string(nextLsn) + " but received " + std::to_string(lsn) + ".";
+                break;
+            }
+            apply(record);
+            recordApplied(lsn, payload.size(), record.at("commitTime").get<std::int64_t>());
+            nextLsn++;
+        } catch (const std::exception& e) {
+            error = "Failed to apply LSN " + std::to_string(nextLsn) + ": " + e.what();
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(statusMutex);
+    status.connected = false;
+    if (!error.empty()) {
+        status.error = error;
+    }
+}
+
+/**
+ * @brief Replays one log record into the local repositories.
+ *
+ * Upserts replace the entity if it exists and add it otherwise; deletes of entities
+ * that are already gone are ignored.
+ *
+ * @param record The decoded log record.
+ * @throws std::invalid_argument If the record is malformed or references missing entities.
+ */
+void ReplicationFollower::apply(const JSON& record) {
+    auto table = MutationLog::tableFromName(record.at("table").get<std::string>());
+    if (!table.has_value()) {
+        throw std::invalid_argument("Unknown table in log record.");
+    }
+    const bool upsert = (record.at("op").get<std::string>() == "upsert");
+    const std::string id = record.at("id").get<std::string>();
+    const JSON& data = record.at("data");
+
+    switch (table.value()) {
+        case MutationLog::Table::Aircraft: {
+            auto repository = AircraftRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteAircraft(id);
+            } else if (repository -> findAircraftById(id).has_value()) {
+                repository -> updateAircraft(AircraftModel(data));
+            } else {
+                repository -> addAircraft(AircraftModel(data));
+            }
+            break;
+        }
+        case MutationLog::Table::CrewMembers: {
+            auto repository = CrewMemberRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteCrewMember(id);
+            } else if (repository -> findCrewMemberById(id).has_value()) {
+                repository -> updateCrewMember(CrewMemberModel(data));
+            } else {
+                repository -> addCrewMember(CrewMemberModel(data));
+            }
+            break;
+        }
+        case MutationLog::Table::Flights: {
+            auto repository = FlightRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteFlight(id);
+            } else if (repository -> findFlightById(id).has_value()) {
+                repository -> updateFlight(FlightModel(data));
+            } else {
+                repository -> addFlight(FlightModel(data));
+            }
+            break;
+        }
+        case MutationLog::Table::Payments: {
+            auto repository = PaymentRepository::getInstance();
+            if (!upsert) {
+                repository -> deletePayment(id);
+            } else if (repository -> findPaymentById(id).has_value()) {
+                repository -> updatePayment(PaymentModel(data));
+            } else {
+                repository -> addPayment(PaymentModel(data));
+            }
+            break;
+        }
+        case MutationLog::Table::Reservations: {
+            auto repository = ReservationRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteReservation(id);
+            } else if (repository -> findReservationById(id).has_value()) {
+                repository -> updateReservation(ReservationModel(data));
+            } else {
+                repository -> addReservation(ReservationModel(data));
+            }
+            break;
+        }
+        case MutationLog::Table::Users: {
+            auto repository = UserRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteUser(id);
+                break;
+            }
+            auto user = UserFactory::createUser(data);
+            if (repository -> findUserById(id).has_value()) {
+                repository -> updateUser(*user);
+            } else {
+                repository -> addUser(*user);
+            }
+            break;
+        }
+        case MutationLog::Table::Waitlists: {
+            auto repository = WaitlistRepository::getInstance();
+            if (!upsert) {
+                repository -> deleteEntry(id);
+            } else if (!repository -> findEntryById(id).has_value()) {
+                repository -> addEntry(std::make_shared<WaitlistEntryModel>(data));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Updates progress, lag and catch-up statistics after a record was applied.
+ *
+ * Lag statistics only cover records applied after the initial catch-up; the backlog
+ * replayed on connection is measured as catch-up throughput instead.
+ *
+ * @param lsn The LSN of the applied record.
+ * @param bytes The encoded size of the record.
+ * @param commitTime The record's commit time on the primary, in microseconds since the Unix epoch.
+ */
+void ReplicationFollower::recordApplied(std::uint64_t lsn, std::size_t bytes, std::int64_t commitTime) {
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    double lagMillis = static_cast<double>(now - commitTime) / 1000.0;
+
+    std::lock_guard<std::mutex> lock(statusMutex);
+    status.appliedLsn = lsn;
+    status.recordsApplied++;
+    status.bytesApplied += bytes;
+    status.lastLagMillis = lagMillis;
+
+    if (!status.caughtUp) {
+        if (lsn >= catchUpTarget) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - connectedAt;
+            status.caughtUp = true;
+            status.catchUpRecords = status.recordsApplied;
+            status.catchUpSeconds = elapsed.count();
+            if (elapsed.count() > 0.0) {
+                status.catchUpRecordsPerSecond = static_cast<double>(status.recordsApplied) / elapsed.count();
+                status.catchUpBytesPerSecond = static_cast<double>(status.bytesApplied) / elapsed.count();
+            }
+        }
+        return;
+    }
+    totalLagMillis += lagMillis;
+    lagSamples++;
+    status.averageLagMillis = totalLagMillis / static_cast<double>(lagSamples);
+    status.maxLagMillis = std::max(status.maxLagMillis, lagMillis);
+}
+
+/**
+ * @brief Returns a copy of the current replication status.
+ *
+ * @return ReplicationStatus The follower's progress and measurements.
+ */
+ReplicationStatus ReplicationFollower::getStatus() const {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    return status;
+}
+
+/**
+ * @brief Stops applying the log and makes this process the new primary.
+ *
+ * After this call the repositories may be used by the calling thread and the database
+ * files are saved again when the process exits. Records the primary commits afterwards
+ * are not applied.
+ */
+void ReplicationFollower::promote() {
+    stopping.store(true);
+    connection.shutdownBoth();
+    if (applier.joinable()) {
+        applier.join();
+    }
+    JSONManager::setSavingEnabled(true);
+
+    std::lock_guard<std::mutex> lock(statusMutex);
+    status.promoted = true;
+}
+
+/**
+ * @brief Destructor. Stops the apply thread without promoting the follower.
+ */
+ReplicationFollower::~ReplicationFollower() {
+    stopping.store(true);
+    connection.shutdownBoth();
+    if (applier.joinable()) {
+        applier.join();
+    }
+}
@@ -0,0 +1,126 @@
+#include "../include/ReplicationPrimary.hpp"
+#include "../include/MutationLog.hpp"
+#include "../include/ReplicationProtocol.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Maximum number of bytes gathered into a single write while catching up.
+ */
+static constexpr std::size_t MAX_BATCH_BYTES = 256 * 1024;
+
+/**
+ * @brief Appends a frame (header and payload) to a send buffer.
+ */
+static void appendFrame(std::vector<char>& buffer, const std::string& payload, std::uint64_t primaryLsn) {
+    ReplicationProtocol::FrameHeader header{static_cast<std::uint32_t>(payload.size()), 0, primaryLsn};
+    std::size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(header) + payload.size());
+    std::memcpy(buffer.data() + offset, &header, sizeof(header));
+    std::memcpy(buffer.data() + offset + sizeof(header), payload.data(), payload.size());
+}
+
+/**
+ * @brief Returns the singleton instance of ReplicationPrimary.
+ *
+ * @return std::shared_ptr<ReplicationPrimary> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<ReplicationPrimary> ReplicationPrimary::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<ReplicationPrimary> instance(new ReplicationPrimary());
+    return instance;
+}
+
+/**
+ * @brief Enables the mutation log and starts accepting followers on a Unix socket.
+ *
+ * Must be called before the repositories are modified, since earlier changes are not
+ * part of the log.
+ *
+ * @param socketPath Filesystem path of the socket to listen on.
+ * @throws std::logic_error If the primary was already started.
+ * @throws std::runtime_error If the socket cannot be created.
+ */
+void ReplicationPrimary::start(const std::string& socketPath) {
+    if (isRunning()) {
+        throw std::logic_error("Replication primary is already running.");
+    }
+    baseline = ReplicationProtocol::computeBaseline();
+    listener = UnixSocket::listenOn(socketPath);
+    MutationLog::getInstance() -> enable();
+    shipper = std::thread(&ReplicationPrimary::run, this);
+}
+
+/**
+ * @brief Shipping thread: accepts followers one at a time until the primary stops.
+ */
+void ReplicationPrimary::run() {
+    while (!stopping.load()) {
+        auto connection = listener.acceptConnection(ReplicationProtocol::HEARTBEAT_INTERVAL_MILLIS);
+        if (!connection.has_value()) {
+            continue;
+        }
+        followerConnected.store(true);
+        serve(connection.value());
+        followerConnected.store(false);
+    }
+}
+
+/**
+ * @brief Performs the handshake with a follower and streams log records to it.
+ *
+ * Returns when the follower disconnects, a write fails, or the primary stops.
+ *
+ * @param connection The connected follower socket.
+ */
+void ReplicationPrimary::serve(const UnixSocket& connection) {
+    auto log = MutationLog::getInstance();
+
+    ReplicationProtocol::Hello hello{};
+    if (!connection.receiveAll(&hello, sizeof(hello))) {
+        return;
+    }
+    ReplicationProtocol::HelloReply reply{ReplicationProtocol::ACCEPTED, 0, log -> getLastLsn()};
+    if (hello.magic != ReplicationProtocol::MAGIC || hello.version != ReplicationProtocol::VERSION) {
+        reply.status = ReplicationProtocol::INCOMPATIBLE_VERSION;
+    } else if (hello.baseline != baseline) {
+        reply.status = ReplicationProtocol::BASELINE_MISMATCH;
+    }
+    if (!connection.sendAll(&reply, sizeof(reply)) || reply.status != ReplicationProtocol::ACCEPTED) {
+        return;
+    }
+
+    std::uint64_t nextLsn = (hello.nextLsn == 0) ? 1 : hello.nextLsn;
+    std::vector<char> buffer;
+    while (!stopping.load()) {
+        buffer.clear();
+        auto record = log -> waitForRecord(nextLsn, std::chrono::milliseconds(ReplicationProtocol::HEARTBEAT_INTERVAL_MILLIS));
+        std::uint64_t primaryLsn = log -> getLastLsn();
+        if (!record.has_value()) {
+            appendFrame(buffer, "", primaryLsn);
+        }
+        // Gather the records that are already available into one write.
+        while (record.has_value()) {
+            appendFrame(buffer, record.value(), primaryLsn);
+            nextLsn++;
+            if (buffer.size() >= MAX_BATCH_BYTES || nextLsn > primaryLsn) {
+                break;
+            }
+            record = log -> waitForRecord(nextLsn, std::chrono::milliseconds(0));
+        }
+        if (!connection.sendAll(buffer.data(), buffer.size())) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Destructor. Stops the shipping thread and closes the socket.
+ */
+ReplicationPrimary::~ReplicationPrimary() {
+    stopping.store(true);
+    if (shipper.joinable()) {
+        shipper.join();
+    }
+}
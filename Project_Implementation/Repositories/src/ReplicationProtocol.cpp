@@ -0,0 +1,50 @@
+#include "../include/ReplicationProtocol.hpp"
+#include "../include/MutationLog.hpp"
+#include "../../Utils/include/DatabasePathResolver.hpp"
+#include "../../Utils/include/SegmentedFile.hpp"
+#include <fstream>
+#include <vector>
+
+/**
+ * @brief Computes a fingerprint of the database files both processes start from.
+ *
+ * The mutation log only describes changes made since the primary loaded the database,
+ * so a follower must start from identical files. The fingerprint is an FNV-1a hash over
+ * the name and contents of every table file, followed by the segments it lists if it is
+ * a manifest; a missing file hashes as empty.
+ *
+ * @return std::uint64_t The baseline fingerprint.
+ */
+std::uint64_t ReplicationProtocol::computeBaseline() {
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](unsigned char byte) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    };
+    for (MutationLog::Table table : {MutationLog::Table::Aircraft, MutationLog::Table::CrewMembers,
+                                     MutationLog::Table::Flights, MutationLog::Table::Payments,
+                                     MutationLog::Table::Reservations, MutationLog::Table::Users,
+                                     MutationLog::Table::Waitlists}) {
+        std::string fileName = std::string(MutationLog::tableName(table)) + ".json";
+        for (char character : fileName) {
+            mix(static_cast<unsigned char>(character));
+        }
+        const std::string filePath = DatabasePathResolver::getDatabasePath() + fileName;
+        std::vector<std::string> filePaths{filePath};
+        for (const auto& segmentPath : SegmentedFile::getSegmentPaths(filePath)) {
+            if (segmentPath != filePath) {
+                filePaths.push_back(segmentPath);
+            }
+        }
+        for (const auto& path : filePaths) {
+            std::ifstream file(path, std::ios::binary);
+            std::vector<char> block(64 * 1024);
+            while (file.read(block.data(), static_cast<std::streamsize>(block.size())) || file.gcount() > 0) {
+                for (std::streamsize i = 0; i < file.gcount(); i++) {
+                    mix(static_cast<unsigned char>(block[static_cast<std::size_t>(i)]));
+                }
+            }
+        }
+    }
+    return hash;
+}
@@ -1,6 +1,9 @@
 #include "../include/ReservationRepository.hpp"
+#include "../include/FlightRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
+#include <stdexcept>
 
 /**
  * @brief Path to the reservations database file.
@@ -14,10 +17,17 @@ const std::string RESERVATION_DATABASE_PATH = DatabasePathResolver::getDatabaseP
  * @brief Constructs a ReservationRepository object and initializes the reservations data.
  *
  * This constructor parses the reservation data from the JSON file specified by
- * RESERVATION_DATABASE_PATH and loads it into the reservations container.
+ * RESERVATION_DATABASE_PATH and places every reservation in the shard owning its flight.
  */
-ReservationRepository::ReservationRepository() {
+ReservationRepository::ReservationRepository() : shards(FlightRepository::getInstance() -> getShardCount()) {
+    ReservationMap reservations;
     JSONManager::parseJSON(reservations, RESERVATION_DATABASE_PATH);
+    for (auto& [id, reservation] : reservations) {
+        std::size_t shard = getShardForFlight(reservation -> getFlightId());
+        reservationShards[id] = shard;
+        reservationOrder.upsert(id, id);
+        shards[shard][id] = std::move(reservation);
+    }
 }
 
 /**
@@ -35,10 +45,49 @@ std::shared_ptr<ReservationRepository> ReservationRepository::getInstance() {
     return instance;
 }
 
+/**
+ * @brief Returns the shard holding the reservations of a flight.
+ *
+ * Reservations follow their flight; reservations of unknown flights go to the first shard.
+ */
+std::size_t ReservationRepository::getShardForFlight(const std::string& flightId) const {
+    return FlightRepository::getInstance() -> findShardOfFlight(flightId).value_or(0);
+}
+
+/**
+ * @brief Looks up the shard holding a reservation in the reservation-to-shard directory.
+ */
+std::optional<std::size_t> ReservationRepository::findShardOfReservation(const std::string& reservationId) const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex);
+    auto it = reservationShards.find(reservationId);
+    if (it == reservationShards.end()) {
+        return std::nullopt;
+    }
+    return it -> second;
+}
+
+/**
+ * @brief Records the shard of a reservation in the directory and the ordered index.
+ */
+void ReservationRepository::setReservationShard(const std::string& reservationId, std::size_t shard) {
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    reservationShards[reservationId] = shard;
+    reservationOrder.upsert(reservationId, reservationId);
+}
+
+/**
+ * @brief Removes a reservation from the directory and the ordered index.
+ */
+void ReservationRepository::eraseReservationShard(const std::string& reservationId) {
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    reservationShards.erase(reservationId);
+    reservationOrder.erase(reservationId);
+}
+
 /**
  * @brief Finds a reservation by its unique identifier.
  *
- * Searches the internal reservations collection for a reservation matching the provided ID.
+ * Looks up the owning shard in the directory and searches that shard only.
  * If found, returns a shared pointer to the ReservationModel wrapped in an std::optional.
  * If not found, returns std::nullopt.
  *
@@ -46,51 +95,241 @@ std::shared_ptr<ReservationRepository> ReservationRepository::getInstance() {
  * @return std::optional<std::shared_ptr<ReservationModel>> Shared pointer to the reservation if found, std::nullopt otherwise.
  */
 std::optional<std::shared_ptr<ReservationModel>> ReservationRepository::findReservationById(const std::string& reservationId) const {
-    if (reservations.find(reservationId) == reservations.end()) {
+    auto shard = findShardOfReservation(reservationId);
+    if (!shard.has_value()) {
         return std::nullopt;
     }
-    return reservations.at(reservationId);
+    std::optional<std::shared_ptr<ReservationModel>> result;
+    FlightRepository::getInstance() -> runOnShard(shard.value(), [&] {
+        auto it = shards[shard.value()].find(reservationId);
+        if (it != shards[shard.value()].end()) {
+            result = it -> second;
+        }
+    });
+    return result;
 }
+/**
+ * @brief Retrieves all reservations, gathering them from every shard.
+ *
+ * @return std::vector<std::shared_ptr<ReservationModel>> All reservations in the repository.
+ */
 std::vector<std::shared_ptr<ReservationModel>> ReservationRepository::getAllReservations() const {
+    std::vector<std::vector<std::shared_ptr<ReservationModel>>> perShard(shards.size());
+    FlightRepository::getInstance() -> runOnAllShards([&](std::size_t shard) {
+        for (const auto& [id, reservation] : shards[shard]) {
+            perShard[shard].push_back(reservation);
+        }
+    });
     std::vector<std::shared_ptr<ReservationModel>> allReservations;
-    for (const auto& [id, reservation] : reservations) {
-        allReservations.push_back(reservation);
+    for (auto& reservations : perShard) {
+        allReservations.insert(allReservations.end(), reservations.begin(), reservations.end());
     }
     return allReservations;
 }
+/**
+ * @brief Visits every reservation in place, one shard after the other.
+ *
+ * Each shard is visited on the thread owning it, but never two at once, so the visitor
+ * needs no synchronization. Nothing is collected: the visitor sees the stored reservations
+ * directly, without copying them or their shared pointers.
+ *
+ * @param visit Called once per reservation.
+ */
+void ReservationRepository::forEachReservation(const std::function<void(const ReservationModel&)>& visit) const {
+    auto flightRepository = FlightRepository::getInstance();
+    for (std::size_t shard = 0; shard < shards.size(); shard++) {
+        flightRepository -> runOnShard(shard, [&] {
+            for (const auto& [id, reservation] : shards[shard]) {
+                visit(*reservation);
+            }
+        });
+    }
+}
+/**
+ * @brief Returns one page of reservations sorted by reservation ID.
+ *
+ * The page is located through the ordered index in O(log n); each reservation is then
+ * fetched from its shard. Reservations deleted in between are skipped.
+ *
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of reservations in the page.
+ * @return ReservationPage The reservations of the page and, unless it is the last one, the cursor of the next.
+ */
+ReservationRepository::ReservationPage ReservationRepository::getReservationsById(const std::optional<ReservationCursor>& after, std::size_t limit) const {
+    auto page = reservationOrder.page(after, limit);
+    ReservationPage result;
+    result.rows.reserve(page.ids.size());
+    for (const auto& reservationId : page.ids) {
+        auto reservation = findReservationById(reservationId);
+        if (reservation.has_value()) {
+            result.rows.push_back(reservation.value());
+        }
+    }
+    result.next = page.next;
+    return result;
+}
 /**
  * @brief Adds a new reservation to the repository.
  *
  * This method checks if a reservation with the same ID already exists.
  * If it does, the method returns false and does not add the reservation.
- * Otherwise, it adds the reservation and returns true.
+ * Otherwise, it adds the reservation to the shard owning its flight and returns true.
  *
  * @param newReservation The reservation model to be added.
  * @return true if the reservation was added successfully; false if a reservation with the same ID already exists.
  */
 bool ReservationRepository::addReservation(const ReservationModel& newReservation) {
-    if (reservations.find(newReservation.getReservationId()) != reservations.end()) {
+    if (findShardOfReservation(newReservation.getReservationId()).has_value()) {
+        return false;
+    }
+    return emplaceReservation(std::make_shared<ReservationModel>(newReservation));
+}
+/**
+ * @brief Adds a newly built reservation to the repository without copying it.
+ *
+ * The repository takes shared ownership of the given reservation. Returns false and
+ * stores nothing if a reservation with the same ID already exists.
+ *
+ * @param newReservation The reservation to store, typically fresh from ReservationModelBuilder::build() &&.
+ * @return true if the reservation was added successfully; false if a reservation with the same ID already exists.
+ */
+bool ReservationRepository::emplaceReservation(std::shared_ptr<ReservationModel> newReservation) {
+    const std::string& reservationId = newReservation -> getReservationId();
+    if (findShardOfReservation(reservationId).has_value()) {
         return false;
     }
-    reservations[newReservation.getReservationId()] = std::make_shared<ReservationModel>(newReservation);
+    std::size_t shard = getShardForFlight(newReservation -> getFlightId());
+    FlightRepository::getInstance() -> runOnShard(shard, [&] {
+        shards[shard].emplace(reservationId, newReservation);
+    });
+    setReservationShard(reservationId, shard);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Reservations, *newReservation);
     return true;
 }
 
+/**
+ * @brief Moves a stored reservation from one shard to another.
+ *
+ * Each shard is entered in a task of its own, one after the other, so this must not run
+ * inside a shard task: the worker of the other shard may be waiting on the caller's.
+ *
+ * @param reservation The reservation to store in the new shard.
+ * @param fromShard The shard currently holding the reservation.
+ * @param toShard The shard owning the reservation's new flight.
+ * @throws std::logic_error If called from inside a shard task.
+ */
+void ReservationRepository::moveReservationShard(const std::shared_ptr<ReservationModel>& reservation, std::size_t fromShard, std::size_t toShard) {
+    auto flightRepository = FlightRepository::getInstance();
+    if (flightRepository -> isRunningOnShard()) {
+        throw std::logic_error("A reservation cannot move to another shard from inside a shard task.");
+    }
+    const std::string& reservationId = reservation -> getReservationId();
+    flightRepository -> runOnShard(fromShard, [&] {
+        shards[fromShard].erase(reservationId);
+    });
+    flightRepository -> runOnShard(toShard, [&] {
+        shards[toShard][reservationId] = reservation;
+    });
+    setReservationShard(reservationId, toShard);
+}
+
 /**
  * @brief Updates an existing reservation in the repository.
  *
  * This function searches for a reservation with the given reservation ID.
- * If the reservation exists, it updates the stored reservation with the provided data.
+ * If the reservation exists, it updates the stored reservation with the provided data,
+ * moving it to another shard if it now refers to a flight owned by that shard.
  * If the reservation does not exist, the function returns false.
  *
  * @param reservation The ReservationModel object containing updated reservation data.
  * @return true if the reservation was successfully updated; false if the reservation does not exist.
+ * @throws std::logic_error If the reservation changes shard and this is called from inside a shard task.
  */
 bool ReservationRepository::updateReservation(const ReservationModel& reservation) {
-    if (reservations.find(reservation.getReservationId()) == reservations.end()) {
+    auto currentShard = findShardOfReservation(reservation.getReservationId());
+    if (!currentShard.has_value()) {
         return false;
     }
-    reservations[reservation.getReservationId()] = std::make_shared<ReservationModel>(reservation);
+    auto stored = std::make_shared<ReservationModel>(reservation);
+    std::size_t shard = getShardForFlight(reservation.getFlightId());
+    if (shard != currentShard.value()) {
+        moveReservationShard(stored, currentShard.value(), shard);
+    } else {
+        FlightRepository::getInstance() -> runOnShard(shard, [&] {
+            shards[shard][reservation.getReservationId()] = stored;
+        });
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Reservations, reservation);
+    return true;
+}
+
+/**
+ * @brief Updates a reservation only if nobody committed a change since it was read.
+ *
+ * Optimistic concurrency control: the update succeeds only if the stored reservation is
+ * still at expectedVersion, in which case it is replaced by the given data with the version
+ * incremented. The check and the write run as one task on the thread owning the reservation
+ * (see modifyReservation()); if the flight changed shard, the reservation moves after that task.
+ *
+ * @param reservation The ReservationModel object containing updated reservation data.
+ * @param expectedVersion The version of the reservation the update is based on.
+ * @return true if the reservation was updated; false if it does not exist or was changed in the meantime.
+ * @throws std::logic_error If the reservation changes shard and this is called from inside a shard task.
+ */
+bool ReservationRepository::compareAndSetReservation(const ReservationModel& reservation, std::uint64_t expectedVersion) {
+    auto shard = findShardOfReservation(reservation.getReservationId());
+    if (shard.has_value() && shard.value() != getShardForFlight(reservation.getFlightId())
+        && FlightRepository::getInstance() -> isRunningOnShard()) {
+        // Refused before anything is written, rather than by the move after the write
+        throw std::logic_error("A reservation cannot move to another shard from inside a shard task.");
+    }
+    return modifyReservation(reservation.getReservationId(), [&reservation, expectedVersion](ReservationModel& stored) {
+        if (stored.getVersion() != expectedVersion) {
+            return false;
+        }
+        stored = reservation;
+        stored.setVersion(expectedVersion);
+        return true;
+    });
+}
+
+/**
+ * @brief Changes a stored reservation in place.
+ *
+ * The mutator runs on the thread owning the reservation and receives the stored
+ * reservation itself, so no copy is made. It returns false if it made no change, in
+ * which case nothing is committed. Otherwise the version is incremented, the change is
+ * recorded in the mutation log, and the reservation follows its flight to another shard
+ * if the flight changed. That move runs after the mutator's task, never inside it.
+ *
+ * @param reservationId The unique identifier of the reservation to change.
+ * @param mutate Applies the change; returns whether anything changed.
+ * @return true if the reservation exists and was changed; false otherwise.
+ * @throws std::logic_error If the reservation changes shard and this is called from inside a shard task.
+ */
+bool ReservationRepository::modifyReservation(const std::string& reservationId, const std::function<bool(ReservationModel&)>& mutate) {
+    auto shard = findShardOfReservation(reservationId);
+    if (!shard.has_value()) {
+        return false;
+    }
+    auto flightRepository = FlightRepository::getInstance();
+    std::shared_ptr<ReservationModel> reservation;
+    flightRepository -> runOnShard(shard.value(), [&] {
+        auto it = shards[shard.value()].find(reservationId);
+        if (it == shards[shard.value()].end() || !mutate(*it -> second)) {
+            return;
+        }
+        reservation = it -> second;
+        reservation -> setVersion(reservation -> getVersion() + 1);
+    });
+    if (!reservation) {
+        return false;
+    }
+    std::size_t newShard = getShardForFlight(reservation -> getFlightId());
+    if (newShard != shard.value()) {
+        moveReservationShard(reservation, shard.value(), newShard);
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Reservations, *reservation);
     return true;
 }
 
@@ -98,38 +337,106 @@ bool ReservationRepository::updateReservation(const ReservationModel& reservatio
  * @brief Deletes a reservation with the specified reservation ID.
  *
  * This function searches for a reservation in the repository using the provided
- * reservation ID. If the reservation exists, it is removed from the repository.
+ * reservation ID. If the reservation exists, it is removed from its shard.
  *
  * @param reservationId The unique identifier of the reservation to delete.
  * @return true if the reservation was found and deleted; false otherwise.
  */
 bool ReservationRepository::deleteReservation(const std::string& reservationId) {
-    if (reservations.find(reservationId) == reservations.end()) {
+    auto shard = findShardOfReservation(reservationId);
+    if (!shard.has_value()) {
         return false;
     }
-    reservations.erase(reservationId);
+    FlightRepository::getInstance() -> runOnShard(shard.value(), [&] {
+        shards[shard.value()].erase(reservationId);
+    });
+    eraseReservationShard(reservationId);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Reservations, reservationId);
     return true;
 }
 
+/**
+ * @brief Moves the reservations of a flight to the flight's new shard.
+ *
+ * Called by FlightRepository when a route change moves a flight to another shard, so that
+ * a flight and its reservations keep being owned by the same thread.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param fromShard The shard the flight was moved from.
+ * @param toShard The shard the flight was moved to.
+ * @throws std::logic_error If called from inside a shard task.
+ */
+void ReservationRepository::moveFlightReservations(const std::string& flightId, std::size_t fromShard, std::size_t toShard) {
+    auto flightRepository = FlightRepository::getInstance();
+    if (flightRepository -> isRunningOnShard()) {
+        throw std::logic_error("Reservations cannot move to another shard from inside a shard task.");
+    }
+    ReservationMap moved;
+    flightRepository -> runOnShard(fromShard, [&] {
+        for (auto it = shards[fromShard].begin(); it != shards[fromShard].end();) {
+            if (it -> second -> getFlightId() == flightId) {
+                moved.insert(*it);
+                it = shards[fromShard].erase(it);
+            } else {
+                ++it;
+            }
+        }
+    });
+    if (moved.empty()) {
+        return;
+    }
+    flightRepository -> runOnShard(toShard, [&] {
+        shards[toShard].insert(moved.begin(), moved.end());
+    });
+    for (const auto& [id, reservation] : moved) {
+        setReservationShard(id, toShard);
+    }
+}
+
 /**
  * @brief Finds all reservations associated with a specific passenger.
  *
- * Iterates through the repository's reservations and collects those
- * that match the provided passenger ID.
+ * Every shard collects the matching reservations in parallel; the results are concatenated.
  *
  * @param passengerId The unique identifier of the passenger.
- * @return A vector of shared pointers to ReservationModel objects
- *         corresponding to the passenger's reservations.
+ * @return std::vector<std::shared_ptr<ReservationModel>> The passenger's reservations.
  */
 std::vector<std::shared_ptr<ReservationModel>> ReservationRepository::findReservationsByPassenger(const std::string& passengerId) const {
-    std::vector<std::shared_ptr<ReservationModel>> passengerReservations;
-    for (const auto& [id, reservation] : reservations) {
-        if (reservation->getPassengerId() == passengerId) {
-            passengerReservations.push_back(reservation);
+    std::vector<std::vector<std::shared_ptr<ReservationModel>>> perShard(shards.size());
+    FlightRepository::getInstance() -> runOnAllShards([&](std::size_t shard) {
+        for (const auto& [id, reservation] : shards[shard]) {
+            if (reservation->getPassengerId() == passengerId) {
+                perShard[shard].push_back(reservation);
+            }
         }
+    });
+    std::vector<std::shared_ptr<ReservationModel>> passengerReservations;
+    for (auto& reservations : perShard) {
+        passengerReservations.insert(passengerReservations.end(), reservations.begin(), reservations.end());
     }
     return passengerReservations;
 }
+/**
+ * @brief Finds all reservations of a specific flight.
+ *
+ * Reservations live in the shard owning their flight, so only that shard is searched.
+ * The flight must still exist for its shard to be known.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::vector<std::shared_ptr<ReservationModel>> The flight's reservations.
+ */
+std::vector<std::shared_ptr<ReservationModel>> ReservationRepository::findReservationsByFlight(const std::string& flightId) const {
+    std::vector<std::shared_ptr<ReservationModel>> flightReservations;
+    std::size_t shard = getShardForFlight(flightId);
+    FlightRepository::getInstance() -> runOnShard(shard, [&] {
+        for (const auto& [id, reservation] : shards[shard]) {
+            if (reservation->getFlightId() == flightId) {
+                flightReservations.push_back(reservation);
+            }
+        }
+    });
+    return flightReservations;
+}
 /**
  * @brief Destructor for the ReservationRepository class.
  *
@@ -139,6 +446,10 @@ std::vector<std::shared_ptr<ReservationModel>> ReservationRepository::findReserv
  * to the file specified by RESERVATION_DATABASE_PATH.
  */
 ReservationRepository::~ReservationRepository() {
-    JSONManager::saveToJSON(reservations, RESERVATION_DATABASE_PATH);
-    reservations.clear();
+    ReservationMap reservations;
+    for (auto& shard : shards) {
+        reservations.merge(shard);
+    }
+    JSONManager::saveToJSON(std::move(reservations), RESERVATION_DATABASE_PATH);
+    shards.clear();
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "../include/UserRepository.hpp"
+#include "../include/MutationLog.hpp"
 #include "../../Utils/include/JSONManager.hpp"
 #include "../../Model/include/UserFactory.hpp"
 #include "../../Utils/include/DatabasePathResolver.hpp"
@@ -21,6 +22,28 @@ UserRepository::UserRepository() {
     JSONManager::parseJSON(users, USER_DATABASE_PATH);
     for (const auto& [id, user] : users) {
         usernameToIdMap[user->getUsername()] = id;
+        usernamePrefixes.upsert(id, user->getUsername());
+        indexRole(user);
+    }
+}
+
+/**
+ * @brief Adds a user to the table of its role.
+ */
+void UserRepository::indexRole(const std::shared_ptr<UserModel>& user) {
+    auto role = static_cast<std::size_t>(user -> getRole());
+    if (role < ROLE_COUNT) {
+        usersByRole[role][user -> getUserId()] = user;
+    }
+}
+
+/**
+ * @brief Removes a user from the table of its role.
+ */
+void UserRepository::unindexRole(const UserModel& user) {
+    auto role = static_cast<std::size_t>(user.getRole());
+    if (role < ROLE_COUNT) {
+        usersByRole[role].erase(user.getUserId());
     }
 }
 
@@ -75,6 +98,44 @@ std::optional<std::shared_ptr<UserModel>> UserRepository::findUserByUsername(con
     return findUserById(it -> second);
 }
 
+/**
+ * @brief Finds a passenger by their user ID.
+ *
+ * The passenger is looked up in the passenger table, whose users are all Passenger
+ * objects, so the result is converted with a static cast.
+ *
+ * @param passengerId The unique identifier of the passenger to find.
+ * @return std::optional<std::shared_ptr<Passenger>> The passenger, or std::nullopt if no passenger has this ID.
+ */
+std::optional<std::shared_ptr<Passenger>> UserRepository::findPassengerById(const std::string& passengerId) const {
+    const auto& passengers = usersByRole[static_cast<std::size_t>(UserModel::UserType::Passenger)];
+    auto it = passengers.find(passengerId);
+    if (it == passengers.end()) {
+        return std::nullopt;
+    }
+    return std::static_pointer_cast<Passenger>(it -> second);
+}
+
+/**
+ * @brief Finds the users whose username starts with a prefix.
+ *
+ * The matches are read from the username prefix index, so only they are visited.
+ *
+ * @param prefix The prefix, matched case-insensitively.
+ * @param limit The maximum number of users returned.
+ * @return std::vector<std::shared_ptr<UserModel>> The first matching users, sorted by username.
+ */
+std::vector<std::shared_ptr<UserModel>> UserRepository::findUsersByUsernamePrefix(const std::string& prefix, std::size_t limit) const {
+    std::vector<std::shared_ptr<UserModel>> matches;
+    for (const auto& userId : usernamePrefixes.findByPrefix(prefix, limit)) {
+        auto it = users.find(userId);
+        if (it != users.end()) {
+            matches.push_back(it -> second);
+        }
+    }
+    return matches;
+}
+
 /**
  * @brief Adds a new user to the repository.
  *
@@ -104,7 +165,10 @@ bool UserRepository::addUser(const UserModel& newUser) {
         return false;
     }
     users[newUser.getUserId()] = createdUser;
+    indexRole(createdUser);
     usernameToIdMap[newUser.getUsername()] = newUser.getUserId();
+    usernamePrefixes.upsert(newUser.getUserId(), newUser.getUsername());
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Users, *createdUser);
     return true;
 }
 /**
@@ -135,8 +199,46 @@ bool UserRepository::updateUser(const UserModel& user) {
 
     JSON userJson;
     user.to_json(userJson);
-    users[user.getUserId()] = UserFactory::createUser(userJson);
+    unindexRole(*it -> second);
+    it -> second = UserFactory::createUser(userJson);
+    indexRole(it -> second);
     usernameToIdMap[user.getUsername()] = user.getUserId();
+    usernamePrefixes.upsert(user.getUserId(), user.getUsername());
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Users, *users[user.getUserId()]);
+    return true;
+}
+/**
+ * @brief Changes a stored user in place.
+ *
+ * The mutator receives the stored user itself, so neither a copy nor a JSON round trip
+ * is needed. It returns false if it made no change, in which case nothing is recorded.
+ * A new username that is already taken by another user is reverted and the change rejected.
+ *
+ * @param userId The unique identifier of the user to change.
+ * @param mutate Applies the change; returns whether anything changed.
+ * @return true if the user exists and was changed; false otherwise.
+ */
+bool UserRepository::modifyUser(const std::string& userId, const std::function<bool(UserModel&)>& mutate) {
+    auto it = users.find(userId);
+    if (it == users.end()) {
+        return false;
+    }
+    UserModel& user = *it -> second;
+    const std::string oldUsername = user.getUsername();
+    if (!mutate(user)) {
+        return false;
+    }
+    if (user.getUsername() != oldUsername) {
+        auto usernameIt = usernameToIdMap.find(user.getUsername());
+        if (usernameIt != usernameToIdMap.end() && usernameIt -> second != userId) {
+            user.setUserName(oldUsername);
+            return false;
+        }
+        usernameToIdMap.erase(oldUsername);
+        usernameToIdMap[user.getUsername()] = userId;
+        usernamePrefixes.upsert(userId, user.getUsername());
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Users, user);
     return true;
 }
 /**
@@ -156,7 +258,10 @@ bool UserRepository::deleteUser(const std::string& userId) {
     }
     auto username = it->second->getUsername();
     usernameToIdMap.erase(username);
+    usernamePrefixes.erase(userId);
+    unindexRole(*it -> second);
     users.erase(it);
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Users, userId);
     return true;
 }
 
@@ -179,9 +284,8 @@ std::vector<std::shared_ptr<UserModel>> UserRepository::getAllUsers() const {
 /**
  * @brief Retrieves all users with a specific role from the repository.
  * 
- * This function filters the users collection and returns all users that match
- * the specified role type. The search is performed by comparing each user's
- * role with the provided role parameter.
+ * This function returns all users that match the specified role type, read from
+ * the table of that role, so users of other roles are not visited.
  * 
  * @param role The user role type to filter by (UserModel::UserType)
  * @return std::vector<std::shared_ptr<UserModel>> A vector containing shared pointers
@@ -194,10 +298,13 @@ std::vector<std::shared_ptr<UserModel>> UserRepository::getAllUsers() const {
  */
 std::vector<std::shared_ptr<UserModel>> UserRepository::getUsersByRole(const UserModel::UserType& role) const {
     std::vector<std::shared_ptr<UserModel>> filteredUsers;
-    for (const auto& [id, user] : users) {
-        if (user->getRole() == role) {
-            filteredUsers.push_back(user);
-        }
+    auto roleIndex = static_cast<std::size_t>(role);
+    if (roleIndex >= ROLE_COUNT) {
+        return filteredUsers;
+    }
+    filteredUsers.reserve(usersByRole[roleIndex].size());
+    for (const auto& [id, user] : usersByRole[roleIndex]) {
+        filteredUsers.push_back(user);
     }
     return filteredUsers;
 }
@@ -209,7 +316,10 @@ std::vector<std::shared_ptr<UserModel>> UserRepository::getUsersByRole(const Use
  * to the users are persisted to the file specified by USER_DATABASE_PATH.
  */
 UserRepository::~UserRepository() {
-    JSONManager::saveToJSON(users, USER_DATABASE_PATH);
+    JSONManager::saveToJSON(std::move(users), USER_DATABASE_PATH);
     users.clear();
     usernameToIdMap.clear();
+    for (auto& roleUsers : usersByRole) {
+        roleUsers.clear();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "../include/WaitlistRepository.hpp"
+#include "../include/MutationLog.hpp"
+#include "../../Utils/include/JSONManager.hpp"
+#include "../../Utils/include/DatabasePathResolver.hpp"
+#include <algorithm>
+
+/**
+ * @brief Path to the waitlists database file.
+ *
+ * This constant defines the relative path to the JSON file
+ * where waitlist entries are stored and retrieved.
+ */
+const std::string WAITLIST_DATABASE_PATH = DatabasePathResolver::getDatabasePath() + "waitlists.json";
+
+/**
+ * @brief Heap ordering of waitlist entries: the entry with the highest priority is kept at the front.
+ */
+static bool hasLowerPriority(const std::shared_ptr<WaitlistEntryModel>& left, const std::shared_ptr<WaitlistEntryModel>& right) {
+    return right -> hasPriorityOver(*left);
+}
+
+/**
+ * @brief Constructs a WaitlistRepository object and initializes the waitlists.
+ *
+ * This constructor parses the waitlist entries from the JSON file specified by
+ * WAITLIST_DATABASE_PATH, builds one heap per flight, and resumes the request
+ * order numbering after the highest stored one.
+ */
+WaitlistRepository::WaitlistRepository() {
+    JSONManager::parseJSON(entries, WAITLIST_DATABASE_PATH);
+    for (const auto& [id, entry] : entries) {
+        waitlists[entry -> getFlightId()].push_back(entry);
+        sequence = std::max(sequence, entry -> getSequence());
+    }
+    for (auto& [flightId, heap] : waitlists) {
+        std::make_heap(heap.begin(), heap.end(), hasLowerPriority);
+    }
+}
+
+/**
+ * @brief Returns a shared pointer to the singleton instance of WaitlistRepository.
+ *
+ * @return std::shared_ptr<WaitlistRepository> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<WaitlistRepository> WaitlistRepository::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<WaitlistRepository> instance(new WaitlistRepository());
+    return instance;
+}
+
+/**
+ * @brief Finds a waitlist entry by its unique identifier.
+ *
+ * @param entryId The unique identifier of the entry to find.
+ * @return std::optional<std::shared_ptr<WaitlistEntryModel>> Shared pointer to the entry if found, std::nullopt otherwise.
+ */
+std::optional<std::shared_ptr<WaitlistEntryModel>> WaitlistRepository::findEntryById(const std::string& entryId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(entryId);
+    if (it == entries.end()) {
+        return std::nullopt;
+    }
+    return it -> second;
+}
+
+/**
+ * @brief Returns the number of passengers waiting for a flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::size_t The length of the flight's waitlist.
+ */
+std::size_t WaitlistRepository::getWaitlistLength(const std::string& flightId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = waitlists.find(flightId);
+    return (it == waitlists.end()) ? 0 : it -> second.size();
+}
+
+/**
+ * @brief Returns the request order number of the next waitlist entry.
+ *
+ * @return std::uint64_t A number greater than that of every entry created before.
+ */
+std::uint64_t WaitlistRepository::nextSequence() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ++sequence;
+}
+
+/**
+ * @brief Adds an entry to the waitlist of its flight in O(log n).
+ *
+ * Returns false and stores nothing if an entry with the same ID already exists.
+ *
+ * @param entry The entry to store.
+ * @return true if the entry was added; false if an entry with the same ID already exists.
+ */
+bool WaitlistRepository::addEntry(std::shared_ptr<WaitlistEntryModel> entry) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!entries.emplace(entry -> getEntryId(), entry).second) {
+            return false;
+        }
+        auto& heap = waitlists[entry -> getFlightId()];
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end(), hasLowerPriority);
+        sequence = std::max(sequence, entry -> getSequence());
+    }
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Waitlists, *entry);
+    return true;
+}
+
+/**
+ * @brief Removes and returns the highest-priority entry of a flight's waitlist in O(log n).
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::shared_ptr<WaitlistEntryModel>> The removed entry, or std::nullopt if nobody is waiting.
+ */
+std::optional<std::shared_ptr<WaitlistEntryModel>> WaitlistRepository::popNextEntry(const std::string& flightId) {
+    std::shared_ptr<WaitlistEntryModel> entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = waitlists.find(flightId);
+        if (it == waitlists.end()) {
+            return std::nullopt;
+        }
+        auto& heap = it -> second;
+        std::pop_heap(heap.begin(), heap.end(), hasLowerPriority);
+        entry = std::move(heap.back());
+        heap.pop_back();
+        if (heap.empty()) {
+            waitlists.erase(it);
+        }
+        entries.erase(entry -> getEntryId());
+    }
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Waitlists, entry -> getEntryId());
+    return entry;
+}
+
+/**
+ * @brief Removes a waitlist entry by its unique identifier.
+ *
+ * The entry is searched in its flight's heap, which is then restored, so this is linear
+ * in the length of that waitlist.
+ *
+ * @param entryId The unique identifier of the entry to remove.
+ * @return true if the entry was found and removed; false otherwise.
+ */
+bool WaitlistRepository::deleteEntry(const std::string& entryId) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(entryId);
+        if (it == entries.end()) {
+            return false;
+        }
+        auto waitlist = waitlists.find(it -> second -> getFlightId());
+        auto& heap = waitlist -> second;
+        heap.erase(std::find(heap.begin(), heap.end(), it -> second));
+        if (heap.empty()) {
+            waitlists.erase(waitlist);
+        } else {
+            std::make_heap(heap.begin(), heap.end(), hasLowerPriority);
+        }
+        entries.erase(it);
+    }
+    MutationLog::getInstance() -> recordDelete(MutationLog::Table::Waitlists, entryId);
+    return true;
+}
+
+/**
+ * @brief Removes the whole waitlist of a flight, e.g. when the flight is deleted.
+ *
+ * @param flightId The unique identifier of the flight.
+ */
+void WaitlistRepository::deleteWaitlist(const std::string& flightId) {
+    Heap removed;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = waitlists.find(flightId);
+        if (it == waitlists.end()) {
+            return;
+        }
+        removed = std::move(it -> second);
+        waitlists.erase(it);
+        for (const auto& entry : removed) {
+            entries.erase(entry -> getEntryId());
+        }
+    }
+    for (const auto& entry : removed) {
+        MutationLog::getInstance() -> recordDelete(MutationLog::Table::Waitlists, entry -> getEntryId());
+    }
+}
+
+/**
+ * @brief Destructor for the WaitlistRepository class.
+ *
+ * Saves the remaining waitlist entries to the JSON file specified by
+ * WAITLIST_DATABASE_PATH before the object is destroyed.
+ */
+WaitlistRepository::~WaitlistRepository() {
+    JSONManager::saveToJSON(std::move(entries), WAITLIST_DATABASE_PATH);
+    waitlists.clear();
+    entries.clear();
+}
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 #include "../../Model/include/AircraftModel.hpp"
+#include "../../Repositories/include/RepositoryView.hpp"
 
 
 /**
@@ -22,6 +23,7 @@ class AircraftService {
         AircraftService() = delete;
 
         static std::vector<std::shared_ptr<AircraftModel>> getAllAircrafts();
+        static RepositoryView<AircraftModel> viewAircrafts();
         static std::optional<std::shared_ptr<AircraftModel>> getAircraftById(const std::string& aircraftId);
         static std::optional<std::shared_ptr<AircraftModel>> addAircraft(
             const std::string& model,
@@ -29,5 +31,11 @@ class AircraftService {
             int numOfRowSeats
         );
         static bool updateAircraft(const AircraftModel& aircraft);
+        static bool updateAircraft(
+            const std::string& aircraftId,
+            const std::string& model,
+            int capacity,
+            int numOfRowSeats
+        );
         static bool deleteAircraft(const std::string& aircraftId);
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../../Model/include/AirportModel.hpp"
+
+
+/**
+ * @brief Service class for looking up airports in the airport master table.
+ *
+ * Suggestions complete what a user has typed so far: airports whose code, city, name or
+ * a word of them starts with the input come first; only when there are none are airports
+ * suggested whose names begin almost like the input, to tolerate typos.
+ *
+ * @note This class cannot be instantiated as the default constructor is deleted.
+ *       All operations are performed through static methods.
+ */
+class AirportService {
+    public:
+        AirportService() = delete;
+
+        static std::optional<std::shared_ptr<const AirportModel>> getAirportByCode(const std::string& code);
+        static std::vector<std::shared_ptr<const AirportModel>> suggestAirports(const std::string& query, std::size_t limit);
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../../Model/include/FlightModel.hpp"
+#include "../../Model/include/PaymentModel.hpp"
+#include "../../Model/include/ReservationModel.hpp"
+
+
+/**
+ * @brief Service class moving departed flights out of the working set into the archive.
+ *
+ * Flights that arrived longer ago than a horizon are moved, with their reservations and
+ * the payments of those reservations, from the flight, reservation and payment
+ * repositories into the read-only ArchiveRepository. They are then no longer loaded or
+ * saved with the active schedule, and are read back from the archive one flight at a
+ * time when a lookup asks for them. Archived records cannot be changed.
+ *
+ * @note This class is designed as a utility class with deleted constructor to prevent instantiation.
+ */
+
+/**
+ * @brief Archives every flight that arrived more than a number of days ago.
+ *
+ * @param horizonDays The number of days after its arrival a flight stays in the working set
+ * @return std::size_t The number of flights archived
+ */
+
+/**
+ * @brief Reads an archived flight.
+ *
+ * @param flightId The unique identifier of the flight
+ * @return std::optional<std::shared_ptr<FlightModel>> A copy of the flight, or std::nullopt if it is not archived
+ */
+
+/**
+ * @brief Reads an archived reservation.
+ *
+ * @param reservationId The unique identifier of the reservation
+ * @return std::optional<std::shared_ptr<ReservationModel>> A copy of the reservation, or std::nullopt if it is not archived
+ */
+
+/**
+ * @brief Reads all archived reservations of a passenger.
+ *
+ * @param passengerId The unique identifier of the passenger
+ * @return std::vector<std::shared_ptr<ReservationModel>> Copies of the passenger's archived reservations
+ */
+
+/**
+ * @brief Reads an archived payment.
+ *
+ * @param paymentId The unique identifier of the payment
+ * @return std::optional<std::shared_ptr<PaymentModel>> A copy of the payment, or std::nullopt if it is not archived
+ */
+class ArchiveService {
+    public:
+        ArchiveService() = delete;
+
+        static std::size_t archiveDepartedFlights(int horizonDays);
+        static std::optional<std::shared_ptr<FlightModel>> getArchivedFlight(const std::string& flightId);
+        static std::optional<std::shared_ptr<ReservationModel>> getArchivedReservation(const std::string& reservationId);
+        static std::vector<std::shared_ptr<ReservationModel>> getArchivedReservationsByPassenger(const std::string& passengerId);
+        static std::optional<std::shared_ptr<PaymentModel>> getArchivedPayment(const std::string& paymentId);
+};
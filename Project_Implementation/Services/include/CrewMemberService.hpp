@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 #include "../../Model/include/CrewMemberModel.hpp"
+#include "../../Repositories/include/RepositoryView.hpp"
 
 
 /**
@@ -25,5 +26,7 @@ class CrewMemberService {
         static bool updateCrewMember(const std::string& id, const std::string& name, const CrewMemberModel::CrewType& role);
         static bool deleteCrewMember(const std::string& id);
         static std::vector<std::shared_ptr<CrewMemberModel>> getAllCrewMembers();
+        static RepositoryView<CrewMemberModel> viewCrewMembers();
         static std::vector<std::shared_ptr<CrewMemberModel>> getCrewMembersByRole(const CrewMemberModel::CrewType& role);
+        static std::vector<std::shared_ptr<CrewMemberModel>> searchCrewMembersByName(const std::string& prefix, std::size_t limit);
 };
\ No newline at end of file
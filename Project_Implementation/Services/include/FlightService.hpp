@@ -1,9 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 #include <memory>
 #include "../../Model/include/FlightModel.hpp"
 #include "../../Model/include/CrewMemberModel.hpp"
+#include "../../Repositories/include/FlightRepository.hpp"
 
 
 /**
@@ -22,6 +24,24 @@
  * @return std::vector<std::shared_ptr<FlightModel>> Vector containing all flights in the system
  */
 
+/**
+ * @brief Retrieves all flights as of one point in time, for reports and listings.
+ * 
+ * Reads a snapshot of the flight table without taking any lock, so long scans neither
+ * block nor observe concurrent bookings half-way. Iterating the snapshot yields the flights
+ * as const references, without copying them or their shared pointers.
+ * 
+ * @return FlightRepository::Snapshot The snapshot; hold it only for the duration of the read
+ */
+
+/**
+ * @brief Retrieves one page of flights sorted by departure time.
+ * 
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page
+ * @param limit The maximum number of flights in the page
+ * @return FlightRepository::FlightPage The flights of the page and the cursor of the next page, if any
+ */
+
 /**
  * @brief Retrieves a specific flight by its unique identifier.
  * 
@@ -35,9 +55,23 @@
  * @param origin The departure airport/location
  * @param destination The arrival airport/location
  * @param departureDate The date of departure
+ * @param filter The seats the flights must have free; by default every flight matches
  * @return std::vector<std::shared_ptr<FlightModel>> Vector of flights matching the criteria
  */
 
+/**
+ * @brief Retrieves the free seats and lowest fare of a route on every day around a date.
+ *
+ * Answers a flexible-date search with one read of the fare calendar index instead of one
+ * search per day.
+ *
+ * @param origin The departure airport/location
+ * @param destination The arrival airport/location
+ * @param departureDate The preferred date of departure
+ * @param daysAround The number of days before and after the preferred date to include
+ * @return std::vector<FareCalendarDay> One entry per day, from the earliest to the latest
+ */
+
 /**
  * @brief Creates and adds a new flight to the system.
  * 
@@ -84,8 +118,11 @@
 /**
  * @brief Updates an existing flight with new information from a FlightModel object.
  * 
+ * The flight must carry the version it was read at; the update is rejected if the flight
+ * was changed by someone else in the meantime.
+ * 
  * @param flight The FlightModel object containing updated flight information
- * @return bool True if the flight was successfully updated, false otherwise
+ * @return bool True if the flight was successfully updated, false if it does not exist or the copy is stale
  */
 
 /**
@@ -106,16 +143,38 @@
  * @param flightId The unique identifier of the flight to delete
  * @return bool True if the flight was successfully deleted, false otherwise
  */
+/**
+ * @brief Runs a task on the thread owning a flight's shard.
+ * 
+ * Controllers use this to route whole requests by flight ID in sharded mode, so that the
+ * flight, its seat map and its reservations are only touched by one thread. With a single
+ * shard the task runs inline.
+ * 
+ * @param flightId The unique identifier of the flight the task works on
+ * @param task The task to run
+ */
 class FlightService {
     public:
         FlightService() = delete;
 
         static std::vector<std::shared_ptr<FlightModel>> getAllFlights();
+        static FlightRepository::Snapshot getFlightsSnapshot();
+        static FlightRepository::FlightPage getFlightsPage(
+            const std::optional<FlightRepository::DepartureCursor>& after,
+            std::size_t limit
+        );
         static std::optional<std::shared_ptr<FlightModel>> getFlightById(const std::string& flightId);
         static std::vector<std::shared_ptr<FlightModel>> getFlightsByRouteAndDate (
             const std::string& origin,
             const std::string& destination,
-            const DateTime& departureDate
+            const DateTime& departureDate,
+            const AvailabilityFilter& filter = {}
+        );
+        static std::vector<FareCalendarDay> getFareCalendar(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& departureDate,
+            std::size_t daysAround
         );
         static std::optional<std::shared_ptr<FlightModel>> addFlight(
             const std::string& origin,
@@ -139,4 +198,5 @@ class FlightService {
             const std::string& aircraftId
         );
         static bool deleteFlight(const std::string& flightId);
+        static void runOnFlightShard(const std::string& flightId, const std::function<void()>& task);
 };
\ No newline at end of file
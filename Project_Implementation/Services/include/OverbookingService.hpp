@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include "../../Model/include/FlightModel.hpp"
+
+
+/**
+ * @brief Service class deciding how many reservations a flight may sell.
+ *
+ * Airlines fly with empty seats when booked passengers do not show up. The
+ * OverbookingService authorizes selling more reservations than the aircraft has seats,
+ * in proportion to the no-show rate observed on the flight's route: with a no-show rate
+ * r, a flight of capacity c may sell c / (1 - r) reservations, never more than 15% above
+ * its capacity. Routes with fewer than 20 recorded outcomes are not overbooked.
+ *
+ * Reservations beyond the physical seats are sold without a seat and get one when a
+ * seat is freed by a cancellation or a no-show.
+ *
+ * The authorized capacity is cached per flight and only recomputed when the route's
+ * statistics or the flight's aircraft changed, so the booking path does not recompute it
+ * on every request.
+ *
+ * @note This class is designed as a utility class with deleted constructor to prevent instantiation.
+ */
+
+/**
+ * @brief Returns how many reservations a flight may sell in total.
+ *
+ * @param flight The flight
+ * @return int The authorized capacity, at least the aircraft's capacity
+ */
+
+/**
+ * @brief Checks whether a fully booked flight may sell another reservation without a seat.
+ *
+ * @param flight The flight
+ * @return true if the flight is fully booked and below its authorized capacity
+ */
+
+/**
+ * @brief Returns the share of reservations on a route that ended as no-shows.
+ *
+ * @param origin The origin of the route
+ * @param destination The destination of the route
+ * @return double The no-show rate between 0 and 1, or 0 if no outcome was recorded yet
+ */
+
+/**
+ * @brief Counts the outcome of a reservation into the statistics of its flight's route.
+ *
+ * @param flight The flight of the reservation
+ * @param boarded true if the passenger boarded, false for a no-show
+ */
+class OverbookingService {
+    public:
+        OverbookingService() = delete;
+
+        static int getAuthorizedCapacity(const FlightModel& flight);
+        static bool canSellWithoutSeat(const FlightModel& flight);
+        static double getNoShowRate(const std::string& origin, const std::string& destination);
+        static void recordOutcome(const FlightModel& flight, bool boarded);
+};
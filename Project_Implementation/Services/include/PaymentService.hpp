@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 #include "../../Model/include/PaymentModel.hpp"
 #include "../../Third_Party/json.hpp"
 
@@ -62,6 +63,30 @@ using JSON = nlohmann::json;
  * @throws May throw exceptions for invalid payment ID, non-refundable payments,
  *         or refund processing failures
  */
+
+/**
+ * @brief Deletes a payment that was created but is no longer needed.
+ * 
+ * Used when the reservation a payment was created for could not be stored, so no
+ * charge is left behind without a reservation.
+ * 
+ * @param paymentId The unique identifier of the payment to delete
+ * 
+ * @return bool Returns true if the payment was deleted, false if it does not exist
+ */
+
+/**
+ * @brief Splits a payment into equal parts, one per reservation it has to pay for.
+ * 
+ * The payment keeps the first part; every other part becomes a new payment of the same
+ * passenger, method, date and status.
+ * 
+ * @param paymentId The unique identifier of the payment to split
+ * @param parts The number of parts, at least 2
+ * 
+ * @return std::vector<std::string> Returns the IDs of the new payments, or an empty
+ *         vector if the payment does not exist or could not be split
+ */
 class PaymentService {
     public:
         PaymentService() = delete;
@@ -70,4 +95,6 @@ class PaymentService {
             const std::string& method, const JSON& paymentDetails);
         static std::string processPayment(const std::string& paymentId);
         static std::string refundPayment(const std::string& paymentId);
+        static bool deletePayment(const std::string& paymentId);
+        static std::vector<std::string> splitPayment(const std::string& paymentId, std::size_t parts);
 };
\ No newline at end of file
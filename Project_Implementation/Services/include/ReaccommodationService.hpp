@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+
+/**
+ * @brief Service class removing flights and re-accommodating their passengers.
+ *
+ * When a flight is removed, every confirmed reservation on it is moved to another way of
+ * getting from the flight's origin to its destination: first the flights of the same
+ * route departing no earlier, by departure time; then, if they do not have enough free
+ * seats, one-stop connections leaving no earlier, by arrival time. A connection keeps the
+ * reservation on its first leg and adds a reservation on the second one; the payment is
+ * split evenly between the legs, so each reservation has its own.
+ *
+ * Candidate flights are found through the flights-by-origin index and read from a
+ * snapshot. Passengers are served by priority (loyalty points, then cabin) and keep their
+ * seat number when it is free, or else get a seat in the same cabin if there is one. Seats
+ * are planned against the snapshot first and then booked on every shard in parallel; a
+ * planned seat taken in the meantime is replaced by another free seat of the same flight.
+ *
+ * Reservations no itinerary has room for are cancelled and their payments refunded. They
+ * are moved, with the flight's boarded, no-show and cancelled reservations and their
+ * payments, into the ArchiveRepository together with the removed flight, so they stay
+ * readable while no reservation in the working set refers to a removed flight.
+ *
+ * @note This class is designed as a utility class with deleted constructor to prevent instantiation.
+ */
+
+/**
+ * @brief Removes a flight and re-accommodates its passengers.
+ *
+ * @param flightId The unique identifier of the flight
+ * @return The outcome of the re-accommodation, or std::nullopt if the flight could not be removed
+ * @throws std::runtime_error If the kept reservations cannot be archived
+ */
+class ReaccommodationService {
+    public:
+        struct Report {
+            std::size_t rebooked = 0;
+            std::size_t rebookedWithConnection = 0;
+            std::size_t cancelled = 0;
+        };
+
+        ReaccommodationService() = delete;
+
+        static std::optional<Report> removeFlight(const std::string& flightId);
+};
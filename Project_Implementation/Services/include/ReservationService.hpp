@@ -5,7 +5,12 @@
 #include <memory>
 #include "../../Model/include/ReservationModel.hpp"
 #include "../../Model/include/PaymentModel.hpp"
+#include "../../Model/include/FlightModel.hpp"
+#include "../../Model/include/Passenger.hpp"
+#include "../../Model/include/WaitlistEntryModel.hpp"
+#include "../../Repositories/include/ReservationRepository.hpp"
 #include "../../Third_Party/json.hpp"
+#include <functional>
 #include <vector>
 
 using JSON = nlohmann::json;
@@ -17,7 +22,10 @@ using JSON = nlohmann::json;
  * 
  * The ReservationService class provides static methods for performing CRUD operations
  * on flight reservations. It handles reservation creation, retrieval, updates, and
- * deletions, along with seat pricing calculations based on loyalty points.
+ * deletions, along with seat pricing calculations based on loyalty points. Passengers
+ * can wait for a seat on a fully booked flight; cancellations promote the next one.
+ * Fully booked flights may sell reservations without a seat up to the capacity
+ * authorized by the OverbookingService.
  * 
  * This class follows a static service pattern and cannot be instantiated.
  * All operations are performed through static methods that interact with the
@@ -27,11 +35,28 @@ using JSON = nlohmann::json;
  *       All constructors are deleted to enforce static-only usage.
  */
 class ReservationService {
-        static float getSeatPrice(const std::string& seatNumber, float loyaltyPoints);
+        static float getSeatPrice(const std::string& seatNumber, std::size_t seatsPerRow, float loyaltyPoints);
+        static std::shared_ptr<Passenger> findPassenger(const std::string& passengerId);
+        static std::optional<std::shared_ptr<ReservationModel>> bookSeat(
+            FlightModel& flight,
+            Passenger& passenger,
+            const std::string& seatNumber,
+            const std::string& paymentMethod,
+            const JSON& paymentDetails
+        );
+        static std::optional<std::shared_ptr<ReservationModel>> promoteFromWaitlist(FlightModel& flight, const std::string& seatNumber);
+        static void releaseSeat(FlightModel& flight, const std::string& seatNumber);
+        static bool moveToFlight(const ReservationModel& reservation, const std::string& previousFlightId, const std::string& previousSeatNumber);
+        static void releaseMovedSeat(const std::string& flightId, const std::string& seatNumber, const std::string& reservationId);
     public:
         ReservationService() = delete;
 
         static std::vector<std::shared_ptr<ReservationModel>> getAllReservations();
+        static void forEachReservation(const std::function<void(const ReservationModel&)>& visit);
+        static ReservationRepository::ReservationPage getReservationsPage(
+            const std::optional<ReservationRepository::ReservationCursor>& after,
+            std::size_t limit
+        );
         static std::optional<std::shared_ptr<ReservationModel>> getReservationById(const std::string& reservationId);
         static std::vector<std::shared_ptr<ReservationModel>> getReservationByUserId(const std::string& userId);
 
@@ -44,4 +69,13 @@ class ReservationService {
         );
         static bool updateReservation(const ReservationModel& reservation);
         static bool deleteReservation(const std::string& reservationId);
+        static bool recordBoardingOutcome(const std::string& reservationId, bool boarded);
+
+        static std::optional<std::shared_ptr<WaitlistEntryModel>> joinWaitlist(
+            const std::string& flightId,
+            const std::string& passengerId,
+            const std::string& paymentMethod,
+            const JSON& paymentDetails
+        );
+        static std::size_t getWaitlistLength(const std::string& flightId);
 };
\ No newline at end of file
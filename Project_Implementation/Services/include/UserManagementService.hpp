@@ -4,6 +4,7 @@
 #include <optional>
 #include <memory>
 #include "../../Model/include/UserModel.hpp"
+#include "../../Repositories/include/RepositoryView.hpp"
 #include <vector>
 
 /**
@@ -22,6 +23,8 @@ class UserManagementService {
             const std::string& password
         );
         static std::vector<std::shared_ptr<UserModel>> getAllUsers();
+        static RepositoryView<UserModel> viewUsers();
+        static std::vector<std::shared_ptr<UserModel>> searchUsersByUsername(const std::string& prefix, std::size_t limit);
         static std::vector<std::shared_ptr<UserModel>> getUsersByRole(const UserModel::UserType& role);
         static std::optional<std::shared_ptr<UserModel>> createUser (
             const std::string& username,
@@ -13,6 +13,14 @@
 std::vector<std::shared_ptr<AircraftModel>> AircraftService::getAllAircrafts() {
     return AircraftRepository::getInstance() -> getAllAircrafts();
 }
+/**
+ * @brief Returns a view over all aircraft models, without copying them.
+ *
+ * @return RepositoryView<AircraftModel> A view valid until the next change to the aircraft.
+ */
+RepositoryView<AircraftModel> AircraftService::viewAircrafts() {
+    return AircraftRepository::getInstance() -> viewAircrafts();
+}
 /**
  * @brief Retrieves an aircraft model by its unique identifier.
  *
@@ -62,6 +70,32 @@ std::optional<std::shared_ptr<AircraftModel>> AircraftService::addAircraft (
 bool AircraftService::updateAircraft(const AircraftModel& aircraft) {
     return AircraftRepository::getInstance() -> updateAircraft(aircraft);
 }
+/**
+ * @brief Updates the details of an existing aircraft in place.
+ *
+ * The stored aircraft is changed directly through AircraftRepository::modifyAircraft,
+ * without building a replacement object.
+ *
+ * @param aircraftId The unique identifier of the aircraft to update.
+ * @param model The new model name of the aircraft.
+ * @param capacity The new passenger capacity of the aircraft.
+ * @param numOfRowSeats The new number of seats per row.
+ * @return true if the update was successful; false if the aircraft does not exist.
+ * @throws std::invalid_argument If the capacity or seats per row are invalid.
+ */
+bool AircraftService::updateAircraft(
+    const std::string& aircraftId,
+    const std::string& model,
+    int capacity,
+    int numOfRowSeats
+) {
+    return AircraftRepository::getInstance() -> modifyAircraft(aircraftId, [&](AircraftModel& aircraft) {
+        aircraft.setModel(model);
+        aircraft.setCapacity(capacity);
+        aircraft.setNumOfRowSeats(numOfRowSeats);
+        return true;
+    });
+}
 /**
  * @brief Deletes an aircraft with the specified ID.
  *
@@ -0,0 +1,29 @@
+#include "../include/AirportService.hpp"
+#include "../../Repositories/include/AirportRepository.hpp"
+
+/**
+ * @brief Retrieves an airport by its IATA code.
+ *
+ * @param code The IATA code, in any case.
+ * @return std::optional<std::shared_ptr<const AirportModel>> The airport, or std::nullopt if the code is unknown.
+ */
+std::optional<std::shared_ptr<const AirportModel>> AirportService::getAirportByCode(const std::string& code) {
+    return AirportRepository::getInstance() -> findAirportByCode(code);
+}
+
+/**
+ * @brief Suggests the airports a partially typed, possibly misspelled, input may refer to.
+ *
+ * @param query The text typed so far.
+ * @param limit The maximum number of airports suggested.
+ * @return std::vector<std::shared_ptr<const AirportModel>> The airports starting with the query,
+ *         or, if there are none, the airports closest to it.
+ */
+std::vector<std::shared_ptr<const AirportModel>> AirportService::suggestAirports(const std::string& query, std::size_t limit) {
+    auto repository = AirportRepository::getInstance();
+    auto suggestions = repository -> findAirportsByPrefix(query, limit);
+    if (!suggestions.empty()) {
+        return suggestions;
+    }
+    return repository -> findAirportsByApproximateName(query, limit);
+}
@@ -0,0 +1,95 @@
+#include "../include/ArchiveService.hpp"
+#include "../include/FlightService.hpp"
+#include "../../Repositories/include/ArchiveRepository.hpp"
+#include "../../Repositories/include/FlightRepository.hpp"
+#include "../../Repositories/include/PaymentRepository.hpp"
+#include "../../Repositories/include/ReservationRepository.hpp"
+#include "../../Utils/include/DateTime.hpp"
+
+/**
+ * @brief Archives every flight that arrived more than a number of days ago.
+ *
+ * The departed flights are collected with their reservations and the payments of those
+ * reservations, and written to the archive. Only once the archive holds them are they
+ * removed from the working set, so a failure leaves them where they were. Removing a
+ * flight also drops its waitlist, like deleting it; its reservations are removed without
+ * releasing their seats, which are archived with the flight. The archive is not opened
+ * when no flight is due.
+ *
+ * @param horizonDays The number of days after its arrival a flight stays in the working set.
+ * @return std::size_t The number of flights archived.
+ * @throws std::runtime_error If the archive cannot be written; nothing is removed then.
+ */
+std::size_t ArchiveService::archiveDepartedFlights(int horizonDays) {
+    const DateTime horizon = DateTime::now().addDays(-horizonDays);
+    auto reservationRepository = ReservationRepository::getInstance();
+    auto paymentRepository = PaymentRepository::getInstance();
+
+    std::vector<ArchiveRepository::FlightRecord> records;
+    for (const auto& flight : FlightRepository::getInstance() -> getAllFlights()) {
+        if (!(flight -> getArrivalTime() < horizon)) {
+            continue;
+        }
+        ArchiveRepository::FlightRecord record;
+        record.flight = flight;
+        record.reservations = reservationRepository -> findReservationsByFlight(flight -> getFlightId());
+        for (const auto& reservation : record.reservations) {
+            auto payment = paymentRepository -> findPaymentById(reservation -> getPaymentId());
+            if (payment.has_value()) {
+                record.payments.push_back(payment.value());
+            }
+        }
+        records.push_back(std::move(record));
+    }
+    if (records.empty()) {
+        return 0;
+    }
+
+    ArchiveRepository::getInstance() -> archiveFlights(records);
+    for (const auto& record : records) {
+        for (const auto& reservation : record.reservations) {
+            reservationRepository -> deleteReservation(reservation -> getReservationId());
+        }
+        for (const auto& payment : record.payments) {
+            paymentRepository -> deletePayment(payment -> getPaymentId());
+        }
+        FlightService::deleteFlight(record.flight -> getFlightId());
+    }
+    return records.size();
+}
+/**
+ * @brief Reads an archived flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<std::shared_ptr<FlightModel>> A copy of the flight, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<FlightModel>> ArchiveService::getArchivedFlight(const std::string& flightId) {
+    return ArchiveRepository::getInstance() -> findFlightById(flightId);
+}
+/**
+ * @brief Reads an archived reservation.
+ *
+ * @param reservationId The unique identifier of the reservation.
+ * @return std::optional<std::shared_ptr<ReservationModel>> A copy of the reservation, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<ReservationModel>> ArchiveService::getArchivedReservation(const std::string& reservationId) {
+    return ArchiveRepository::getInstance() -> findReservationById(reservationId);
+}
+/**
+ * @brief Reads all archived reservations of a passenger.
+ *
+ * @param passengerId The unique identifier of the passenger.
+ * @return std::vector<std::shared_ptr<ReservationModel>> Copies of the passenger's archived reservations.
+ */
+std::vector<std::shared_ptr<ReservationModel>> ArchiveService::getArchivedReservationsByPassenger(const std::string& passengerId) {
+    return ArchiveRepository::getInstance() -> findReservationsByPassenger(passengerId);
+}
+/**
+ * @brief Reads an archived payment.
+ *
+ * @param paymentId The unique identifier of the payment.
+ * @return std::optional<std::shared_ptr<PaymentModel>> A copy of the payment, or std::nullopt if it is not archived.
+ */
+std::optional<std::shared_ptr<PaymentModel>> ArchiveService::getArchivedPayment(const std::string& paymentId) {
+    return ArchiveRepository::getInstance() -> findPaymentById(paymentId);
+}
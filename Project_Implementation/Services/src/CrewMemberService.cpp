@@ -66,6 +66,24 @@ bool CrewMemberService::deleteCrewMember(const std::string& id) {
 std::vector<std::shared_ptr<CrewMemberModel>> CrewMemberService::getAllCrewMembers() {
     return CrewMemberRepository::getInstance() -> getAllCrewMembers();
 }
+/**
+ * @brief Returns a view over all crew members, without copying them.
+ *
+ * @return RepositoryView<CrewMemberModel> A view valid until the next change to the crew members.
+ */
+RepositoryView<CrewMemberModel> CrewMemberService::viewCrewMembers() {
+    return CrewMemberRepository::getInstance() -> viewCrewMembers();
+}
+/**
+ * @brief Finds the crew members whose name starts with a prefix.
+ *
+ * @param prefix The prefix, matched case-insensitively.
+ * @param limit The maximum number of crew members returned.
+ * @return std::vector<std::shared_ptr<CrewMemberModel>> The first matching crew members, sorted by name.
+ */
+std::vector<std::shared_ptr<CrewMemberModel>> CrewMemberService::searchCrewMembersByName(const std::string& prefix, std::size_t limit) {
+    return CrewMemberRepository::getInstance() -> findCrewMembersByNamePrefix(prefix, limit);
+}
 /**
  * @brief Retrieves a list of crew members filtered by their role.
  * 
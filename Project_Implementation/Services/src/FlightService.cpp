@@ -2,7 +2,11 @@
 #include "../../Model/include/FlightModelBuilder.hpp"
 #include "../../Repositories/include/FlightRepository.hpp"
 #include "../../Repositories/include/AircraftRepository.hpp"
+#include "../../Repositories/include/FlightSnapshotPublisher.hpp"
+#include "../../Repositories/include/WaitlistRepository.hpp"
+#include "../../Repositories/include/OverbookingRepository.hpp"
 #include "../../Services/include/CrewMemberService.hpp"
+#include <utility>
 /**
  * @brief Retrieves all available flights.
  *
@@ -13,6 +17,27 @@
 std::vector<std::shared_ptr<FlightModel>> FlightService::getAllFlights() {
     return FlightRepository::getInstance() -> getAllFlights();
 }
+/**
+ * @brief Retrieves all flights from a point-in-time snapshot of the repository.
+ *
+ * The snapshot is read without locks. Its rows are immutable and stay as they were
+ * when it was taken, whatever happens to the flights while it is held.
+ *
+ * @return FlightRepository::Snapshot A snapshot of all flights.
+ */
+FlightRepository::Snapshot FlightService::getFlightsSnapshot() {
+    return FlightRepository::getInstance() -> takeSnapshot();
+}
+/**
+ * @brief Retrieves one page of flights sorted by departure time, then flight ID.
+ *
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of flights in the page.
+ * @return FlightRepository::FlightPage The flights of the page and the cursor of the next page, if any.
+ */
+FlightRepository::FlightPage FlightService::getFlightsPage(const std::optional<FlightRepository::DepartureCursor>& after, std::size_t limit) {
+    return FlightRepository::getInstance() -> getFlightsByDeparture(after, limit);
+}
 /**
  * @brief Retrieves a flight by its unique identifier.
  *
@@ -35,14 +60,34 @@ std::optional<std::shared_ptr<FlightModel>> FlightService::getFlightById(const s
  * @param origin The IATA code or name of the departure location.
  * @param destination The IATA code or name of the arrival location.
  * @param departureDate The date and time of departure to filter flights.
+ * @param filter The seats the flights must have free, e.g. at least one in business class.
  * @return std::vector<std::shared_ptr<FlightModel>> A vector containing shared pointers to matching FlightModel instances.
  */
 std::vector<std::shared_ptr<FlightModel>> FlightService::getFlightsByRouteAndDate (
             const std::string& origin,
             const std::string& destination,
-            const DateTime& departureDate
+            const DateTime& departureDate,
+            const AvailabilityFilter& filter
+) {
+    return FlightRepository::getInstance() -> getFlightsByCriteria(origin, destination, departureDate, filter);
+}
+/**
+ * @brief Retrieves the free seats and lowest fare of a route on every day around a date.
+ *
+ * @param origin The IATA code or name of the departure location.
+ * @param destination The IATA code or name of the arrival location.
+ * @param departureDate The preferred date of departure.
+ * @param daysAround The number of days before and after the preferred date to include.
+ * @return std::vector<FareCalendarDay> The 2 * daysAround + 1 days of the window, in order.
+ */
+std::vector<FareCalendarDay> FlightService::getFareCalendar(
+            const std::string& origin,
+            const std::string& destination,
+            const DateTime& departureDate,
+            std::size_t daysAround
 ) {
-    return FlightRepository::getInstance() -> getFlightsByCriteria(origin, destination, departureDate);
+    const DateTime firstDay = departureDate.addDays(-static_cast<int>(daysAround));
+    return FlightRepository::getInstance() -> getFareCalendar(origin, destination, firstDay, 2 * daysAround + 1);
 }
 /**
  * @brief Adds a new flight to the system.
@@ -67,16 +112,17 @@ std::optional<std::shared_ptr<FlightModel>> FlightService::addFlight(
     const std::string& aircraftId,
     const std::vector<std::string>& crewMemberIds
 ) {
-    auto flight = FlightModelBuilder()
-        .setOrigin(origin)
+    FlightModelBuilder builder;
+    builder.setOrigin(origin)
         .setDestination(destination)
         .setDepartureTime(departureTime)
         .setArrivalTime(arrivalTime)
         .setAircraftId(aircraftId)
-        .setCrewMemberIds(crewMemberIds)
-        .build();
-    if (FlightRepository::getInstance() -> addFlight(*flight)) {
-        return FlightRepository::getInstance() -> findFlightById(flight->getFlightId());
+        .setCrewMemberIds(crewMemberIds);
+    auto flight = std::move(builder).build();
+    if (FlightRepository::getInstance() -> emplaceFlight(flight)) {
+        FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+        return flight;
     }
     return std::nullopt;
 }
@@ -84,20 +130,25 @@ std::optional<std::shared_ptr<FlightModel>> FlightService::addFlight(
  * @brief Updates the details of an existing flight.
  *
  * This method attempts to update the flight information in the repository
- * using the provided FlightModel object. It delegates the update operation
- * to the FlightRepository singleton instance.
+ * using the provided FlightModel object. The update is a compare-and-set against
+ * the version carried by the flight, so a stale copy never overwrites a newer
+ * change such as a seat booked in the meantime.
  *
  * @param flight The FlightModel object containing updated flight details.
- * @return true if the update was successful, false otherwise.
+ * @return true if the update was successful, false if the flight does not exist or was changed since it was read.
  */
 bool FlightService::updateFlight(const FlightModel& flight) {
-    return FlightRepository::getInstance() -> updateFlight(flight);
+    if (!FlightRepository::getInstance() -> compareAndSetFlight(flight, flight.getVersion())) {
+        return false;
+    }
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    return true;
 }
 /**
  * @brief Updates the details of an existing flight.
  *
  * This method attempts to update the flight information in the repository
- * using the provided flight details.
+ * using the provided flight details. The stored flight is changed in place.
  *
  * @param flightId The unique identifier of the flight to update.
  * @param origin The new origin location for the flight.
@@ -128,26 +179,39 @@ bool FlightService::updateFlight(
     if (!aircraftId.empty() && !AircraftRepository::getInstance() -> findAircraftById(aircraftId).has_value()) {
         return false; // Aircraft does not exist
     }
-    auto flight = flightOpt.value();
-    flight -> setOrigin(origin);
-    flight -> setDestination(destination);
-    flight -> setDepartureTime(departureTime);
-    flight -> setArrivalTime(arrivalTime);
-    flight -> setAircraftId(aircraftId);
-    return FlightRepository::getInstance() -> updateFlight(*flight);
+    bool updated = FlightRepository::getInstance() -> modifyFlight(flightId, [&](FlightModel& flight) {
+        flight.setOrigin(origin);
+        flight.setDestination(destination);
+        flight.setDepartureTime(departureTime);
+        flight.setArrivalTime(arrivalTime);
+        flight.setAircraftId(aircraftId);
+        return true;
+    });
+    if (!updated) {
+        return false;
+    }
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    return true;
 }
 /**
  * @brief Deletes a flight with the specified flight ID.
  *
  * This method attempts to remove the flight identified by the given flightId
  * from the flight repository. It delegates the deletion operation to the
- * FlightRepository singleton instance.
+ * FlightRepository singleton instance. The flight's waitlist and
+ * overbooking state are dropped with it.
  *
  * @param flightId The unique identifier of the flight to be deleted.
  * @return true if the flight was successfully deleted; false otherwise.
  */
 bool FlightService::deleteFlight(const std::string& flightId) {
-    return FlightRepository::getInstance() -> deleteFlight(flightId);
+    if (!FlightRepository::getInstance() -> deleteFlight(flightId)) {
+        return false;
+    }
+    WaitlistRepository::getInstance() -> deleteWaitlist(flightId);
+    OverbookingRepository::getInstance() -> forgetFlight(flightId);
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    return true;
 }
 /**
  * @brief Assigns a list of crew member IDs to a specific flight.
@@ -160,12 +224,10 @@ bool FlightService::deleteFlight(const std::string& flightId) {
  * @return true if the crew members were successfully assigned to the flight; false if the flight was not found.
  */
 bool FlightService::addCrewToFlight(const std::string& flightId, const std::vector<std::string>& crewIds) {
-    auto FlightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
-    if (!FlightOpt.has_value()) {
-        return false;
-    }
-    FlightOpt.value() -> setCrewMemberIds(crewIds);
-    return true;
+    return FlightRepository::getInstance() -> modifyFlight(flightId, [&crewIds](FlightModel& flight) {
+        flight.setCrewMemberIds(crewIds);
+        return true;
+    });
 }
 /**
  * @brief Adds a crew member to a specified flight.
@@ -179,12 +241,10 @@ bool FlightService::addCrewToFlight(const std::string& flightId, const std::vect
  * @return true if the crew member was successfully added to the flight; false otherwise.
  */
 bool FlightService::addCrewToFlight(const std::string& flightId, const std::string& crewMemberId) {
-    auto FlightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
-    if (!FlightOpt.has_value()) {
-        return false;
-    }
-    FlightOpt.value() -> addCrewMemberId(crewMemberId);
-    return true;
+    return FlightRepository::getInstance() -> modifyFlight(flightId, [&crewMemberId](FlightModel& flight) {
+        flight.addCrewMemberId(crewMemberId);
+        return true;
+    });
 }
 /**
  * @brief Removes a crew member from a specific flight.
@@ -204,16 +264,10 @@ bool FlightService::addCrewToFlight(const std::string& flightId, const std::stri
  *       to remove the crew member
  */
 bool FlightService::removeCrewMemberFromFlight(const std::string& flightId, const std::string& crewMemberId) {
-    auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
-    if (!flightOpt.has_value()) {
-        return false;
-    }
-    auto flight = flightOpt.value();
-    if (!flight -> removeCrewMemberId(crewMemberId)) {
-        return false;
-    }
     // Only update repository if a crew member was actually removed
-    return FlightRepository::getInstance()->updateFlight(*flight);
+    return FlightRepository::getInstance() -> modifyFlight(flightId, [&crewMemberId](FlightModel& flight) {
+        return flight.removeCrewMemberId(crewMemberId);
+    });
 }
 /**
  * @brief Retrieves all crew members associated with a specific flight.
@@ -245,4 +299,16 @@ std::vector<std::shared_ptr<CrewMemberModel>> FlightService::getCrewMembersOfFli
         }
     }
     return crewMembers;
-}
\ No newline at end of file
+}
+/**
+ * @brief Runs a task on the thread owning the shard of a flight.
+ * 
+ * Delegates to FlightRepository::runOnFlightShard(). Unknown flights are routed to the
+ * first shard, where the task will simply not find them.
+ * 
+ * @param flightId The unique identifier of the flight the task works on
+ * @param task The task to run
+ */
+void FlightService::runOnFlightShard(const std::string& flightId, const std::function<void()>& task) {
+    FlightRepository::getInstance() -> runOnFlightShard(flightId, task);
+}
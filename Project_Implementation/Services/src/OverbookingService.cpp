@@ -0,0 +1,110 @@
+#include "../include/OverbookingService.hpp"
+#include "../../Repositories/include/OverbookingRepository.hpp"
+#include "../../Repositories/include/AircraftRepository.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Number of recorded outcomes a route needs before its no-show rate is trusted.
+ */
+static const std::uint64_t MIN_OUTCOMES_FOR_OVERBOOKING = 20;
+
+/**
+ * @brief Largest share of the capacity that may be sold beyond the physical seats.
+ */
+static const double MAX_OVERBOOKING_RATIO = 0.15;
+
+/**
+ * @brief Returns the capacity of a flight's aircraft, or 0 if the aircraft is unknown.
+ */
+static int getPhysicalCapacity(const FlightModel& flight) {
+    auto aircraft = AircraftRepository::getInstance() -> findAircraftById(flight.getAircraftId());
+    return aircraft.has_value() ? aircraft.value() -> getCapacity() : 0;
+}
+
+/**
+ * @brief Computes the no-show rate of a route from its statistics.
+ */
+static double computeNoShowRate(const OverbookingRepository::RouteStatistics& statistics) {
+    std::uint64_t outcomes = statistics.boarded + statistics.noShows;
+    if (outcomes == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(statistics.noShows) / static_cast<double>(outcomes);
+}
+
+/**
+ * @brief Returns how many reservations a flight may sell in total.
+ *
+ * The limit cached for the flight is returned as long as the route's statistics and the
+ * flight's aircraft are the ones it was computed from. Otherwise it is recomputed from
+ * the aircraft's capacity and the route's no-show rate, and cached again.
+ *
+ * @param flight The flight.
+ * @return int The authorized capacity, at least the aircraft's capacity.
+ */
+int OverbookingService::getAuthorizedCapacity(const FlightModel& flight) {
+    auto repository = OverbookingRepository::getInstance();
+    std::string route = OverbookingRepository::getRouteKey(flight.getOrigin(), flight.getDestination());
+    auto statistics = repository -> getRouteStatistics(route);
+
+    auto cached = repository -> findCapacityLimit(flight.getFlightId());
+    if (cached.has_value() && cached -> routeGeneration == statistics.generation &&
+        cached -> route == route && cached -> aircraftId == flight.getAircraftId()) {
+        return cached -> authorizedCapacity;
+    }
+
+    int capacity = getPhysicalCapacity(flight);
+    int authorizedCapacity = capacity;
+    if (statistics.boarded + statistics.noShows >= MIN_OUTCOMES_FOR_OVERBOOKING) {
+        double maxCapacity = std::floor(capacity * (1.0 + MAX_OVERBOOKING_RATIO));
+        double noShowRate = computeNoShowRate(statistics);
+        double expected = (noShowRate < 1.0) ? std::floor(capacity / (1.0 - noShowRate)) : maxCapacity;
+        authorizedCapacity = static_cast<int>(std::min(expected, maxCapacity));
+    }
+    repository -> setCapacityLimit(flight.getFlightId(), {authorizedCapacity, statistics.generation, route, flight.getAircraftId()});
+    return authorizedCapacity;
+}
+
+/**
+ * @brief Checks whether a fully booked flight may sell another reservation without a seat.
+ *
+ * @param flight The flight.
+ * @return true if every seat is taken and the reservations already sold without a seat
+ *         leave room below the authorized capacity; false otherwise.
+ */
+bool OverbookingService::canSellWithoutSeat(const FlightModel& flight) {
+    if (!flight.isFullyBooked()) {
+        return false;
+    }
+    int allowance = getAuthorizedCapacity(flight) - getPhysicalCapacity(flight);
+    if (allowance <= 0) {
+        return false;
+    }
+    return OverbookingRepository::getInstance() -> countUnassigned(flight.getFlightId()) < static_cast<std::size_t>(allowance);
+}
+
+/**
+ * @brief Returns the share of reservations on a route that ended as no-shows.
+ *
+ * @param origin The origin of the route.
+ * @param destination The destination of the route.
+ * @return double The no-show rate between 0 and 1, or 0 if no outcome was recorded yet.
+ */
+double OverbookingService::getNoShowRate(const std::string& origin, const std::string& destination) {
+    auto route = OverbookingRepository::getRouteKey(origin, destination);
+    return computeNoShowRate(OverbookingRepository::getInstance() -> getRouteStatistics(route));
+}
+
+/**
+ * @brief Counts the outcome of a reservation into the statistics of its flight's route.
+ *
+ * This invalidates the cached authorized capacity of every flight on the route.
+ *
+ * @param flight The flight of the reservation.
+ * @param boarded true if the passenger boarded, false for a no-show.
+ */
+void OverbookingService::recordOutcome(const FlightModel& flight, bool boarded) {
+    auto route = OverbookingRepository::getRouteKey(flight.getOrigin(), flight.getDestination());
+    OverbookingRepository::getInstance() -> recordOutcome(route, boarded);
+}
@@ -35,10 +35,7 @@ std::optional<std::shared_ptr<PaymentModel>> PaymentService::createPayment(const
     // Get the payment strategy based on the method
     try {
         auto paymentStrategy = PaymentStrategyFactory::createPaymentStrategy(method, paymentDetails);
-        if (!paymentStrategy) {
-            return std::nullopt;
-        }
-        auto payment = std::make_shared<PaymentModel>(passengerId, amount, paymentStrategy);
+        auto payment = std::make_shared<PaymentModel>(passengerId, amount, std::move(paymentStrategy));
         if (!payment) {
             return std::nullopt;
         }
@@ -86,4 +83,61 @@ std::string PaymentService::refundPayment(const std::string& paymentId) {
         return "Payment not found";
     }
     return paymentOpt.value() -> refundPayment();
-}
\ No newline at end of file
+}
+/**
+ * @brief Deletes a payment with the specified payment ID.
+ *
+ * Used to discard a payment whose reservation could not be stored, so that no charge is
+ * left without a reservation it pays for.
+ *
+ * @param paymentId The unique identifier of the payment to delete.
+ * @return true if the payment was deleted; false if it does not exist.
+ */
+bool PaymentService::deletePayment(const std::string& paymentId) {
+    return PaymentRepository::getInstance() -> deletePayment(paymentId);
+}
+/**
+ * @brief Splits a payment into equal parts, one per reservation it has to pay for.
+ *
+ * Used when one booking turns into several reservations, such as the legs of a
+ * connection, so that every reservation has a payment of its own that can be refunded
+ * on its own. The payment keeps the first part, and with it any rounding remainder;
+ * every other part becomes a new payment with the same passenger, method, date and
+ * status. Nothing is changed if any part cannot be created.
+ *
+ * @param paymentId The unique identifier of the payment to split.
+ * @param parts The number of parts, at least 2.
+ * @return std::vector<std::string> The IDs of the new payments, in order; empty if the payment
+ *         does not exist, parts is less than 2 or a part could not be created.
+ */
+std::vector<std::string> PaymentService::splitPayment(const std::string& paymentId, std::size_t parts) {
+    auto paymentRepository = PaymentRepository::getInstance();
+    auto paymentOpt = paymentRepository -> findPaymentById(paymentId);
+    if (!paymentOpt.has_value() || parts < 2) {
+        return {};
+    }
+    PaymentModel payment = *paymentOpt.value();
+    const double share = payment.getAmount() / static_cast<double>(parts);
+    std::vector<PaymentModel> newPayments;
+    try {
+        for (std::size_t part = 1; part < parts; part++) {
+            newPayments.emplace_back(payment.getPassengerId(), share, payment.getPaymentStrategy(), payment.getStatus(), payment.getPaymentDate());
+        }
+    } catch (const std::exception&) {
+        return {};
+    }
+
+    std::vector<std::string> paymentIds;
+    for (const auto& newPayment : newPayments) {
+        if (!paymentRepository -> addPayment(newPayment)) {
+            for (const auto& added : paymentIds) {
+                paymentRepository -> deletePayment(added);
+            }
+            return {};
+        }
+        paymentIds.push_back(newPayment.getPaymentId());
+    }
+    payment.setAmount(payment.getAmount() - share * static_cast<double>(parts - 1));
+    paymentRepository -> updatePayment(payment);
+    return paymentIds;
+}
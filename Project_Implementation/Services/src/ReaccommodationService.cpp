@@ -0,0 +1,515 @@
+#include "../include/ReaccommodationService.hpp"
+#include "../include/FlightService.hpp"
+#include "../include/PaymentService.hpp"
+#include "../../Model/include/FareRules.hpp"
+#include "../../Model/include/Passenger.hpp"
+#include "../../Model/include/ReservationModelBuilder.hpp"
+#include "../../Repositories/include/ArchiveRepository.hpp"
+#include "../../Repositories/include/FlightRepository.hpp"
+#include "../../Repositories/include/FlightSnapshotPublisher.hpp"
+#include "../../Repositories/include/MutationLog.hpp"
+#include "../../Repositories/include/PaymentRepository.hpp"
+#include "../../Repositories/include/ReservationRepository.hpp"
+#include "../../Repositories/include/UserRepository.hpp"
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using FlightRow = std::shared_ptr<const FlightModel>;
+using SeatMap = std::vector<std::vector<bool>>;
+
+/**
+ * @brief A way from the origin to the destination of the removed flight: one flight, or two.
+ */
+struct Itinerary {
+    std::vector<FlightRow> legs;
+};
+
+/**
+ * @brief A confirmed reservation of the removed flight, with the itinerary and seats planned for it.
+ */
+struct AffectedReservation {
+    std::shared_ptr<ReservationModel> reservation;
+    float loyaltyPoints = 0.0f;
+    FareRules::Cabin cabin = FareRules::Cabin::Economy;
+    std::optional<std::size_t> itinerary;
+    std::vector<std::string> seats;
+    std::vector<bool> booked;
+};
+
+/**
+ * @brief A seat to book, or to release, on one leg of a passenger's itinerary.
+ */
+struct SeatBooking {
+    std::size_t passenger;
+    std::size_t leg;
+    std::string flightId;
+    std::string seatNumber;
+    bool booked = false;
+};
+
+/**
+ * @brief Splits a seat number such as "12C" into its zero-based row and column.
+ */
+static std::optional<std::pair<std::size_t, std::size_t>> parseSeatNumber(const std::string& seatNumber) {
+    const auto column = seatNumber.find_first_not_of("0123456789");
+    if (column == std::string::npos || column == 0 || column + 1 != seatNumber.size() || seatNumber[column] < 'A') {
+        return std::nullopt;
+    }
+    std::size_t row = std::stoul(seatNumber.substr(0, column));
+    if (row == 0) {
+        return std::nullopt;
+    }
+    return std::make_pair(row - 1, static_cast<std::size_t>(seatNumber[column] - 'A'));
+}
+
+/**
+ * @brief Builds the seat number of a zero-based row and column.
+ */
+static std::string formatSeatNumber(std::size_t row, std::size_t column) {
+    return std::to_string(row + 1) + static_cast<char>('A' + column);
+}
+
+/**
+ * @brief Counts the free seats of a seat map.
+ */
+static std::size_t countFreeSeats(const SeatMap& seatMap) {
+    std::size_t freeSeats = 0;
+    for (const auto& row : seatMap) {
+        freeSeats += static_cast<std::size_t>(std::count(row.begin(), row.end(), false));
+    }
+    return freeSeats;
+}
+
+/**
+ * @brief Picks a free seat for a passenger.
+ *
+ * The passenger's seat number on the removed flight comes first, then the first free seat
+ * of the passenger's cabin, then the first free seat of the flight.
+ *
+ * @param seatMap The seat map of the flight, true for occupied seats.
+ * @param preferredSeat The passenger's seat number; empty if the passenger had no seat.
+ * @param cabin The passenger's cabin.
+ * @return std::optional<std::string> The seat number, or std::nullopt if the flight is full.
+ */
+static std::optional<std::string> chooseSeat(const SeatMap& seatMap, const std::string& preferredSeat, FareRules::Cabin cabin) {
+    auto preferred = parseSeatNumber(preferredSeat);
+    if (preferred.has_value() && preferred -> first < seatMap.size() &&
+        preferred -> second < seatMap[preferred -> first].size() && !seatMap[preferred -> first][preferred -> second]) {
+        return preferredSeat;
+    }
+    std::optional<std::string> anySeat;
+    for (std::size_t row = 0; row < seatMap.size(); row++) {
+        for (std::size_t column = 0; column < seatMap[row].size(); column++) {
+            if (seatMap[row][column]) {
+                continue;
+            }
+            if (FareRules::getCabin(row) == cabin) {
+                return formatSeatNumber(row, column);
+            }
+            if (!anySeat.has_value()) {
+                anySeat = formatSeatNumber(row, column);
+            }
+        }
+    }
+    return anySeat;
+}
+
+/**
+ * @brief Returns the loyalty points of a passenger, or 0 if the user is not a passenger.
+ */
+static float getLoyaltyPoints(const std::string& passengerId) {
+    auto passenger = UserRepository::getInstance() -> findPassengerById(passengerId);
+    return passenger.has_value() ? passenger.value() -> getLoyaltyPoints() : 0.0f;
+}
+
+/**
+ * @brief Finds the itineraries replacing a removed flight, best first.
+ *
+ * Flights of the same route departing no earlier than the removed flight come first, by
+ * departure time. Only if they have fewer free seats than needed are one-stop connections
+ * added: a first leg leaving the origin no earlier than the removed flight and a second
+ * leg leaving after the first one has landed, by arrival time at the destination.
+ *
+ * @param removedFlight The removed flight.
+ * @param seatsNeeded The number of passengers to re-accommodate.
+ * @return std::vector<Itinerary> The itineraries, direct flights first.
+ */
+static std::vector<Itinerary> findItineraries(const FlightModel& removedFlight, std::size_t seatsNeeded) {
+    auto repository = FlightRepository::getInstance();
+    const auto departures = repository -> getFlightsDepartingFrom(removedFlight.getOrigin(), removedFlight.getDepartureTime());
+
+    std::vector<Itinerary> itineraries;
+    std::size_t directSeats = 0;
+    for (const auto& flight : departures) {
+        if (flight -> getFlightId() != removedFlight.getFlightId() && flight -> getDestination() == removedFlight.getDestination()) {
+            itineraries.push_back({{flight}});
+            directSeats += countFreeSeats(flight -> getSeatMap());
+        }
+    }
+    if (directSeats >= seatsNeeded) {
+        return itineraries;
+    }
+
+    std::vector<Itinerary> connections;
+    for (const auto& first : departures) {
+        if (first -> getFlightId() == removedFlight.getFlightId() ||
+            first -> getDestination() == removedFlight.getDestination() ||
+            first -> getDestination() == removedFlight.getOrigin()) {
+            continue;
+        }
+        for (const auto& second : repository -> getFlightsDepartingFrom(first -> getDestination(), first -> getArrivalTime())) {
+            if (second -> getDestination() == removedFlight.getDestination() && first -> getArrivalTime() < second -> getDepartureTime()) {
+                connections.push_back({{first, second}});
+            }
+        }
+    }
+    std::stable_sort(connections.begin(), connections.end(), [](const Itinerary& a, const Itinerary& b) {
+        return a.legs.back() -> getArrivalTime() < b.legs.back() -> getArrivalTime();
+    });
+    itineraries.insert(itineraries.end(), connections.begin(), connections.end());
+    return itineraries;
+}
+
+/**
+ * @brief Plans an itinerary and seats for every passenger, in priority order.
+ *
+ * Each passenger gets the first itinerary with a free seat on every leg. The seats are
+ * taken from copies of the snapshot's seat maps, so later passengers see them as occupied.
+ *
+ * @param affected The passengers, sorted by priority.
+ * @param itineraries The itineraries, best first.
+ */
+static void planSeats(std::vector<AffectedReservation>& affected, const std::vector<Itinerary>& itineraries) {
+    std::unordered_map<std::string, SeatMap> seatMaps;
+    std::unordered_map<std::string, std::size_t> freeSeats;
+    for (const auto& itinerary : itineraries) {
+        for (const auto& leg : itinerary.legs) {
+            if (seatMaps.emplace(leg -> getFlightId(), leg -> getSeatMap()).second) {
+                freeSeats[leg -> getFlightId()] = countFreeSeats(leg -> getSeatMap());
+            }
+        }
+    }
+
+    for (auto& passenger : affected) {
+        for (std::size_t i = 0; i < itineraries.size(); i++) {
+            const auto& legs = itineraries[i].legs;
+            bool hasRoom = std::all_of(legs.begin(), legs.end(), [&freeSeats](const FlightRow& leg) {
+                return freeSeats[leg -> getFlightId()] > 0;
+            });
+            if (!hasRoom) {
+                continue;
+            }
+            passenger.itinerary = i;
+            passenger.booked.assign(legs.size(), false);
+            for (const auto& leg : legs) {
+                auto& seatMap = seatMaps[leg -> getFlightId()];
+                std::string seat = chooseSeat(seatMap, passenger.reservation -> getSeatNumber(), passenger.cabin).value();
+                auto indices = parseSeatNumber(seat).value();
+                seatMap[indices.first][indices.second] = true;
+                freeSeats[leg -> getFlightId()]--;
+                passenger.seats.push_back(std::move(seat));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Groups seat bookings by the shard owning their flight.
+ */
+static std::vector<std::vector<SeatBooking>> groupByShard(std::vector<SeatBooking> bookings) {
+    auto repository = FlightRepository::getInstance();
+    std::vector<std::vector<SeatBooking>> perShard(repository -> getShardCount());
+    for (auto& booking : bookings) {
+        std::size_t shard = repository -> findShardOfFlight(booking.flightId).value_or(0);
+        perShard[shard].push_back(std::move(booking));
+    }
+    return perShard;
+}
+
+/**
+ * @brief Books or releases seats on the flights of one shard, on that shard's thread.
+ *
+ * When booking, a planned seat taken since the snapshot was read is replaced by another
+ * free seat of the same flight; the booking fails if the flight is full by now. Every
+ * flight changed is committed once.
+ *
+ * @param bookings The seats of the shard's flights; booked is set on the bookings made.
+ * @param affected The passengers, for their cabins.
+ * @param book true to book the seats, false to release them.
+ */
+static void changeSeats(std::vector<SeatBooking>& bookings, const std::vector<AffectedReservation>& affected, bool book) {
+    auto repository = FlightRepository::getInstance();
+    std::unordered_map<std::string, std::shared_ptr<FlightModel>> changed;
+    for (auto& booking : bookings) {
+        auto flight = repository -> findFlightById(booking.flightId);
+        if (!flight.has_value()) {
+            continue;
+        }
+        try {
+            if (book && flight.value() -> getSeatStatus(booking.seatNumber)) {
+                auto seat = chooseSeat(flight.value() -> getSeatMap(), booking.seatNumber, affected[booking.passenger].cabin);
+                if (!seat.has_value()) {
+                    continue;
+                }
+                booking.seatNumber = seat.value();
+            }
+            flight.value() -> setSeatStatus(booking.seatNumber, book);
+        } catch (const std::invalid_argument&) {
+            continue; // The flight's aircraft changed since the snapshot was read
+        }
+        booking.booked = book;
+        changed.emplace(booking.flightId, flight.value());
+    }
+    for (const auto& [flightId, flight] : changed) {
+        repository -> commitVersion(*flight);
+        MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
+    }
+}
+
+/**
+ * @brief Books or releases seats on every shard in parallel.
+ *
+ * @param bookings The seats to book or release.
+ * @param affected The passengers, for their cabins.
+ * @param book true to book the seats, false to release them.
+ * @return std::vector<SeatBooking> The bookings, with the seats actually booked.
+ */
+static std::vector<SeatBooking> changeSeatsOnAllShards(std::vector<SeatBooking> bookings, const std::vector<AffectedReservation>& affected, bool book) {
+    auto perShard = groupByShard(std::move(bookings));
+    FlightRepository::getInstance() -> runOnAllShards([&](std::size_t shard) {
+        changeSeats(perShard[shard], affected, book);
+    });
+    std::vector<SeatBooking> results;
+    for (auto& shardBookings : perShard) {
+        results.insert(results.end(), shardBookings.begin(), shardBookings.end());
+    }
+    return results;
+}
+
+/**
+ * @brief Moves a passenger's reservation to its booked itinerary.
+ *
+ * The reservation itself moves to the first leg and a reservation is added for the second
+ * leg of a connection. The reservation's payment is split evenly between the legs, so
+ * every leg has a payment of its own. The reservations of the later legs are built first,
+ * and the payment is split together with the move of the reservation, so nothing is
+ * changed if either fails.
+ *
+ * @param passenger The passenger, with a seat booked on every leg.
+ * @param legs The legs of the passenger's itinerary.
+ * @return true if the reservation was moved; false otherwise.
+ */
+static bool moveReservation(const AffectedReservation& passenger, const std::vector<FlightRow>& legs) {
+    auto reservationRepository = ReservationRepository::getInstance();
+    const auto& reservation = passenger.reservation;
+    std::vector<std::shared_ptr<ReservationModel>> connectingReservations;
+    try {
+        for (std::size_t leg = 1; leg < legs.size(); leg++) {
+            ReservationModelBuilder builder;
+            builder.setFlightId(legs[leg] -> getFlightId())
+            .setPassengerId(reservation -> getPassengerId())
+            .setSeatNumber(passenger.seats[leg])
+            .setPaymentId(reservation -> getPaymentId());
+            connectingReservations.push_back(std::move(builder).build());
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    std::vector<std::string> legPaymentIds;
+    bool moved = reservationRepository -> modifyReservation(reservation -> getReservationId(), [&](ReservationModel& stored) {
+        if (legs.size() > 1) {
+            legPaymentIds = PaymentService::splitPayment(stored.getPaymentId(), legs.size());
+            if (legPaymentIds.size() != connectingReservations.size()) {
+                return false;
+            }
+        }
+        stored.setFlightId(legs.front() -> getFlightId());
+        stored.assignSeatNumber(passenger.seats.front());
+        return true;
+    });
+    if (!moved) {
+        return false;
+    }
+    for (std::size_t leg = 0; leg < connectingReservations.size(); leg++) {
+        connectingReservations[leg] -> setPaymentId(legPaymentIds[leg]);
+        reservationRepository -> emplaceReservation(std::move(connectingReservations[leg]));
+    }
+    return true;
+}
+
+/**
+ * @brief Moves the reservations of a removed flight that are kept as history to the archive.
+ *
+ * The removed flight is archived with the reservations and their payments, which are then
+ * removed from the working set, where no reservation may refer to a removed flight. A
+ * payment another reservation of the passenger still uses stays in the working set as well.
+ * If the archive cannot be written, the reservations are removed from the working set all
+ * the same and the error is passed on.
+ *
+ * @param removedFlight The removed flight.
+ * @param history The reservations to keep.
+ * @throws std::runtime_error If the archive cannot be written.
+ */
+static void archiveHistory(const FlightModel& removedFlight, const std::vector<std::shared_ptr<ReservationModel>>& history) {
+    if (history.empty()) {
+        return;
+    }
+    auto reservationRepository = ReservationRepository::getInstance();
+    auto paymentRepository = PaymentRepository::getInstance();
+    ArchiveRepository::FlightRecord record;
+    record.flight = std::make_shared<FlightModel>(removedFlight);
+    record.reservations = history;
+    for (const auto& reservation : history) {
+        auto payment = paymentRepository -> findPaymentById(reservation -> getPaymentId());
+        if (payment.has_value()) {
+            record.payments.push_back(payment.value());
+        }
+    }
+
+    std::exception_ptr failure;
+    try {
+        ArchiveRepository::getInstance() -> archiveFlights({record});
+    } catch (const std::exception&) {
+        failure = std::current_exception();
+    }
+    for (const auto& reservation : history) {
+        reservationRepository -> deleteReservation(reservation -> getReservationId());
+    }
+    if (!failure) {
+        for (const auto& payment : record.payments) {
+            const auto others = reservationRepository -> findReservationsByPassenger(payment -> getPassengerId());
+            bool inUse = std::any_of(others.begin(), others.end(), [&payment](const std::shared_ptr<ReservationModel>& other) {
+                return other -> getPaymentId() == payment -> getPaymentId();
+            });
+            if (!inUse) {
+                paymentRepository -> deletePayment(payment -> getPaymentId());
+            }
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+/**
+ * @brief Removes a flight and moves its passengers to other flights.
+ *
+ * The flight's reservations are collected and the flight deleted in one task on its
+ * shard, so no reservation is added to it in between. Its confirmed reservations are
+ * then re-accommodated as described in the class documentation. Those that could not be
+ * placed are cancelled and their payments refunded; they are archived with the flight's
+ * boarded, no-show and cancelled reservations. Seats booked on one leg of a connection
+ * whose other leg filled up in the meantime are released again.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::optional<Report> How many reservations were rebooked, rebooked with a
+ *         connection or cancelled; std::nullopt if the flight does not exist.
+ * @throws std::runtime_error If the kept reservations cannot be archived; they are
+ *         removed from the working set all the same.
+ */
+std::optional<ReaccommodationService::Report> ReaccommodationService::removeFlight(const std::string& flightId) {
+    auto reservationRepository = ReservationRepository::getInstance();
+    std::optional<FlightModel> removedFlight;
+    std::vector<std::shared_ptr<ReservationModel>> reservations;
+    FlightService::runOnFlightShard(flightId, [&] {
+        auto flight = FlightRepository::getInstance() -> findFlightById(flightId);
+        if (!flight.has_value()) {
+            return;
+        }
+        reservations = reservationRepository -> findReservationsByFlight(flightId);
+        removedFlight = *flight.value();
+        if (!FlightService::deleteFlight(flightId)) {
+            removedFlight.reset();
+        }
+    });
+    if (!removedFlight.has_value()) {
+        return std::nullopt;
+    }
+
+    Report report;
+    std::vector<AffectedReservation> affected;
+    std::vector<std::shared_ptr<ReservationModel>> history;
+    for (const auto& reservation : reservations) {
+        if (reservation -> getStatus() != ReservationModel::ReservationStatus::CONFIRMED) {
+            history.push_back(reservation);
+            continue;
+        }
+        AffectedReservation passenger;
+        passenger.reservation = reservation;
+        passenger.loyaltyPoints = getLoyaltyPoints(reservation -> getPassengerId());
+        auto seat = parseSeatNumber(reservation -> getSeatNumber());
+        // Reservations sold without a seat are priced, and so placed, as economy
+        passenger.cabin = seat.has_value() ? FareRules::getCabin(seat -> first) : FareRules::Cabin::Economy;
+        affected.push_back(std::move(passenger));
+    }
+    std::sort(affected.begin(), affected.end(), [](const AffectedReservation& a, const AffectedReservation& b) {
+        if (a.loyaltyPoints != b.loyaltyPoints) {
+            return a.loyaltyPoints > b.loyaltyPoints;
+        }
+        if (a.cabin != b.cabin) {
+            return a.cabin < b.cabin;
+        }
+        return a.reservation -> getReservationId() < b.reservation -> getReservationId();
+    });
+
+    const auto itineraries = findItineraries(removedFlight.value(), affected.size());
+    planSeats(affected, itineraries);
+
+    std::vector<SeatBooking> bookings;
+    for (std::size_t i = 0; i < affected.size(); i++) {
+        if (!affected[i].itinerary.has_value()) {
+            continue;
+        }
+        const auto& legs = itineraries[affected[i].itinerary.value()].legs;
+        for (std::size_t leg = 0; leg < legs.size(); leg++) {
+            bookings.push_back({i, leg, legs[leg] -> getFlightId(), affected[i].seats[leg]});
+        }
+    }
+    for (const auto& booking : changeSeatsOnAllShards(std::move(bookings), affected, true)) {
+        affected[booking.passenger].seats[booking.leg] = booking.seatNumber;
+        affected[booking.passenger].booked[booking.leg] = booking.booked;
+    }
+
+    std::vector<SeatBooking> releases;
+    for (std::size_t i = 0; i < affected.size(); i++) {
+        auto& passenger = affected[i];
+        bool placed = passenger.itinerary.has_value() &&
+            std::all_of(passenger.booked.begin(), passenger.booked.end(), [](bool booked) { return booked; });
+        if (placed) {
+            const auto& legs = itineraries[passenger.itinerary.value()].legs;
+            if (moveReservation(passenger, legs)) {
+                if (legs.size() == 1) {
+                    report.rebooked++;
+                } else {
+                    report.rebookedWithConnection++;
+                }
+                continue;
+            }
+        }
+        if (passenger.itinerary.has_value()) {
+            const auto& legs = itineraries[passenger.itinerary.value()].legs;
+            for (std::size_t leg = 0; leg < legs.size(); leg++) {
+                if (passenger.booked[leg]) {
+                    releases.push_back({i, leg, legs[leg] -> getFlightId(), passenger.seats[leg]});
+                }
+            }
+        }
+        PaymentService::refundPayment(passenger.reservation -> getPaymentId());
+        auto cancelled = std::make_shared<ReservationModel>(*passenger.reservation);
+        cancelled -> setStatus(ReservationModel::ReservationStatus::CANCELLED);
+        history.push_back(std::move(cancelled));
+        report.cancelled++;
+    }
+    if (!releases.empty()) {
+        changeSeatsOnAllShards(std::move(releases), affected, false);
+    }
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    archiveHistory(removedFlight.value(), history);
+    return report;
+}
@@ -4,42 +4,37 @@
 #include "../../Repositories/include/UserRepository.hpp"
 #include "../include/PaymentService.hpp"
 #include "../../Model/include/Passenger.hpp"
+#include "../../Model/include/FareRules.hpp"
 #include "../../Repositories/include/FlightRepository.hpp"
+#include "../../Repositories/include/FlightSnapshotPublisher.hpp"
+#include "../../Repositories/include/MutationLog.hpp"
+#include "../../Repositories/include/WaitlistRepository.hpp"
+#include "../../Repositories/include/OverbookingRepository.hpp"
+#include "../include/OverbookingService.hpp"
+#include <stdexcept>
+#include <utility>
 
 /**
  * @brief Calculates the price of a seat based on seat number and loyalty points.
  *
- * The price is determined by the seat's row and column:
- * - First class: rows 1-5 ($200 base price)
- * - Business class: rows 6-15 ($150 base price)
- * - Economy class: rows 16+ ($100 base price)
- * - Window seats (columns 'A' or 'F') add $20 premium
- * - Aisle seats (columns 'C' or 'D') add $10 premium
- *
+ * The base price of the seat is given by FareRules from its row, its column and the
+ * width of the aircraft's rows.
  * Loyalty points provide a discount: 1 point = $1 discount, up to a maximum of 30% off the base price.
  *
  * @param seatNumber The seat identifier (e.g., "12C").
+ * @param seatsPerRow The number of seats in each row of the flight's aircraft.
  * @param loyaltyPoints The number of loyalty points to apply as a discount.
  * @return The final seat price after applying any premiums and loyalty discount.
  */
-float ReservationService::getSeatPrice(const std::string& seatNumber, float loyaltyPoints) {
-    float basePrice = 100.0f; // Default base price
+float ReservationService::getSeatPrice(const std::string& seatNumber, std::size_t seatsPerRow, float loyaltyPoints) {
+    float basePrice = FareRules::getSeatlessFare();
 
     if (!seatNumber.empty()) {
         int row = std::stoi(seatNumber.substr(0, seatNumber.size() - 1));
         char col = seatNumber.back();
-
-        // First class: rows 1-5
-        if (row >= 1 && row <= 5) basePrice = 200.0f;
-        // Business class: rows 6-15
-        else if (row >= 6 && row <= 15) basePrice = 150.0f;
-        // Economy: rows 16+
-        else basePrice = 100.0f;
-
-        // Window seat premium (columns A or F)
-        if (col == 'A' || col == 'F') basePrice += 20.0f;
-        // Aisle seat premium (columns C or D)
-        else if (col == 'C' || col == 'D') basePrice += 10.0f;
+        if (row >= 1 && col >= 'A') {
+            basePrice = FareRules::getBaseFare(static_cast<std::size_t>(row - 1), static_cast<std::size_t>(col - 'A'), seatsPerRow);
+        }
     }
 
     // Loyalty points discount: 1 point = $1 discount, max 30% off
@@ -48,6 +43,162 @@ float ReservationService::getSeatPrice(const std::string& seatNumber, float loya
 
     return basePrice - discount;
 }
+/**
+ * @brief Looks up a passenger by user ID.
+ *
+ * @param passengerId The unique identifier of the passenger.
+ * @return std::shared_ptr<Passenger> The passenger, or nullptr if no passenger has this ID.
+ */
+std::shared_ptr<Passenger> ReservationService::findPassenger(const std::string& passengerId) {
+    auto passenger = UserRepository::getInstance() -> findPassengerById(passengerId);
+    return passenger.has_value() ? passenger.value() : nullptr;
+}
+/**
+ * @brief Charges a passenger for a free seat and stores the reservation.
+ *
+ * This method performs the following steps:
+ * - Calculates the seat price, applying loyalty points for discounts if available.
+ * - Processes the payment using the provided payment method and details.
+ * - Builds and stores the reservation if payment is successful.
+ * - Marks the seat as booked and updates the passenger's loyalty points (capped at 100).
+ *
+ * The flight is only changed in place: the caller commits its new version once all
+ * changes belonging to the same operation are made.
+ *
+ * @param flight The flight, with the seat still free.
+ * @param passenger The passenger the seat is booked for.
+ * @param seatNumber The seat number to be reserved, or an empty string for a reservation
+ *        sold beyond the physical seats, which is priced as economy and gets a seat later.
+ * @param paymentMethod The payment method to be used.
+ * @param paymentDetails Additional payment details in JSON format.
+ * @return std::optional<std::shared_ptr<ReservationModel>> The created reservation, or std::nullopt if the payment or the reservation failed.
+ * @throws std::invalid_argument If the reservation cannot be built; the payment is deleted first.
+ *
+ * @note If the reservation is not stored, the payment created for it is deleted again.
+ */
+std::optional<std::shared_ptr<ReservationModel>> ReservationService::bookSeat(
+    FlightModel& flight,
+    Passenger& passenger,
+    const std::string& seatNumber,
+    const std::string& paymentMethod,
+    const JSON& paymentDetails
+) {
+    auto loyaltyPoints = passenger.getLoyaltyPoints();
+    const auto& seatMap = flight.getSeatMap();
+    float seatPrice = getSeatPrice(seatNumber, seatMap.empty() ? 0 : seatMap.front().size(), loyaltyPoints);
+    if (loyaltyPoints > 0.0f) {
+        // Deduct 10% of the seat price after discount from loyalty points (post-discount deduction)
+        float deduction = std::min(loyaltyPoints, seatPrice * 0.1f); // Cap deduction to available points
+        loyaltyPoints -= deduction;
+    }
+    else {
+        loyaltyPoints += seatPrice * 0.1f; // Add 10% of seat price to loyalty points
+        loyaltyPoints = (loyaltyPoints > 100) ? 100 : loyaltyPoints; // Cap loyalty points at 100
+    }
+    auto paymentOpt = PaymentService::createPayment(passenger.getUserId(), seatPrice, paymentMethod, paymentDetails);
+    if (!paymentOpt.has_value()) {
+        return std::nullopt;
+    }
+    const std::string paymentId = paymentOpt.value() -> getPaymentId();
+    std::shared_ptr<ReservationModel> reservation;
+    try {
+        ReservationModelBuilder builder;
+        builder.setFlightId(flight.getFlightId())
+        .setPassengerId(passenger.getUserId())
+        .setSeatNumber(seatNumber)
+        .setPaymentId(paymentId);
+        reservation = std::move(builder).build();
+    } catch (const std::exception&) {
+        // The payment would be left without a reservation to pay for
+        PaymentService::deletePayment(paymentId);
+        throw;
+    }
+
+    if (!ReservationRepository::getInstance() -> emplaceReservation(reservation)) {
+        PaymentService::deletePayment(paymentId);
+        return std::nullopt;
+    }
+    if (!seatNumber.empty()) {
+        flight.setSeatStatus(seatNumber, true); // Mark seat as booked
+    }
+    passenger.setLoyaltyPoints(loyaltyPoints);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Users, passenger);
+    return reservation;
+}
+/**
+ * @brief Gives a freed seat to the next eligible passenger on the flight's waitlist.
+ *
+ * Entries are taken in priority order, each in O(log n), until the seat is booked or the
+ * waitlist is empty. An entry whose passenger no longer exists is dropped. An entry that
+ * cannot be booked for any other reason (its payment or its reservation failed) is set
+ * aside while the next one is tried, and put back on the waitlist with its original
+ * priority afterwards, so the passenger keeps their place for the next freed seat. The
+ * promoted passenger's payment is processed immediately. Like bookSeat(), the flight is
+ * only changed in place.
+ *
+ * @param flight The flight, with the seat just freed.
+ * @param seatNumber The freed seat.
+ * @return std::optional<std::shared_ptr<ReservationModel>> The reservation of the promoted passenger, or std::nullopt if nobody was promoted.
+ */
+std::optional<std::shared_ptr<ReservationModel>> ReservationService::promoteFromWaitlist(FlightModel& flight, const std::string& seatNumber) {
+    auto waitlistRepository = WaitlistRepository::getInstance();
+    std::optional<std::shared_ptr<ReservationModel>> promoted;
+    std::vector<std::shared_ptr<WaitlistEntryModel>> setAside;
+    while (!promoted.has_value()) {
+        auto entry = waitlistRepository -> popNextEntry(flight.getFlightId());
+        if (!entry.has_value()) {
+            break;
+        }
+        auto passenger = findPassenger(entry.value() -> getPassengerId());
+        if (!passenger) {
+            continue;
+        }
+        try {
+            promoted = bookSeat(flight, *passenger, seatNumber, entry.value() -> getPaymentMethod(), entry.value() -> getPaymentDetails());
+        } catch (const std::exception&) {
+            // The reservation could not be built for this passenger; try the next one.
+        }
+        if (!promoted.has_value()) {
+            setAside.push_back(entry.value());
+        }
+    }
+    for (auto& entry : setAside) {
+        waitlistRepository -> addEntry(std::move(entry));
+    }
+    if (promoted.has_value()) {
+        // Nobody is at the counter to settle the payment, so charge it right away.
+        PaymentService::processPayment(promoted.value() -> getPaymentId());
+    }
+    return promoted;
+}
+/**
+ * @brief Gives a seat that was just freed to whoever is waiting for one.
+ *
+ * Reservations sold beyond the physical seats come first, in the order they were sold;
+ * then passengers on the flight's waitlist, through promoteFromWaitlist(). Like bookSeat(),
+ * the flight is only changed in place.
+ *
+ * @param flight The flight, with the seat just freed.
+ * @param seatNumber The freed seat.
+ */
+void ReservationService::releaseSeat(FlightModel& flight, const std::string& seatNumber) {
+    auto overbookingRepository = OverbookingRepository::getInstance();
+    auto reservationRepository = ReservationRepository::getInstance();
+    while (auto reservationId = overbookingRepository -> popUnassigned(flight.getFlightId())) {
+        bool assigned = reservationRepository -> modifyReservation(reservationId.value(), [&seatNumber](ReservationModel& reservation) {
+            if (reservation.hasSeat() || reservation.getStatus() != ReservationModel::ReservationStatus::CONFIRMED) {
+                return false;
+            }
+            reservation.assignSeatNumber(seatNumber);
+            return true;
+        });
+        if (assigned) {
+            flight.setSeatStatus(seatNumber, true);
+            return;
+        }
+    }
+    promoteFromWaitlist(flight, seatNumber);
+}
 /**
  * @brief Retrieves all reservations from the repository.
  *
@@ -60,6 +211,24 @@ float ReservationService::getSeatPrice(const std::string& seatNumber, float loya
 std::vector<std::shared_ptr<ReservationModel>> ReservationService::getAllReservations() {
     return ReservationRepository::getInstance() -> getAllReservations();
 }
+/**
+ * @brief Visits every reservation in place, without collecting or copying them.
+ *
+ * @param visit Called once per reservation.
+ */
+void ReservationService::forEachReservation(const std::function<void(const ReservationModel&)>& visit) {
+    ReservationRepository::getInstance() -> forEachReservation(visit);
+}
+/**
+ * @brief Retrieves one page of reservations sorted by reservation ID.
+ *
+ * @param after The cursor returned with the previous page, or std::nullopt for the first page.
+ * @param limit The maximum number of reservations in the page.
+ * @return ReservationRepository::ReservationPage The reservations of the page and the cursor of the next page, if any.
+ */
+ReservationRepository::ReservationPage ReservationService::getReservationsPage(const std::optional<ReservationRepository::ReservationCursor>& after, std::size_t limit) {
+    return ReservationRepository::getInstance() -> getReservationsById(after, limit);
+}
 /**
  * @brief Retrieves a reservation by its unique identifier.
  *
@@ -89,15 +258,16 @@ std::vector<std::shared_ptr<ReservationModel>> ReservationService::getReservatio
 /**
  * @brief Adds a reservation for a passenger on a specified flight and seat.
  *
- * This method performs the following steps:
- * - Verifies the passenger exists and has the correct user role.
- * - Calculates the seat price, applying loyalty points for discounts if available.
- * - Updates the passenger's loyalty points (capped at 100).
- * - Processes the payment using the provided payment method and details.
- * - Builds and stores the reservation if payment is successful.
+ * This method verifies the passenger exists and has the correct user role and that the
+ * seat is free, then books the seat through bookSeat() and commits the flight.
+ *
+ * Once every seat is taken, reservations without a seat can still be sold up to the
+ * flight's authorized capacity (see OverbookingService); they get a seat when one is
+ * freed. Beyond that, passengers can join the flight's waitlist through joinWaitlist().
  *
  * @param flightId The unique identifier of the flight.
- * @param seatNumber The seat number to be reserved.
+ * @param seatNumber The seat number to be reserved, or an empty string to sell a
+ *        reservation without a seat on a fully booked flight.
  * @param passengerId The unique identifier of the passenger.
  * @param paymentMethod The payment method to be used.
  * @param paymentDetails Additional payment details in JSON format.
@@ -111,16 +281,10 @@ std::optional<std::shared_ptr<ReservationModel>> ReservationService::addReservat
     const std::string& paymentMethod,
     const JSON& paymentDetails
 ) {
-    auto userRepository = UserRepository::getInstance();
-    auto userOpt = userRepository -> findUserById(passengerId);
-    if (!userOpt.has_value() || (userOpt.value() -> getRole() != UserModel::UserType::Passenger)) {
-        return std::nullopt;
-    }
-    auto passenger = std::dynamic_pointer_cast<Passenger>(userOpt.value());
+    auto passenger = findPassenger(passengerId);
     if (!passenger) {
         return std::nullopt;
     }
-    auto loyaltyPoints = passenger -> getLoyaltyPoints();
 
     // check if seat is already booked for the flight
     auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
@@ -128,38 +292,25 @@ std::optional<std::shared_ptr<ReservationModel>> ReservationService::addReservat
         return std::nullopt;
     }
     auto flight = flightOpt.value();
-    if (flight -> getSeatStatus(seatNumber)) {
+    if (seatNumber.empty()) {
+        if (!OverbookingService::canSellWithoutSeat(*flight)) {
+            return std::nullopt; // Seats left, or authorized capacity reached
+        }
+    }
+    else if (flight -> getSeatStatus(seatNumber)) {
         return std::nullopt; // Seat already booked
     }
 
-    float seatPrice = getSeatPrice(seatNumber, loyaltyPoints);
-    if (loyaltyPoints > 0.0f) {
-        // Deduct 10% of the seat price after discount from loyalty points (post-discount deduction)
-        float deduction = std::min(loyaltyPoints, seatPrice * 0.1f); // Cap deduction to available points
-        loyaltyPoints -= deduction;
-    }
-    else {
-        loyaltyPoints += seatPrice * 0.1f; // Add 10% of seat price to loyalty points
-        loyaltyPoints = (loyaltyPoints > 100) ? 100 : loyaltyPoints; // Cap loyalty points at 100
-    }
-    auto paymentOpt = PaymentService::createPayment(passengerId, seatPrice, paymentMethod, paymentDetails);
-    if (!paymentOpt.has_value()) {
-        return std::nullopt;
-    }
-    auto reservation = ReservationModelBuilder()
-    .setFlightId(flightId)
-    .setPassengerId(passengerId)
-    .setSeatNumber(seatNumber)
-    .setPaymentId(paymentOpt.value() -> getPaymentId())
-    .build();
-    
-    if (ReservationRepository::getInstance() -> addReservation(*reservation)) {
-        flight -> setSeatStatus(seatNumber, true); // Mark seat as booked
-        passenger -> setLoyaltyPoints(loyaltyPoints);
-        return ReservationRepository::getInstance() -> findReservationById(reservation -> getReservationId());
+    auto reservation = bookSeat(*flight, *passenger, seatNumber, paymentMethod, paymentDetails);
+    if (reservation.has_value()) {
+        if (seatNumber.empty()) {
+            OverbookingRepository::getInstance() -> addUnassigned(flightId, reservation.value() -> getReservationId());
+        }
+        FlightRepository::getInstance() -> commitVersion(*flight);
+        MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
+        FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
     }
-
-    return std::nullopt;
+    return reservation;
 }
 
 /**
@@ -182,14 +333,24 @@ std::optional<std::shared_ptr<ReservationModel>> ReservationService::addReservat
  * - Manages seat bookings by unbooking the old seat and booking the new seat
  * 
  * @note If the flight ID or seat number has changed, the method will:
- * - Unbook the previous seat on the old flight
+ * - Unbook the previous seat
  * - Book the new seat on the new flight
+ *
+ * @note When the flight is unchanged, callers run this on the flight's shard. A change of
+ * flight is handed to moveToFlight(), which enters each flight's shard on its own and so
+ * must be called outside of any shard task.
+ * 
+ * @note The update is a compare-and-set against the version carried by the reservation,
+ * so callers should pass a modified copy of the reservation as they read it.
  * 
  * @warning Returns false if:
  * - The original reservation doesn't exist
+ * - The reservation was changed by someone else since it was read
  * - The new flight doesn't exist
  * - The new seat is already booked (when seat/flight changed)
  * - The repository update operation fails
+ *
+ * @throws std::logic_error If the flight changed and this is called from inside a shard task.
  */
 bool ReservationService::updateReservation(const ReservationModel& reservation) {
     // Retrieve the old reservation to check for seat/flight changes
@@ -211,6 +372,9 @@ bool ReservationService::updateReservation(const ReservationModel& reservation)
     else {
         return false;
     }
+    if (oldFlightId != reservation.getFlightId()) {
+        return moveToFlight(reservation, oldFlightId, oldSeatNumber);
+    }
 
     auto newFlightOpt = FlightRepository::getInstance() -> findFlightById(reservation.getFlightId());
     if (!newFlightOpt.has_value()) {
@@ -222,21 +386,105 @@ bool ReservationService::updateReservation(const ReservationModel& reservation)
         return false; // New seat already booked
     }
 
-    if (ReservationRepository::getInstance() -> updateReservation(reservation)) {
+    if (ReservationRepository::getInstance() -> compareAndSetReservation(reservation, reservation.getVersion())) {
         if (seatChanged) {
-            // Unbook the old seat
-            auto oldFlightOpt = FlightRepository::getInstance() -> findFlightById(oldFlightId);
-            if (oldFlightOpt.has_value()) {
-                auto oldFlight = oldFlightOpt.value();
-                oldFlight -> setSeatStatus(oldSeatNumber, false);
+            if (oldSeatNumber.empty()) {
+                // The reservation was sold without a seat and now gets one
+                OverbookingRepository::getInstance() -> removeUnassigned(oldFlightId, reservation.getReservationId());
+            }
+            else {
+                newFlight -> setSeatStatus(oldSeatNumber, false);
             }
             // Book the new seat
             newFlight -> setSeatStatus(reservation.getSeatNumber(), true);
         }
+        // Seats may also have been changed in place through ReservationModel::setSeatNumber
+        FlightRepository::getInstance() -> commitVersion(*newFlight);
+        MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *newFlight);
+        FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
         return true;
     }
     return false;
 }
+/**
+ * @brief Moves a reservation to another flight, one flight's shard at a time.
+ *
+ * The new seat is booked first, in a task on the new flight's shard. The reservation is
+ * then compare-and-set, which moves it to the new flight's shard after its own task.
+ * Last, the old seat is released in a task on the old flight's shard. No task waits on
+ * another shard, so two moves in opposite directions cannot block each other. If the
+ * reservation changed in the meantime, the new seat is released again and the passenger
+ * keeps the old one.
+ *
+ * @param reservation The updated reservation, carrying the version it was read at.
+ * @param previousFlightId The flight the reservation is on now.
+ * @param previousSeatNumber The seat it holds there, or an empty string if it has none.
+ * @return true if the reservation was moved; false if the new flight does not exist, the
+ *         new seat is invalid or booked, or the reservation changed since it was read.
+ * @throws std::logic_error If called from inside a shard task.
+ */
+bool ReservationService::moveToFlight(const ReservationModel& reservation, const std::string& previousFlightId, const std::string& previousSeatNumber) {
+    auto flightRepository = FlightRepository::getInstance();
+    if (flightRepository -> isRunningOnShard()) {
+        throw std::logic_error("A reservation cannot move to another flight from inside a shard task.");
+    }
+    const std::string& flightId = reservation.getFlightId();
+    const std::string& seatNumber = reservation.getSeatNumber();
+    bool seatBooked = false;
+    flightRepository -> runOnFlightShard(flightId, [&] {
+        auto flightOpt = flightRepository -> findFlightById(flightId);
+        if (!flightOpt.has_value() || !flightOpt.value() -> isValidSeat(seatNumber) || flightOpt.value() -> getSeatStatus(seatNumber)) {
+            return;
+        }
+        auto flight = flightOpt.value();
+        flight -> setSeatStatus(seatNumber, true);
+        flightRepository -> commitVersion(*flight);
+        MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
+        FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+        seatBooked = true;
+    });
+    if (!seatBooked) {
+        return false;
+    }
+
+    if (!ReservationRepository::getInstance() -> compareAndSetReservation(reservation, reservation.getVersion())) {
+        flightRepository -> runOnFlightShard(flightId, [&] {
+            releaseMovedSeat(flightId, seatNumber, reservation.getReservationId());
+        });
+        return false;
+    }
+    flightRepository -> runOnFlightShard(previousFlightId, [&] {
+        releaseMovedSeat(previousFlightId, previousSeatNumber, reservation.getReservationId());
+    });
+    return true;
+}
+/**
+ * @brief Frees the seat a reservation held on a flight it no longer is on.
+ *
+ * The last step of moveToFlight(), and its way back when the move fails. The seat is only
+ * marked free, as updateReservation() does for a seat change on the same flight; a
+ * reservation sold without a seat is taken off the flight's list of unassigned reservations.
+ * Callers run this on the flight's shard.
+ *
+ * @param flightId The unique identifier of the flight whose seat is released.
+ * @param seatNumber The seat the reservation held on that flight, or an empty string if it had none.
+ * @param reservationId The unique identifier of the moved reservation.
+ */
+void ReservationService::releaseMovedSeat(const std::string& flightId, const std::string& seatNumber, const std::string& reservationId) {
+    if (seatNumber.empty()) {
+        OverbookingRepository::getInstance() -> removeUnassigned(flightId, reservationId);
+        return;
+    }
+    auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
+    if (!flightOpt.has_value()) {
+        return;
+    }
+    auto flight = flightOpt.value();
+    flight -> setSeatStatus(seatNumber, false);
+    FlightRepository::getInstance() -> commitVersion(*flight);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+}
 /**
  * @brief Deletes a reservation with the specified reservation ID.
  *
@@ -244,6 +492,12 @@ bool ReservationService::updateReservation(const ReservationModel& reservation)
  * using the provided reservation ID. It delegates the deletion operation
  * to the ReservationRepository singleton instance.
  *
+ * The freed seat is immediately given to a reservation sold without a seat or to the
+ * next eligible passenger on the flight's waitlist, if any (see releaseSeat()), and the
+ * flight is committed once with both changes, so readers never
+ * see the seat free in between. Callers run this on the flight's shard, which makes the
+ * cancellation and the promotion one task.
+ *
  * @param reservationId The unique identifier of the reservation to be deleted.
  * @return true if the reservation was successfully deleted; false otherwise.
  */
@@ -254,12 +508,126 @@ bool ReservationService::deleteReservation(const std::string& reservationId) {
         return false;
     }
     auto reservation = reservationOpt.value();
+    // A no-show's seat was already released, possibly to someone else
+    bool holdsSeat = reservation->hasSeat() && reservation->getStatus() != ReservationModel::ReservationStatus::NO_SHOW;
     // Unbook the seat associated with the reservation
     auto flightOpt = FlightRepository::getInstance() -> findFlightById(reservation->getFlightId());
-    if (flightOpt.has_value()) {
+    if (flightOpt.has_value() && holdsSeat) {
         auto flight = flightOpt.value();
         flight -> setSeatStatus(reservation->getSeatNumber(), false);
     }
     // Delete the reservation
-    return ReservationRepository::getInstance() -> deleteReservation(reservationId);
+    if (!ReservationRepository::getInstance() -> deleteReservation(reservationId)) {
+        return false;
+    }
+    if (!reservation->hasSeat()) {
+        OverbookingRepository::getInstance() -> removeUnassigned(reservation->getFlightId(), reservationId);
+    }
+    if (flightOpt.has_value()) {
+        if (holdsSeat) {
+            releaseSeat(*flightOpt.value(), reservation->getSeatNumber());
+        }
+        FlightRepository::getInstance() -> commitVersion(*flightOpt.value());
+        MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flightOpt.value());
+    }
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    return true;
+}
+/**
+ * @brief Puts a passenger on the waitlist of a fully booked flight.
+ *
+ * The entry's priority is taken from the passenger's current loyalty points and the
+ * time of the request. The payment method and details are kept with the entry and
+ * charged when a seat is freed through deleteReservation().
+ *
+ * @param flightId The unique identifier of the flight.
+ * @param passengerId The unique identifier of the passenger.
+ * @param paymentMethod The payment method to be charged on promotion.
+ * @param paymentDetails Additional payment details in JSON format.
+ * @return std::optional<std::shared_ptr<WaitlistEntryModel>> The waitlist entry, or std::nullopt if the
+ *         passenger or flight does not exist or the flight can still sell reservations.
+ */
+std::optional<std::shared_ptr<WaitlistEntryModel>> ReservationService::joinWaitlist(
+    const std::string& flightId,
+    const std::string& passengerId,
+    const std::string& paymentMethod,
+    const JSON& paymentDetails
+) {
+    auto passenger = findPassenger(passengerId);
+    if (!passenger) {
+        return std::nullopt;
+    }
+    auto flightOpt = FlightRepository::getInstance() -> findFlightById(flightId);
+    if (!flightOpt.has_value() || !flightOpt.value() -> isFullyBooked() ||
+        OverbookingService::canSellWithoutSeat(*flightOpt.value())) {
+        return std::nullopt;
+    }
+    auto waitlistRepository = WaitlistRepository::getInstance();
+    auto entry = std::make_shared<WaitlistEntryModel>(flightId, passengerId, passenger -> getLoyaltyPoints(),
+        paymentMethod, paymentDetails, waitlistRepository -> nextSequence());
+    if (!waitlistRepository -> addEntry(entry)) {
+        return std::nullopt;
+    }
+    return entry;
+}
+/**
+ * @brief Returns the number of passengers waiting for a flight.
+ *
+ * @param flightId The unique identifier of the flight.
+ * @return std::size_t The length of the flight's waitlist.
+ */
+std::size_t ReservationService::getWaitlistLength(const std::string& flightId) {
+    return WaitlistRepository::getInstance() -> getWaitlistLength(flightId);
+}
+/**
+ * @brief Records whether the passenger of a confirmed reservation boarded or did not show up.
+ *
+ * The outcome is counted into the no-show statistics of the flight's route, which drive
+ * how far the route's flights are overbooked. The seat of a no-show is released right
+ * away and given to whoever is waiting for one (see releaseSeat()). Only passengers with
+ * a seat can board.
+ *
+ * @param reservationId The unique identifier of the reservation.
+ * @param boarded true if the passenger boarded, false for a no-show.
+ * @return true if the outcome was recorded; false if the reservation does not exist, is not
+ *         confirmed, or has no seat to board with.
+ */
+bool ReservationService::recordBoardingOutcome(const std::string& reservationId, bool boarded) {
+    // Make sure the statistics are loaded before the status changes, so it is counted once.
+    auto overbookingRepository = OverbookingRepository::getInstance();
+    auto reservationOpt = ReservationRepository::getInstance() -> findReservationById(reservationId);
+    if (!reservationOpt.has_value()) {
+        return false;
+    }
+    auto flightOpt = FlightRepository::getInstance() -> findFlightById(reservationOpt.value() -> getFlightId());
+    if (!flightOpt.has_value()) {
+        return false;
+    }
+    std::string seatNumber;
+    bool recorded = ReservationRepository::getInstance() -> modifyReservation(reservationId, [&](ReservationModel& reservation) {
+        if (reservation.getStatus() != ReservationModel::ReservationStatus::CONFIRMED || (boarded && !reservation.hasSeat())) {
+            return false;
+        }
+        reservation.setStatus(boarded ? ReservationModel::ReservationStatus::BOARDED : ReservationModel::ReservationStatus::NO_SHOW);
+        seatNumber = reservation.getSeatNumber();
+        return true;
+    });
+    if (!recorded) {
+        return false;
+    }
+    auto flight = flightOpt.value();
+    OverbookingService::recordOutcome(*flight, boarded);
+    if (boarded) {
+        return true;
+    }
+    if (seatNumber.empty()) {
+        overbookingRepository -> removeUnassigned(flight -> getFlightId(), reservationId);
+        return true;
+    }
+    flight -> setSeatStatus(seatNumber, false);
+    releaseSeat(*flight, seatNumber);
+    FlightRepository::getInstance() -> commitVersion(*flight);
+    MutationLog::getInstance() -> recordUpsert(MutationLog::Table::Flights, *flight);
+    FlightSnapshotPublisher::getInstance() -> publishIfEnabled();
+    return true;
 }
\ No newline at end of file
@@ -53,6 +53,24 @@ std::optional<std::shared_ptr<UserModel>> UserManagementService::authenticateUse
 std::vector<std::shared_ptr<UserModel>> UserManagementService::getAllUsers() {
     return UserRepository::getInstance() -> getAllUsers();
 }
+/**
+ * @brief Returns a view over all users, without copying them.
+ *
+ * @return RepositoryView<UserModel> A view valid until the next change to the users.
+ */
+RepositoryView<UserModel> UserManagementService::viewUsers() {
+    return UserRepository::getInstance() -> viewUsers();
+}
+/**
+ * @brief Finds the users whose username starts with a prefix.
+ *
+ * @param prefix The prefix, matched case-insensitively.
+ * @param limit The maximum number of users returned.
+ * @return std::vector<std::shared_ptr<UserModel>> The first matching users, sorted by username.
+ */
+std::vector<std::shared_ptr<UserModel>> UserManagementService::searchUsersByUsername(const std::string& prefix, std::size_t limit) {
+    return UserRepository::getInstance() -> findUsersByUsernamePrefix(prefix, limit);
+}
 
 /**
  * @brief Creates a new user with the specified username, password, and role.
@@ -125,7 +143,7 @@ bool UserManagementService::deleteUser(const std::string& userId) {
  * @brief Updates the password of a user identified by userId.
  *
  * This method attempts to find the user with the specified userId.
- * If the user exists, their password is updated to the provided newPassword,
+ * If the user exists, their password is updated in place to the provided newPassword,
  * and the change is persisted in the user repository.
  *
  * @param userId The unique identifier of the user whose password is to be updated.
@@ -133,13 +151,10 @@ bool UserManagementService::deleteUser(const std::string& userId) {
  * @return true if the password was successfully updated; false if the user does not exist or the update failed.
  */
 bool UserManagementService::updateUserPassword(const std::string& userId, const std::string& newPassword) {
-    auto userOpt = UserRepository::getInstance() -> findUserById(userId);
-    if (userOpt.has_value()) {
-        auto user = userOpt.value();
-        user -> setPassword(newPassword);
-        return UserRepository::getInstance() -> updateUser(*user);
-    }
-    return false;
+    return UserRepository::getInstance() -> modifyUser(userId, [&newPassword](UserModel& user) {
+        user.setPassword(newPassword);
+        return true;
+    });
 }
 /**
  * @brief Retrieves all users with a specific role from the repository.
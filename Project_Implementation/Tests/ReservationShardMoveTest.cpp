@@ -0,0 +1,185 @@
+#include "../Repositories/include/FlightRepository.hpp"
+#include "../Repositories/include/ReservationRepository.hpp"
+#include "../Services/include/FlightService.hpp"
+#include "../Services/include/ReservationService.hpp"
+#include "../Services/include/UserManagementService.hpp"
+#include "../Utils/include/DateTime.hpp"
+#include "../Utils/include/RuntimeOptions.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file ReservationShardMoveTest.cpp
+ * @brief Moves reservations between flights owned by different shards.
+ *
+ * Runs with two shards against its own copy of the database (see BUILD_TESTING in
+ * CMakeLists.txt). A move waits on both shards in turn; if it ever waited on one shard
+ * from inside the other's task, two requests could block each other forever, so a
+ * watchdog fails the test instead of letting it hang.
+ */
+
+static constexpr std::chrono::seconds WATCHDOG_TIMEOUT{20};
+static const std::string AIRCRAFT_ID = "AC-61737";
+
+/**
+ * @brief Fails the test with a message unless a condition holds.
+ */
+static void check(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+/**
+ * @brief Adds two flights on routes owned by different shards.
+ *
+ * @return std::pair<std::string, std::string> The IDs of the two flights.
+ */
+static std::pair<std::string, std::string> addFlightsOnTwoShards() {
+    auto flightRepository = FlightRepository::getInstance();
+    const std::vector<std::pair<std::string, std::string>> routes = {
+        {"CAI", "DXB"}, {"DXB", "CAI"}, {"CDG", "AMS"}, {"BCN", "ATL"}, {"BKK", "AUH"}, {"CMN", "CDG"}, {"AMS", "BCN"}
+    };
+    const DateTime departure(2031, 3, 1, 10, 0);
+    const DateTime arrival(2031, 3, 1, 14, 0);
+    std::vector<std::string> flightIds;
+    std::vector<std::size_t> flightShards;
+    for (std::size_t i = 0; i < routes.size(); i++) {
+        int day = static_cast<int>(i);
+        auto flight = FlightService::addFlight(routes[i].first, routes[i].second, departure.addDays(day), arrival.addDays(day), AIRCRAFT_ID);
+        check(flight.has_value(), "Failed to add a test flight.");
+        flightIds.push_back(flight.value() -> getFlightId());
+        flightShards.push_back(flightRepository -> findShardOfFlight(flightIds.back()).value());
+        for (std::size_t j = 0; j + 1 < flightIds.size(); j++) {
+            if (flightShards[j] != flightShards.back()) {
+                return {flightIds[j], flightIds.back()};
+            }
+        }
+    }
+    throw std::runtime_error("No two test routes are owned by different shards.");
+}
+
+/**
+ * @brief Moves a reservation to another flight through the repository's compare-and-set.
+ *
+ * From outside any shard task the reservation moves to the other flight's shard. From
+ * inside a shard task the move is refused before anything is written.
+ */
+static void testCompareAndSetMovesShards(const std::string& firstFlightId, const std::string& secondFlightId, const std::string& passengerId) {
+    auto reservationRepository = ReservationRepository::getInstance();
+    std::optional<std::shared_ptr<ReservationModel>> booked;
+    FlightService::runOnFlightShard(firstFlightId, [&] {
+        booked = ReservationService::addReservation(firstFlightId, "1A", passengerId, "cash", JSON::object());
+    });
+    check(booked.has_value(), "Failed to book the reservation to move.");
+    const std::string reservationId = booked.value() -> getReservationId();
+
+    ReservationModel moved(*booked.value());
+    moved.setFlightId(secondFlightId);
+    check(reservationRepository -> compareAndSetReservation(moved, moved.getVersion()), "The reservation was not moved.");
+    check(reservationRepository -> findReservationById(reservationId).value() -> getFlightId() == secondFlightId,
+        "The moved reservation is not on its new flight.");
+    bool onNewShard = false;
+    for (const auto& reservation : reservationRepository -> findReservationsByFlight(secondFlightId)) {
+        onNewShard = onNewShard || reservation -> getReservationId() == reservationId;
+    }
+    check(onNewShard, "The moved reservation is not held by its new flight's shard.");
+    check(reservationRepository -> findReservationsByFlight(firstFlightId).empty(), "The moved reservation is still held by its old flight's shard.");
+
+    ReservationModel back(*reservationRepository -> findReservationById(reservationId).value());
+    back.setFlightId(firstFlightId);
+    bool refused = false;
+    FlightService::runOnFlightShard(secondFlightId, [&] {
+        try {
+            reservationRepository -> compareAndSetReservation(back, back.getVersion());
+        } catch (const std::logic_error&) {
+            refused = true;
+        }
+    });
+    check(refused, "A move to another shard from inside a shard task was not refused.");
+    check(reservationRepository -> findReservationById(reservationId).value() -> getFlightId() == secondFlightId,
+        "A refused move changed the reservation.");
+}
+
+/**
+ * @brief Moves a booked reservation to a seat on another flight through ReservationService.
+ *
+ * From outside any shard task the new seat is booked and the old one released, each on
+ * its own flight's shard. From inside a shard task the move is refused.
+ */
+static void testServiceMovesSeats(const std::string& firstFlightId, const std::string& secondFlightId, const std::string& passengerId) {
+    auto flightRepository = FlightRepository::getInstance();
+    auto reservationRepository = ReservationRepository::getInstance();
+    std::optional<std::shared_ptr<ReservationModel>> booked;
+    FlightService::runOnFlightShard(firstFlightId, [&] {
+        booked = ReservationService::addReservation(firstFlightId, "2A", passengerId, "cash", JSON::object());
+    });
+    check(booked.has_value(), "Failed to book the reservation to move.");
+    const std::string reservationId = booked.value() -> getReservationId();
+
+    ReservationModel moved(*booked.value());
+    moved.setFlightId(secondFlightId);
+    moved.assignSeatNumber("2B");
+    bool refused = false;
+    FlightService::runOnFlightShard(secondFlightId, [&] {
+        try {
+            ReservationService::updateReservation(moved);
+        } catch (const std::logic_error&) {
+            refused = true;
+        }
+    });
+    check(refused, "A move to another flight from inside a shard task was not refused.");
+    check(!flightRepository -> findFlightById(secondFlightId).value() -> getSeatStatus("2B"), "A refused move booked the new seat.");
+
+    check(ReservationService::updateReservation(moved), "The reservation was not moved to the other flight.");
+    auto stored = reservationRepository -> findReservationById(reservationId).value();
+    check(stored -> getFlightId() == secondFlightId && stored -> getSeatNumber() == "2B", "The moved reservation does not hold its new seat.");
+    check(flightRepository -> findFlightById(secondFlightId).value() -> getSeatStatus("2B"), "The new seat was not booked.");
+    check(!flightRepository -> findFlightById(firstFlightId).value() -> getSeatStatus("2A"), "The old seat was not released.");
+}
+
+int main() {
+    char program[] = "ReservationShardMoveTest";
+    char shards[] = "--shards=2";
+    char* arguments[] = {program, shards};
+    RuntimeOptions::parse(2, arguments);
+
+    std::atomic<bool> finished{false};
+    std::thread watchdog([&finished] {
+        auto deadline = std::chrono::steady_clock::now() + WATCHDOG_TIMEOUT;
+        while (!finished.load()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                std::cerr << "FAILED: a reservation move did not return; the shards are waiting on each other." << std::endl;
+                std::_Exit(1);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    });
+
+    int status = 0;
+    try {
+        auto passenger = UserManagementService::createUser(
+            "shardmove_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()),
+            "test",
+            UserModel::UserType::Passenger
+        );
+        check(passenger.has_value(), "Failed to add the test passenger.");
+        auto [firstFlightId, secondFlightId] = addFlightsOnTwoShards();
+        testCompareAndSetMovesShards(firstFlightId, secondFlightId, passenger.value() -> getUserId());
+        testServiceMovesSeats(firstFlightId, secondFlightId, passenger.value() -> getUserId());
+        std::cout << "Reservation shard moves: OK" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "FAILED: " << e.what() << std::endl;
+        status = 1;
+    }
+    finished.store(true);
+    watchdog.join();
+    return status;
+}
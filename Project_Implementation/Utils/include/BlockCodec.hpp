@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <streambuf>
+#include <vector>
+
+/**
+ * @class BlockCodec
+ * @brief LZ4-style compression of independent blocks, and the framing of compressed files.
+ *
+ * A block is encoded as LZ4 sequences: a token holding the literal and match lengths,
+ * the literals, a two-byte little-endian offset back to the match, and length extension
+ * bytes of 255 for lengths of 15 or more. Matches are found through a hash table of the
+ * four-byte words seen so far and are at least four bytes long. The last five bytes of a
+ * block are always literals, so decoding never reads past its end.
+ *
+ * A compressed file starts with the MAGIC bytes, followed by blocks of at most BLOCK_SIZE
+ * raw bytes. Each block has a header of two little-endian 32-bit words, its raw size and
+ * its stored size; the STORED_RAW bit of the stored size marks a block that did not
+ * compress and is kept as is. A header with a raw size of 0 ends the file.
+ *
+ * @note This class cannot be instantiated; use the static methods.
+ */
+class BlockCodec {
+    public:
+        static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+        static constexpr std::size_t MAGIC_SIZE = 4;
+        static constexpr char MAGIC[MAGIC_SIZE] = {'A', 'M', 'S', 'Z'};
+        static constexpr std::uint32_t STORED_RAW = 0x80000000u;
+
+        BlockCodec() = delete;
+
+        static std::size_t getMaxCompressedSize(std::size_t rawSize);
+        static std::size_t compressBlock(const char* source, std::size_t size, char* destination);
+        static void decompressBlock(const char* source, std::size_t size, char* destination, std::size_t rawSize);
+        static bool isCompressed(std::istream& input);
+};
+
+/**
+ * @class BlockCompressingBuffer
+ * @brief Stream buffer compressing everything written through it into another stream buffer.
+ *
+ * Output is collected into one block at a time; every full block is compressed and
+ * written to the sink, so memory use does not grow with the size of the file. finish()
+ * writes the last partial block and the end marker, and is called by the destructor if
+ * it was not called before.
+ */
+class BlockCompressingBuffer : public std::streambuf {
+    std::streambuf* sink;
+    std::vector<char> block;
+    std::vector<char> compressed;
+    bool finished = false;
+
+    void writeBlock();
+
+    protected:
+        int_type overflow(int_type character) override;
+        int sync() override;
+
+    public:
+        explicit BlockCompressingBuffer(std::streambuf* sink);
+        BlockCompressingBuffer(const BlockCompressingBuffer&) = delete;
+        BlockCompressingBuffer& operator=(const BlockCompressingBuffer&) = delete;
+
+        void finish();
+
+        ~BlockCompressingBuffer() override;
+};
+
+/**
+ * @class BlockDecompressingBuffer
+ * @brief Stream buffer reading the decompressed contents of a compressed stream buffer.
+ *
+ * Blocks are read and decompressed one at a time, as the reader consumes them. Corrupt
+ * or truncated input throws std::runtime_error from the read that reaches it.
+ */
+class BlockDecompressingBuffer : public std::streambuf {
+    std::streambuf* source;
+    std::vector<char> block;
+    std::vector<char> compressed;
+    bool ended = false;
+
+    void readExactly(char* destination, std::size_t size);
+
+    protected:
+        int_type underflow() override;
+
+    public:
+        explicit BlockDecompressingBuffer(std::streambuf* source);
+        BlockDecompressingBuffer(const BlockDecompressingBuffer&) = delete;
+        BlockDecompressingBuffer& operator=(const BlockDecompressingBuffer&) = delete;
+};
@@ -23,7 +23,9 @@ struct DateTime {
 
     static DateTime now();
     bool operator<=(const DateTime& other) const;
+    bool operator<(const DateTime& other) const;
     bool sameDay(const DateTime& other) const;
+    DateTime addDays(int days) const;
     bool isValid() const;
 
     private:
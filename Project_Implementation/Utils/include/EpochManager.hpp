@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * @class EpochManager
+ * @brief Epoch-based reclamation of memory shared with lock-free readers.
+ *
+ * Readers pin the current epoch for as long as they hold pointers into shared data.
+ * Writers unlink old data first and then retire it; retired data is only freed once every
+ * reader that could still see it has unpinned. Pinning is two atomic stores and never
+ * blocks, so a long-running reader delays reclamation but never stalls writers.
+ *
+ * Every thread that pins gets one of MAX_THREADS slots for the lifetime of the process.
+ * The application only runs a fixed set of long-lived threads, so slots are never recycled.
+ *
+ * Copy and move operations are deleted to maintain singleton integrity.
+ */
+class EpochManager {
+    static constexpr std::size_t MAX_THREADS = 128;
+    static constexpr std::uint64_t IDLE = UINT64_MAX;
+
+    struct RetiredItem {
+        std::uint64_t epoch;
+        std::function<void()> reclaim;
+    };
+
+    std::atomic<std::uint64_t> globalEpoch{1};
+    std::array<std::atomic<std::uint64_t>, MAX_THREADS> pinnedEpochs;
+    std::atomic<std::size_t> registeredThreads{0};
+
+    mutable std::mutex retiredMutex;
+    std::deque<RetiredItem> retired;
+
+    EpochManager();
+    EpochManager(const EpochManager&) = delete;
+    EpochManager& operator=(const EpochManager&) = delete;
+    EpochManager(EpochManager&&) = delete;
+    EpochManager& operator=(EpochManager&&) = delete;
+
+    std::size_t getThreadSlot();
+    void enter();
+    void exit();
+
+    public:
+        /**
+         * @brief RAII pin of the current epoch; data read while it is alive stays valid.
+         */
+        class Guard {
+            EpochManager* manager;
+
+            public:
+                explicit Guard(EpochManager& manager);
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+                Guard(Guard&& other) noexcept;
+                Guard& operator=(Guard&&) = delete;
+                ~Guard();
+        };
+
+        static std::shared_ptr<EpochManager> getInstance();
+
+        inline Guard pin()                                  { return Guard(*this); }
+        inline std::uint64_t getEpoch() const               { return globalEpoch.load(); }
+
+        void retire(std::function<void()> reclaim);
+        std::size_t reclaim();
+        std::size_t getPendingCount() const;
+
+        ~EpochManager();
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include "BlockCodec.hpp"
+#include "../../Third_Party/json.hpp"
+
+using JSON = nlohmann::json;
+
+/**
+ * @class JSONArrayWriter
+ * @brief Writes a JSON array to a stream one element at a time.
+ *
+ * Each element is serialized straight into the stream as soon as it is written, so the
+ * array never exists as a whole in memory: saving a table needs the memory of one
+ * element, however many there are. The output is byte for byte what dumping the whole
+ * array would produce, indented by four spaces, or compact and streamed through a
+ * BlockCompressingBuffer when the database is run with --compress-database.
+ *
+ * finish() must be called after the last element to close the array.
+ */
+class JSONArrayWriter {
+    static constexpr unsigned int INDENT = 4;
+
+    std::unique_ptr<BlockCompressingBuffer> compressor;
+    std::ostream output;
+    nlohmann::detail::serializer<JSON> serializer;
+    bool pretty;
+    bool empty = true;
+
+    public:
+        explicit JSONArrayWriter(std::ostream& file);
+        JSONArrayWriter(const JSONArrayWriter&) = delete;
+        JSONArrayWriter& operator=(const JSONArrayWriter&) = delete;
+
+        void write(const JSON& element);
+        void finish();
+};
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
+#include "JSONArrayWriter.hpp"
+#include "PersistenceExecutor.hpp"
+#include "SegmentedFile.hpp"
 #include "../../Model/include/UserFactory.hpp"
 #include "../../Third_Party/json.hpp"
 #include "../../Model/include/UserModel.hpp"
@@ -18,49 +24,97 @@ using JSON = nlohmann::json;
  *
  * Provides static template methods to parse JSON files into containers of objects,
  * and to serialize containers of objects back to JSON files. Requires that the object
- * type T is constructible from a const JSON& and provides a to_json method.
+ * type T is constructible from a const JSON& and provides a to_json method. Saving
+ * streams the objects into the file one at a time through a JSONArrayWriter and a
+ * 1 MiB file buffer.
+ *
+ * Saving runs in the background on the PersistenceExecutor, so the repositories saved at
+ * exit are written in parallel. A table of more than SEGMENT_SIZE objects is split into
+ * segments written in parallel too, and published atomically with a manifest by a
+ * SegmentedFile; smaller tables stay a single file, replaced atomically as well. Parsing
+ * reads a manifest's segments in order, or the file itself.
  *
  * @tparam T Type of object to be managed. Must be constructible from const JSON& and have a to_json(JSON&) method.
  *
  * @note Uses nlohmann::json for JSON parsing and serialization.
+ * @note Files are saved block-compressed by BlockCodec when the database is run with
+ *       --compress-database, and as indented JSON otherwise. Either encoding is read,
+ *       whatever the option, so the option can be switched between runs.
+ * @note Saving can be switched off process-wide, e.g. for a replication follower that
+ *       must not overwrite the database files owned by its primary.
  */
 class JSONManager {
+    static std::atomic<bool>& savingEnabled() {
+        static std::atomic<bool> enabled{true};
+        return enabled;
+    }
+    static constexpr std::size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+    static void readJSON(std::ifstream& input, JSON& json);
+    static void readTable(const std::string& filePath, const std::function<void(const JSON&)>& addElement);
+
+    template<typename T>
+    static void writeArray(const std::unordered_map<std::string, std::shared_ptr<T>>& members, const std::string& filePath) {
+        std::vector<char> buffer(WRITE_BUFFER_SIZE);
+        std::ofstream outputJSON;
+        outputJSON.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        outputJSON.open(filePath, std::ios::binary);
+        if(!outputJSON.is_open()) {
+            throw std::runtime_error("JSON File \"" + filePath + "\" could not be opened for writing.");
+        }
+        // Each member is serialized straight into the file instead of into one array of all of them
+        JSONArrayWriter writer(outputJSON);
+        JSON j;
+        for(const auto& member : members) {
+            member.second->to_json(j);
+            writer.write(j);
+        }
+        writer.finish();
+    }
+
     public:
+        static constexpr std::size_t SEGMENT_SIZE = 50000;
+
         JSONManager() = delete; // Prevent instantiation of this utility class
+        static void setSavingEnabled(bool enabled) { savingEnabled().store(enabled); }
+        static bool isSavingEnabled() { return savingEnabled().load(); }
         template<typename T>
         static void parseJSON(std::unordered_map<std::string, std::shared_ptr<T>>& members, const std::string& filePath) {
             static_assert(std::is_constructible<T, const JSON&>::value, "T must be constructible from const JSON&");
-            std::ifstream inputJSON(filePath);
-            if (!inputJSON.is_open()) {
-                throw std::runtime_error("JSON File \"" + filePath + "\" could not be opened for reading.");
-            }
-        
-            JSON json;
-            inputJSON >> json;
-        
-            for(auto& element : json) {
-                if(element.is_null()|| !element.contains("id")) {
-                    throw std::invalid_argument("Error: Invalid JSON Format. JSON Object doesn't contain id");
-                }
-            
+            readTable(filePath, [&members](const JSON& element) {
                 std::shared_ptr<T> newElement = std::make_shared<T>(element);
-                std::string id = element["id"].get<std::string>();
+                std::string id = element.at("id").get<std::string>();
                 members.insert({id, newElement});
-            }
+            });
         }
+        /**
+         * @brief Saves a table in the background; the members are moved in, so pass them with std::move.
+         */
         template<typename T>
-        static void saveToJSON(const std::unordered_map<std::string, std::shared_ptr<T>>& members, const std::string& filePath) {
-            std::ofstream outputJSON(filePath);
-            if(!outputJSON.is_open()) {
-                throw std::runtime_error("JSON File \"" + filePath + "\" could not be opened for writing.");
+        static void saveToJSON(std::unordered_map<std::string, std::shared_ptr<T>> members, const std::string& filePath) {
+            using Members = std::unordered_map<std::string, std::shared_ptr<T>>;
+            if (!isSavingEnabled()) {
+                return;
             }
-            JSON json = nlohmann::json::array();
-            for(const auto& member : members) {
-                JSON j;
-                member.second->to_json(j);
-                json.push_back(j);
+            const std::size_t segmentCount = members.empty() ? 1 : (members.size() + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+            std::vector<std::shared_ptr<Members>> segments;
+            for (std::size_t segment = 0; segment < segmentCount; segment++) {
+                segments.push_back(std::make_shared<Members>());
+            }
+            // Members are moved into their segment node by node, without copying them
+            std::size_t index = 0;
+            for (auto it = members.begin(); it != members.end(); index++) {
+                segments[index / SEGMENT_SIZE] -> insert(members.extract(it++));
+            }
+
+            auto file = std::make_shared<SegmentedFile>(filePath, segmentCount);
+            for (std::size_t segment = 0; segment < segmentCount; segment++) {
+                PersistenceExecutor::getInstance() -> submit([file, segment, segmentMembers = segments[segment]] {
+                    file -> writeSegment(segment, [&segmentMembers](const std::string& segmentPath) {
+                        writeArray(*segmentMembers, segmentPath);
+                    });
+                });
             }
-            outputJSON << std::setw(4) << json << std::endl;
         }
 };
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class PersistenceExecutor
+ * @brief Pool of worker threads writing database files in the background.
+ *
+ * Tasks are taken from one shared queue by whichever worker is free, one worker per core,
+ * so the files of several repositories, and the segments of a large one, are written in
+ * parallel. The workers are started by the first submitted task.
+ *
+ * The singleton is created before the repositories (JSONManager creates it when a
+ * repository loads its file), so it is destroyed after them: its destructor lets the
+ * workers finish every save the repositories' destructors submitted before the process
+ * exits. An exception escaping a task is reported on std::cerr.
+ *
+ * Copy and move operations are deleted to maintain singleton integrity.
+ */
+class PersistenceExecutor {
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::deque<std::function<void()>> tasks;
+    bool stopping = false;
+
+    PersistenceExecutor() = default;
+    PersistenceExecutor(const PersistenceExecutor&) = delete;
+    PersistenceExecutor& operator=(const PersistenceExecutor&) = delete;
+    PersistenceExecutor(PersistenceExecutor&&) = delete;
+    PersistenceExecutor& operator=(PersistenceExecutor&&) = delete;
+
+    void workerLoop();
+
+    public:
+        static std::shared_ptr<PersistenceExecutor> getInstance();
+
+        void submit(std::function<void()> task);
+
+        ~PersistenceExecutor();
+};
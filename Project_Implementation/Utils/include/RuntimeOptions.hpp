@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class RuntimeOptions
+ * @brief Process-wide options selected on the command line at startup.
+ *
+ * The options are parsed once in main() before any repository singleton is created,
+ * so that repositories and services can consult them during their own initialization.
+ * Every option has a default that reproduces the classic single-process behaviour.
+ *
+ * Supported arguments:
+ *   --publish-snapshots[=NAME]   Publish flight snapshots into shared memory segment NAME.
+ *   --replica[=NAME]             Run as a read-only replica serving searches from segment NAME.
+ *   --replication-socket=PATH    Ship the mutation log to a hot-standby follower over socket PATH.
+ *   --follow=PATH                Run as a hot-standby follower of the primary listening on PATH.
+ *   --shards=N                   Partition flights and reservations by route across N worker threads.
+ *   --compress-database          Save the database files block-compressed; both encodings are always readable.
+ *   --archive-after=DAYS         At startup, archive flights that arrived more than DAYS days ago.
+ *
+ * @note This class cannot be instantiated; use the static accessors.
+ */
+class RuntimeOptions {
+    static RuntimeOptions& instance();
+
+    bool publishSnapshots = false;
+    bool replicaMode = false;
+    std::string snapshotSegment = DEFAULT_SNAPSHOT_SEGMENT;
+    std::string replicationSocket;
+    std::string followSocket;
+    std::size_t shardCount = 1;
+    bool compressDatabase = false;
+    int archiveHorizonDays = -1;
+
+    RuntimeOptions() = default;
+
+    public:
+        static constexpr const char* DEFAULT_SNAPSHOT_SEGMENT = "/airline_flight_snapshot";
+        static constexpr std::size_t MAX_SHARDS = 64;
+        static constexpr int MAX_ARCHIVE_HORIZON_DAYS = 36500;
+
+        static void parse(int argc, char* argv[]);
+
+        static bool isPublishingSnapshots()                 { return instance().publishSnapshots; }
+        static bool isReplicaMode()                         { return instance().replicaMode; }
+        static const std::string& getSnapshotSegment()      { return instance().snapshotSegment; }
+        static bool isReplicationPrimary()                  { return !instance().replicationSocket.empty(); }
+        static const std::string& getReplicationSocket()    { return instance().replicationSocket; }
+        static bool isFollowerMode()                        { return !instance().followSocket.empty(); }
+        static const std::string& getFollowSocket()         { return instance().followSocket; }
+        static std::size_t getShardCount()                  { return instance().shardCount; }
+        static bool isCompressingDatabase()                 { return instance().compressDatabase; }
+        static bool isArchivingFlights()                    { return instance().archiveHorizonDays >= 0; }
+        static int getArchiveHorizonDays()                  { return instance().archiveHorizonDays; }
+};
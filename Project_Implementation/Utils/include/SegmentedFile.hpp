@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @class SegmentedFile
+ * @brief One save of a database file, written as segments in parallel and published atomically.
+ *
+ * A file saved as a single segment is written next to itself as "<file>.tmp" and renamed
+ * over it. A file saved as several segments has each one written to its own file,
+ * "<file>.<generation>.<index>", by any thread in any order; once the last segment is
+ * written, a manifest listing them is renamed over "<file>". Either way the file switches
+ * from its old contents to its new ones in one rename: a crash leaves the previous save
+ * intact, and segments the new save no longer lists are removed after publishing. If a
+ * segment fails, nothing is published and the segments written so far are removed.
+ *
+ * A manifest is a JSON object whose "segments" array holds the names of the segment files,
+ * which sit in the same directory. getSegmentPaths() tells a reader which files to load.
+ */
+class SegmentedFile {
+    std::string filePath;
+    std::string generation;
+    std::size_t segmentCount;
+    std::atomic<std::size_t> remainingSegments;
+    std::atomic<bool> failed{false};
+
+    std::string getSegmentName(std::size_t segment) const;
+    void publish();
+    void removeSegments();
+
+    public:
+        SegmentedFile(std::string filePath, std::size_t segmentCount);
+        SegmentedFile(const SegmentedFile&) = delete;
+        SegmentedFile& operator=(const SegmentedFile&) = delete;
+
+        void writeSegment(std::size_t segment, const std::function<void(const std::string&)>& write);
+
+        static std::vector<std::string> getSegmentPaths(const std::string& filePath);
+};
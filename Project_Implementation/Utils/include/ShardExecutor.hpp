@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ShardExecutor
+ * @brief Runs tasks on a fixed set of worker threads, one thread per data shard.
+ *
+ * Each shard is owned by exactly one worker; all tasks for a shard run on that worker in
+ * submission order, so shard data needs no locking as long as it is only touched from
+ * tasks. run() executes a task on one shard and waits for it, runOnAll() scatters a task
+ * to every shard in parallel and waits for all of them (gather).
+ *
+ * A task that is already running on a shard's worker and targets the same shard again is
+ * executed inline, so nested calls do not deadlock. Exceptions thrown by a task are
+ * rethrown in the waiting caller.
+ *
+ * @note Tasks must not wait on a shard whose worker may in turn be waiting on them;
+ *       isWorkerThread() lets callers refuse work that would have to.
+ */
+class ShardExecutor {
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        std::deque<std::function<void()>> tasks;
+        bool stopping = false;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    void enqueue(std::size_t shard, std::function<void()> task);
+    void workerLoop(std::size_t shard);
+
+    public:
+        explicit ShardExecutor(std::size_t shardCount);
+
+        ShardExecutor(const ShardExecutor&) = delete;
+        ShardExecutor& operator=(const ShardExecutor&) = delete;
+        ShardExecutor(ShardExecutor&&) = delete;
+        ShardExecutor& operator=(ShardExecutor&&) = delete;
+
+        inline std::size_t getShardCount() const        { return workers.size(); }
+        static bool isWorkerThread();
+
+        void run(std::size_t shard, const std::function<void()>& task);
+        void runOnAll(const std::function<void(std::size_t)>& task);
+
+        ~ShardExecutor();
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class SharedMemorySegment
+ * @brief RAII wrapper around a named POSIX shared memory segment.
+ *
+ * A segment is either created (read-write, owned) by a publishing process or opened
+ * (read-only) by any number of reader processes on the same machine. The owner unlinks
+ * the segment name when it is destroyed; existing readers keep their mapping until they
+ * release it themselves.
+ *
+ * @note Copy operations are disabled; a segment can only be moved.
+ * @note Shared memory segments are only supported on POSIX systems. On other platforms
+ *       the constructors throw std::runtime_error.
+ */
+class SharedMemorySegment {
+    std::string name;
+    void* address = nullptr;
+    std::size_t size = 0;
+    bool owner = false;
+
+    void release();
+
+    public:
+        SharedMemorySegment(const std::string& name, std::size_t size);
+        explicit SharedMemorySegment(const std::string& name);
+
+        SharedMemorySegment(const SharedMemorySegment&) = delete;
+        SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+        SharedMemorySegment(SharedMemorySegment&& other) noexcept;
+        SharedMemorySegment& operator=(SharedMemorySegment&& other) noexcept;
+
+        inline void* data() const                       { return address; }
+        inline std::size_t getSize() const              { return size; }
+        inline const std::string& getName() const       { return name; }
+        inline bool isOwner() const                     { return owner; }
+
+        ~SharedMemorySegment();
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+/**
+ * @class UnixSocket
+ * @brief RAII wrapper around a Unix domain stream socket.
+ *
+ * A socket is either a listening socket bound to a filesystem path, created with
+ * listenOn(), or a connected socket obtained from connectTo() or acceptConnection().
+ * The listening socket removes its path when it is destroyed.
+ *
+ * All transfer operations are blocking and transfer the whole buffer; they report
+ * failure (including an orderly shutdown by the peer) by returning false.
+ *
+ * @note Copy operations are disabled; a socket can only be moved.
+ * @note Unix domain sockets are only supported on POSIX systems. On other platforms
+ *       listenOn() and connectTo() throw std::runtime_error.
+ */
+class UnixSocket {
+    int descriptor = -1;
+    std::string boundPath;
+
+    explicit UnixSocket(int descriptor, const std::string& boundPath = "");
+    void release();
+
+    public:
+        UnixSocket() = default;
+
+        static UnixSocket listenOn(const std::string& path);
+        static UnixSocket connectTo(const std::string& path);
+
+        UnixSocket(const UnixSocket&) = delete;
+        UnixSocket& operator=(const UnixSocket&) = delete;
+        UnixSocket(UnixSocket&& other) noexcept;
+        UnixSocket& operator=(UnixSocket&& other) noexcept;
+
+        std::optional<UnixSocket> acceptConnection(int timeoutMillis) const;
+        bool sendAll(const void* data, std::size_t size) const;
+        bool receiveAll(void* data, std::size_t size) const;
+        void shutdownBoth() const;
+
+        inline bool isOpen() const                      { return descriptor != -1; }
+
+        ~UnixSocket();
+};
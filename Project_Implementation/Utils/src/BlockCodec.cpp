@@ -0,0 +1,376 @@
+#include "../include/BlockCodec.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+static constexpr std::size_t MIN_MATCH = 4;
+static constexpr std::size_t LAST_LITERALS = 5;
+static constexpr std::size_t MATCH_SEARCH_MARGIN = 12;
+static constexpr std::size_t MAX_OFFSET = 65535;
+static constexpr std::size_t LENGTH_MASK = 15;
+static constexpr unsigned HASH_BITS = 12;
+
+static std::uint32_t readWord(const char* position) {
+    std::uint32_t word;
+    std::memcpy(&word, position, sizeof(word));
+    return word;
+}
+
+static std::size_t hashWord(std::uint32_t word) {
+    return static_cast<std::size_t>((word * 2654435761u) >> (32 - HASH_BITS));
+}
+
+static char* writeLengthExtension(char* output, std::size_t length) {
+    for (; length >= 255; length -= 255) {
+        *output++ = static_cast<char>(255);
+    }
+    *output++ = static_cast<char>(length);
+    return output;
+}
+
+static char* writeSequence(char* output, const char* literals, std::size_t literalLength,
+                           std::size_t offset, std::size_t matchLength) {
+    char* token = output++;
+    const std::size_t literalCode = std::min(literalLength, LENGTH_MASK);
+    if (literalLength >= LENGTH_MASK) {
+        output = writeLengthExtension(output, literalLength - LENGTH_MASK);
+    }
+    std::memcpy(output, literals, literalLength);
+    output += literalLength;
+
+    std::size_t matchCode = 0;
+    if (matchLength > 0) {
+        *output++ = static_cast<char>(offset & 0xFF);
+        *output++ = static_cast<char>(offset >> 8);
+        matchCode = std::min(matchLength - MIN_MATCH, LENGTH_MASK);
+        if (matchLength - MIN_MATCH >= LENGTH_MASK) {
+            output = writeLengthExtension(output, matchLength - MIN_MATCH - LENGTH_MASK);
+        }
+    }
+    *token = static_cast<char>((literalCode << 4) | matchCode);
+    return output;
+}
+
+static std::size_t readLengthExtension(const unsigned char*& input, const unsigned char* end) {
+    std::size_t length = 0;
+    unsigned char byte = 255;
+    while (byte == 255) {
+        if (input == end) {
+            throw std::runtime_error("Compressed block ends inside a length.");
+        }
+        byte = *input++;
+        length += byte;
+    }
+    return length;
+}
+
+static void writeWord(std::streambuf* sink, std::uint32_t word) {
+    const char bytes[4] = {
+        static_cast<char>(word & 0xFF), static_cast<char>((word >> 8) & 0xFF),
+        static_cast<char>((word >> 16) & 0xFF), static_cast<char>(word >> 24)
+    };
+    if (sink -> sputn(bytes, 4) != 4) {
+        throw std::runtime_error("Compressed stream could not be written.");
+    }
+}
+
+/**
+ * @brief Returns the largest size a block of rawSize bytes can have once compressed.
+ */
+std::size_t BlockCodec::getMaxCompressedSize(std::size_t rawSize) {
+    return rawSize + rawSize / 255 + 16;
+}
+
+/**
+ * @brief Compresses one block.
+ *
+ * @param source The raw bytes; at most BLOCK_SIZE of them, so every offset fits in two bytes.
+ * @param size The number of raw bytes.
+ * @param destination The output, with room for getMaxCompressedSize(size) bytes.
+ * @return std::size_t The size of the compressed block.
+ */
+std::size_t BlockCodec::compressBlock(const char* source, std::size_t size, char* destination) {
+    const char* const end = source + size;
+    const char* anchor = source;
+    char* output = destination;
+
+    if (size > MATCH_SEARCH_MARGIN) {
+        // Positions are stored plus one, so that 0 marks an empty slot
+        std::array<std::uint32_t, std::size_t{1} << HASH_BITS> positions{};
+        const char* const matchLimit = end - LAST_LITERALS;
+        const char* const searchEnd = end - MATCH_SEARCH_MARGIN;
+        const char* input = source;
+        while (input < searchEnd) {
+            const std::uint32_t word = readWord(input);
+            std::uint32_t& slot = positions[hashWord(word)];
+            const std::uint32_t previous = slot;
+            slot = static_cast<std::uint32_t>(input - source) + 1;
+            if (previous == 0) {
+                input++;
+                continue;
+            }
+            const char* candidate = source + (previous - 1);
+            if (static_cast<std::size_t>(input - candidate) > MAX_OFFSET || readWord(candidate) != word) {
+                input++;
+                continue;
+            }
+
+            while (input > anchor && candidate > source && input[-1] == candidate[-1]) {
+                input--;
+                candidate--;
+            }
+            const char* matchEnd = input + MIN_MATCH;
+            for (const char* next = candidate + MIN_MATCH; matchEnd < matchLimit && *matchEnd == *next; next++) {
+                matchEnd++;
+            }
+            output = writeSequence(output, anchor, static_cast<std::size_t>(input - anchor),
+                                   static_cast<std::size_t>(input - candidate), static_cast<std::size_t>(matchEnd - input));
+            input = matchEnd;
+            anchor = input;
+        }
+    }
+    output = writeSequence(output, anchor, static_cast<std::size_t>(end - anchor), 0, 0);
+    return static_cast<std::size_t>(output - destination);
+}
+
+/**
+ * @brief Decompresses one block.
+ *
+ * @param source The compressed block.
+ * @param size The size of the compressed block.
+ * @param destination The output, with room for rawSize bytes.
+ * @param rawSize The size the block had before compression.
+ *
+ * @throws std::runtime_error If the block is corrupt or does not decompress to exactly rawSize bytes.
+ */
+void BlockCodec::decompressBlock(const char* source, std::size_t size, char* destination, std::size_t rawSize) {
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(source);
+    const unsigned char* const inputEnd = input + size;
+    char* output = destination;
+    char* const outputEnd = destination + rawSize;
+
+    while (true) {
+        if (input == inputEnd) {
+            throw std::runtime_error("Compressed block ends before its last literals.");
+        }
+        const unsigned char token = *input++;
+        std::size_t literalLength = token >> 4;
+        if (literalLength == LENGTH_MASK) {
+            literalLength += readLengthExtension(input, inputEnd);
+        }
+        if (literalLength > static_cast<std::size_t>(inputEnd - input)
+            || literalLength > static_cast<std::size_t>(outputEnd - output)) {
+            throw std::runtime_error("Compressed block has literals past its end.");
+        }
+        std::memcpy(output, input, literalLength);
+        input += literalLength;
+        output += literalLength;
+        if (input == inputEnd) {
+            break;
+        }
+
+        if (inputEnd - input < 2) {
+            throw std::runtime_error("Compressed block ends inside an offset.");
+        }
+        const std::size_t offset = static_cast<std::size_t>(input[0]) | (static_cast<std::size_t>(input[1]) << 8);
+        input += 2;
+        if (offset == 0 || offset > static_cast<std::size_t>(output - destination)) {
+            throw std::runtime_error("Compressed block has a match before its start.");
+        }
+        std::size_t matchLength = token & LENGTH_MASK;
+        if (matchLength == LENGTH_MASK) {
+            matchLength += readLengthExtension(input, inputEnd);
+        }
+        matchLength += MIN_MATCH;
+        if (matchLength > static_cast<std::size_t>(outputEnd - output)) {
+            throw std::runtime_error("Compressed block has a match past its end.");
+        }
+        // Matches may overlap their own output, so they are copied byte by byte
+        for (const char* match = output - offset; matchLength > 0; matchLength--) {
+            *output++ = *match++;
+        }
+    }
+    if (output != outputEnd) {
+        throw std::runtime_error("Compressed block is shorter than its header says.");
+    }
+}
+
+/**
+ * @brief Tells whether a stream holds a compressed file, leaving it at its start.
+ *
+ * @param input A seekable stream positioned at its start.
+ * @return true if the stream starts with the MAGIC bytes; false otherwise.
+ */
+bool BlockCodec::isCompressed(std::istream& input) {
+    char header[MAGIC_SIZE] = {};
+    input.read(header, MAGIC_SIZE);
+    const bool compressed = input.gcount() == static_cast<std::streamsize>(MAGIC_SIZE)
+        && std::equal(header, header + MAGIC_SIZE, MAGIC);
+    input.clear();
+    input.seekg(0);
+    return compressed;
+}
+
+/**
+ * @brief Constructs a buffer compressing into a sink and writes the MAGIC bytes to it.
+ *
+ * @param sink The stream buffer receiving the compressed file; it must outlive this buffer.
+ * @throws std::runtime_error If the sink cannot be written.
+ */
+BlockCompressingBuffer::BlockCompressingBuffer(std::streambuf* sink)
+    : sink(sink), block(BlockCodec::BLOCK_SIZE), compressed(BlockCodec::getMaxCompressedSize(BlockCodec::BLOCK_SIZE)) {
+    if (sink -> sputn(BlockCodec::MAGIC, BlockCodec::MAGIC_SIZE) != static_cast<std::streamsize>(BlockCodec::MAGIC_SIZE)) {
+        throw std::runtime_error("Compressed stream could not be written.");
+    }
+    setp(block.data(), block.data() + block.size());
+}
+
+/**
+ * @brief Compresses the buffered bytes into one block, writes it to the sink and empties the buffer.
+ */
+void BlockCompressingBuffer::writeBlock() {
+    const std::size_t rawSize = static_cast<std::size_t>(pptr() - pbase());
+    if (rawSize == 0) {
+        return;
+    }
+    const std::size_t compressedSize = BlockCodec::compressBlock(block.data(), rawSize, compressed.data());
+    const bool storeRaw = compressedSize >= rawSize;
+    writeWord(sink, static_cast<std::uint32_t>(rawSize));
+    if (storeRaw) {
+        writeWord(sink, static_cast<std::uint32_t>(rawSize) | BlockCodec::STORED_RAW);
+    }
+    else {
+        writeWord(sink, static_cast<std::uint32_t>(compressedSize));
+    }
+    const char* data = storeRaw ? block.data() : compressed.data();
+    const std::size_t dataSize = storeRaw ? rawSize : compressedSize;
+    if (sink -> sputn(data, static_cast<std::streamsize>(dataSize)) != static_cast<std::streamsize>(dataSize)) {
+        throw std::runtime_error("Compressed stream could not be written.");
+    }
+    setp(block.data(), block.data() + block.size());
+}
+
+/**
+ * @brief Writes the full block and buffers the character that did not fit.
+ */
+BlockCompressingBuffer::int_type BlockCompressingBuffer::overflow(int_type character) {
+    if (finished) {
+        return traits_type::eof();
+    }
+    writeBlock();
+    if (!traits_type::eq_int_type(character, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(character);
+        pbump(1);
+    }
+    return traits_type::not_eof(character);
+}
+
+/**
+ * @brief Writes the buffered bytes as a block, which may be shorter than BLOCK_SIZE, and flushes the sink.
+ */
+int BlockCompressingBuffer::sync() {
+    if (!finished) {
+        writeBlock();
+    }
+    return sink -> pubsync();
+}
+
+/**
+ * @brief Writes the last block and the end marker; later writes fail.
+ */
+void BlockCompressingBuffer::finish() {
+    if (finished) {
+        return;
+    }
+    writeBlock();
+    writeWord(sink, 0);
+    writeWord(sink, 0);
+    finished = true;
+    setp(nullptr, nullptr);
+    sink -> pubsync();
+}
+
+/**
+ * @brief Finishes the compressed file if finish() was not called.
+ *
+ * Errors are swallowed here; call finish() first to have them reported.
+ */
+BlockCompressingBuffer::~BlockCompressingBuffer() {
+    try {
+        finish();
+    } catch (const std::exception&) {
+        // A destructor must not throw; the file is left without its end marker
+    }
+}
+
+/**
+ * @brief Constructs a buffer decompressing from a source and checks its MAGIC bytes.
+ *
+ * @param source The stream buffer holding the compressed file; it must outlive this buffer.
+ * @throws std::runtime_error If the source does not start with the MAGIC bytes.
+ */
+BlockDecompressingBuffer::BlockDecompressingBuffer(std::streambuf* source)
+    : source(source), block(BlockCodec::BLOCK_SIZE), compressed(BlockCodec::getMaxCompressedSize(BlockCodec::BLOCK_SIZE)) {
+    char header[BlockCodec::MAGIC_SIZE];
+    readExactly(header, BlockCodec::MAGIC_SIZE);
+    if (!std::equal(header, header + BlockCodec::MAGIC_SIZE, BlockCodec::MAGIC)) {
+        throw std::runtime_error("Stream is not a compressed file.");
+    }
+    setg(block.data(), block.data(), block.data());
+}
+
+/**
+ * @brief Reads exactly size bytes from the source.
+ *
+ * @throws std::runtime_error If the source ends first.
+ */
+void BlockDecompressingBuffer::readExactly(char* destination, std::size_t size) {
+    if (source -> sgetn(destination, static_cast<std::streamsize>(size)) != static_cast<std::streamsize>(size)) {
+        throw std::runtime_error("Compressed file is truncated.");
+    }
+}
+
+/**
+ * @brief Reads and decompresses the next block once the current one is consumed.
+ *
+ * @return int_type The first character of the next block, or EOF after the end marker.
+ * @throws std::runtime_error If the block header or the block is corrupt, or the file is truncated.
+ */
+BlockDecompressingBuffer::int_type BlockDecompressingBuffer::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    if (ended) {
+        return traits_type::eof();
+    }
+
+    unsigned char header[8];
+    readExactly(reinterpret_cast<char*>(header), sizeof(header));
+    auto word = [&header](std::size_t index) {
+        return static_cast<std::uint32_t>(header[index]) | (static_cast<std::uint32_t>(header[index + 1]) << 8)
+            | (static_cast<std::uint32_t>(header[index + 2]) << 16) | (static_cast<std::uint32_t>(header[index + 3]) << 24);
+    };
+    const std::size_t rawSize = word(0);
+    const std::uint32_t storedWord = word(4);
+    if (rawSize == 0) {
+        ended = true;
+        return traits_type::eof();
+    }
+    const bool storedRaw = (storedWord & BlockCodec::STORED_RAW) != 0;
+    const std::size_t storedSize = storedWord & ~BlockCodec::STORED_RAW;
+    if (rawSize > block.size() || storedSize > compressed.size() || (storedRaw && storedSize != rawSize)) {
+        throw std::runtime_error("Compressed file has a corrupt block header.");
+    }
+
+    if (storedRaw) {
+        readExactly(block.data(), rawSize);
+    }
+    else {
+        readExactly(compressed.data(), storedSize);
+        BlockCodec::decompressBlock(compressed.data(), storedSize, block.data(), rawSize);
+    }
+    setg(block.data(), block.data(), block.data() + rawSize);
+    return traits_type::to_int_type(*gptr());
+}
@@ -156,6 +156,21 @@ bool DateTime::operator<=(const DateTime& other) const {
     if (hour != other.hour)     return hour < other.hour;
     return minute < other.minute;
 }
+/**
+ * @brief Orders two DateTime objects chronologically.
+ *
+ * Strict ordering on year, month, day, hour and minute, suitable for sorted containers.
+ *
+ * @param other The DateTime object to compare against.
+ * @return true if this DateTime is strictly earlier than other, false otherwise.
+ */
+bool DateTime::operator<(const DateTime& other) const {
+    if (year != other.year)     return year < other.year;
+    if (month != other.month)   return month < other.month;
+    if (day != other.day)       return day < other.day;
+    if (hour != other.hour)     return hour < other.hour;
+    return minute < other.minute;
+}
 /**
  * @brief Checks if this DateTime object represents the same calendar day as another.
  * 
@@ -168,6 +183,38 @@ bool DateTime::sameDay(const DateTime& other) const {
     return year == other.year && month == other.month && day == other.day;
 }
 
+/**
+ * @brief Returns the same time of day a number of calendar days later or earlier.
+ *
+ * The date is converted to a count of days since 1970-01-01 in the proleptic Gregorian
+ * calendar, shifted, and converted back, so month and year boundaries and leap years
+ * are handled without looping over days.
+ *
+ * @param days The number of days to add; negative values go back in time.
+ * @return DateTime The shifted date, with the same hour and minute.
+ */
+DateTime DateTime::addDays(int days) const {
+    // Days since the epoch (Howard Hinnant's days_from_civil)
+    const int y = (month <= 2) ? year - 1 : year;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int yearOfEra = y - era * 400;
+    const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    const long long epochDays = static_cast<long long>(era) * 146097 + dayOfEra - 719468 + days;
+
+    // And back (civil_from_days)
+    const long long z = epochDays + 719468;
+    const long long shiftedEra = (z >= 0 ? z : z - 146096) / 146097;
+    const int shiftedDayOfEra = static_cast<int>(z - shiftedEra * 146097);
+    const int shiftedYearOfEra = (shiftedDayOfEra - shiftedDayOfEra / 1460 + shiftedDayOfEra / 36524 - shiftedDayOfEra / 146096) / 365;
+    const int shiftedDayOfYear = shiftedDayOfEra - (365 * shiftedYearOfEra + shiftedYearOfEra / 4 - shiftedYearOfEra / 100);
+    const int monthIndex = (5 * shiftedDayOfYear + 2) / 153;
+    const int shiftedDay = shiftedDayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    const int shiftedMonth = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    const int shiftedYear = static_cast<int>(shiftedEra) * 400 + shiftedYearOfEra + (shiftedMonth <= 2 ? 1 : 0);
+    return DateTime(shiftedYear, shiftedMonth, shiftedDay, hour, minute);
+}
+
 /**
  * @brief Creates a DateTime object representing the current local date and time.
  * 
@@ -0,0 +1,161 @@
+#include "../include/EpochManager.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Per-thread pinning state: the thread's slot and how deeply it is pinned.
+ */
+struct ThreadPin {
+    std::size_t slot = SIZE_MAX;
+    std::size_t depth = 0;
+};
+
+static thread_local ThreadPin threadPin;
+
+/**
+ * @brief Constructs the manager with every thread slot idle.
+ */
+EpochManager::EpochManager() {
+    for (auto& pinned : pinnedEpochs) {
+        pinned.store(IDLE);
+    }
+}
+
+/**
+ * @brief Returns the singleton instance of EpochManager.
+ *
+ * @return std::shared_ptr<EpochManager> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<EpochManager> EpochManager::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<EpochManager> instance(new EpochManager());
+    return instance;
+}
+
+/**
+ * @brief Returns the slot of the calling thread, registering the thread on first use.
+ *
+ * @throws std::runtime_error If more than MAX_THREADS threads pin epochs.
+ */
+std::size_t EpochManager::getThreadSlot() {
+    if (threadPin.slot == SIZE_MAX) {
+        std::size_t slot = registeredThreads.fetch_add(1);
+        if (slot >= MAX_THREADS) {
+            throw std::runtime_error("Too many threads reading versioned data.");
+        }
+        threadPin.slot = slot;
+    }
+    return threadPin.slot;
+}
+
+/**
+ * @brief Pins the current epoch for the calling thread. Nested pins keep the outermost epoch.
+ */
+void EpochManager::enter() {
+    if (threadPin.depth++ > 0) {
+        return;
+    }
+    try {
+        pinnedEpochs[getThreadSlot()].store(globalEpoch.load());
+    } catch (...) {
+        threadPin.depth--;
+        throw;
+    }
+}
+
+/**
+ * @brief Unpins the calling thread when its outermost guard goes away.
+ */
+void EpochManager::exit() {
+    if (--threadPin.depth > 0) {
+        return;
+    }
+    pinnedEpochs[threadPin.slot].store(IDLE);
+}
+
+/**
+ * @brief Pins the current epoch until the guard is destroyed.
+ *
+ * @param manager The epoch manager to pin.
+ */
+EpochManager::Guard::Guard(EpochManager& manager) : manager(&manager) {
+    manager.enter();
+}
+
+/**
+ * @brief Transfers the pin to a new guard.
+ */
+EpochManager::Guard::Guard(Guard&& other) noexcept : manager(other.manager) {
+    other.manager = nullptr;
+}
+
+/**
+ * @brief Releases the pin.
+ */
+EpochManager::Guard::~Guard() {
+    if (manager) {
+        manager -> exit();
+    }
+}
+
+/**
+ * @brief Schedules data that is no longer reachable for reclamation.
+ *
+ * The caller must have unlinked the data before retiring it, so that readers pinning
+ * from now on can no longer reach it. The epoch is advanced and everything that no
+ * pinned reader can still see is reclaimed right away.
+ *
+ * @param reclaim Frees the data; runs on whichever writer thread reclaims it.
+ */
+void EpochManager::retire(std::function<void()> reclaim) {
+    {
+        std::lock_guard<std::mutex> lock(retiredMutex);
+        retired.push_back({globalEpoch.fetch_add(1), std::move(reclaim)});
+    }
+    this -> reclaim();
+}
+
+/**
+ * @brief Frees every retired item that was retired before the oldest pinned epoch.
+ *
+ * @return std::size_t The number of items freed.
+ */
+std::size_t EpochManager::reclaim() {
+    std::uint64_t oldestPinned = IDLE;
+    std::size_t threads = std::min(registeredThreads.load(), MAX_THREADS);
+    for (std::size_t slot = 0; slot < threads; slot++) {
+        oldestPinned = std::min(oldestPinned, pinnedEpochs[slot].load());
+    }
+
+    std::vector<std::function<void()>> reclaimable;
+    {
+        std::lock_guard<std::mutex> lock(retiredMutex);
+        // Items are retired in epoch order, so the reclaimable ones form a prefix.
+        while (!retired.empty() && retired.front().epoch < oldestPinned) {
+            reclaimable.push_back(std::move(retired.front().reclaim));
+            retired.pop_front();
+        }
+    }
+    for (auto& item : reclaimable) {
+        item();
+    }
+    return reclaimable.size();
+}
+
+/**
+ * @brief Returns the number of retired items still waiting for readers to unpin.
+ */
+std::size_t EpochManager::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(retiredMutex);
+    return retired.size();
+}
+
+/**
+ * @brief Destructor. Frees everything still retired; no reader can be pinned at this point.
+ */
+EpochManager::~EpochManager() {
+    for (auto& item : retired) {
+        item.reclaim();
+    }
+}
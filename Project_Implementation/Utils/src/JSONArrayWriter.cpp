@@ -0,0 +1,56 @@
+#include "../include/JSONArrayWriter.hpp"
+#include "../include/RuntimeOptions.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Constructs a writer of an array into a file.
+ *
+ * @param file The stream receiving the array; it must outlive the writer.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+JSONArrayWriter::JSONArrayWriter(std::ostream& file)
+    : compressor(RuntimeOptions::isCompressingDatabase() ? std::make_unique<BlockCompressingBuffer>(file.rdbuf()) : nullptr),
+      output(compressor ? compressor.get() : file.rdbuf()),
+      serializer(nlohmann::detail::output_adapter<char>(output), ' '),
+      pretty(!compressor) {
+}
+
+/**
+ * @brief Serializes the next element of the array into the stream.
+ *
+ * @param element The element.
+ */
+void JSONArrayWriter::write(const JSON& element) {
+    if (pretty) {
+        output << (empty ? "[\n" : ",\n");
+        output.write("    ", INDENT);
+        serializer.dump(element, true, false, INDENT, INDENT);
+    }
+    else {
+        output.put(empty ? '[' : ',');
+        serializer.dump(element, false, false, 0);
+    }
+    empty = false;
+}
+
+/**
+ * @brief Closes the array, ends the file with a newline and flushes it.
+ *
+ * @throws std::runtime_error If the file could not be written.
+ */
+void JSONArrayWriter::finish() {
+    if (empty) {
+        output << "[]";
+    }
+    else {
+        output << (pretty ? "\n]" : "]");
+    }
+    output << '\n';
+    if (compressor) {
+        compressor -> finish();
+    }
+    output.flush();
+    if (!output) {
+        throw std::runtime_error("JSON array could not be written.");
+    }
+}
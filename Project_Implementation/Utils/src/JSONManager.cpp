@@ -1,5 +1,55 @@
 #include "../include/JSONManager.hpp"
+#include "../include/BlockCodec.hpp"
 
+/**
+ * @brief Reads the JSON document of a database file, decompressing it if it is block-compressed.
+ *
+ * @param input The file, opened in binary mode and positioned at its start.
+ * @param json The parsed document.
+ *
+ * @throws std::runtime_error If a compressed file is corrupt or truncated.
+ */
+void JSONManager::readJSON(std::ifstream& input, JSON& json) {
+    if (!BlockCodec::isCompressed(input)) {
+        input >> json;
+        return;
+    }
+    BlockDecompressingBuffer buffer(input.rdbuf());
+    std::istream decompressed(&buffer);
+    decompressed >> json;
+}
+
+/**
+ * @brief Reads every element of a table, from the file itself or from the segments its manifest lists.
+ *
+ * Also creates the PersistenceExecutor, so that it outlives the repository loading the
+ * table and can finish the save the repository submits when it is destroyed.
+ *
+ * @param filePath The file of the table.
+ * @param addElement Called with each element, in file order.
+ *
+ * @throws std::runtime_error If a file cannot be opened for reading.
+ * @throws std::invalid_argument If any JSON object does not contain an "id" field.
+ */
+void JSONManager::readTable(const std::string& filePath, const std::function<void(const JSON&)>& addElement) {
+    PersistenceExecutor::getInstance();
+    for (const auto& segmentPath : SegmentedFile::getSegmentPaths(filePath)) {
+        std::ifstream inputJSON(segmentPath, std::ios::binary);
+        if (!inputJSON.is_open()) {
+            throw std::runtime_error("JSON File \"" + segmentPath + "\" could not be opened for reading.");
+        }
+
+        JSON json;
+        readJSON(inputJSON, json);
+
+        for(const auto& element : json) {
+            if(element.is_null()|| !element.contains("id")) {
+                throw std::invalid_argument("Error: Invalid JSON Format. JSON Object doesn't contain id");
+            }
+            addElement(element);
+        }
+    }
+}
 
 /**
  * @brief Parses a JSON file and populates a map of UserModel objects.
@@ -17,21 +67,9 @@
  */
 template<>
 void JSONManager::parseJSON<UserModel>(std::unordered_map<std::string, std::shared_ptr<UserModel>>& members, const std::string& filePath) {
-    std::ifstream inputJSON(filePath);
-    if (!inputJSON.is_open()) {
-        throw std::runtime_error("JSON File \"" + filePath + "\" could not be opened for reading.");
-    }
-
-    JSON json;
-    inputJSON >> json;
-
-    for(auto& element : json) {
-        if(element.is_null()|| !element.contains("id")) {
-            throw std::invalid_argument("Error: Invalid JSON Format. JSON Object doesn't contain id");
-        }
-    
+    readTable(filePath, [&members](const JSON& element) {
         std::shared_ptr<UserModel> newElement = UserFactory::createUser(element);
-        std::string id = element["id"].get<std::string>();
+        std::string id = element.at("id").get<std::string>();
         members.insert({id, newElement});
-    }
-}
\ No newline at end of file
+    });
+}
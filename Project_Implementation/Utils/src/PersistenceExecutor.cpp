@@ -0,0 +1,71 @@
+#include "../include/PersistenceExecutor.hpp"
+#include <exception>
+#include <iostream>
+
+/**
+ * @brief Returns the singleton instance of PersistenceExecutor.
+ *
+ * @return std::shared_ptr<PersistenceExecutor> Shared pointer to the singleton instance.
+ */
+std::shared_ptr<PersistenceExecutor> PersistenceExecutor::getInstance() {
+    // Meyers' Singleton: thread-safe and lazy-initialized.
+    static std::shared_ptr<PersistenceExecutor> instance(new PersistenceExecutor());
+    return instance;
+}
+
+/**
+ * @brief Queues a task, starting the workers if this is the first one.
+ *
+ * @param task The task to run on a worker.
+ */
+void PersistenceExecutor::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (workers.empty()) {
+            std::size_t workerCount = std::thread::hardware_concurrency();
+            workerCount = workerCount == 0 ? 1 : workerCount;
+            for (std::size_t index = 0; index < workerCount; index++) {
+                workers.emplace_back(&PersistenceExecutor::workerLoop, this);
+            }
+        }
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+/**
+ * @brief Worker thread: runs queued tasks until the executor stops and the queue is empty.
+ */
+void PersistenceExecutor::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        try {
+            task();
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Destructor. Lets the workers drain the queue, then joins them.
+ */
+PersistenceExecutor::~PersistenceExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,95 @@
+#include "../include/RuntimeOptions.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Returns the process-wide options instance.
+ *
+ * @return RuntimeOptions& Reference to the lazily created options object.
+ */
+RuntimeOptions& RuntimeOptions::instance() {
+    static RuntimeOptions options;
+    return options;
+}
+
+/**
+ * @brief Parses the command line arguments passed to the program.
+ *
+ * Each argument has the form "--name" or "--name=value". Arguments that take an
+ * optional value fall back to their default when the value is omitted.
+ *
+ * @param argc Number of arguments, as received by main().
+ * @param argv Argument vector, as received by main().
+ *
+ * @throws std::invalid_argument If an unknown argument is encountered or if
+ *         mutually exclusive modes are requested together.
+ */
+void RuntimeOptions::parse(int argc, char* argv[]) {
+    RuntimeOptions& options = instance();
+    for (int index = 1; index < argc; index++) {
+        std::string argument = argv[index];
+        std::string value;
+        size_t equalsPos = argument.find('=');
+        if (equalsPos != std::string::npos) {
+            value = argument.substr(equalsPos + 1);
+            argument = argument.substr(0, equalsPos);
+        }
+
+        if (argument == "--publish-snapshots") {
+            options.publishSnapshots = true;
+            if (!value.empty()) {
+                options.snapshotSegment = value;
+            }
+        } else if (argument == "--replica") {
+            options.replicaMode = true;
+            if (!value.empty()) {
+                options.snapshotSegment = value;
+            }
+        } else if (argument == "--replication-socket" || argument == "--follow") {
+            if (value.empty()) {
+                throw std::invalid_argument(argument + " requires a socket path, e.g. " + argument + "=/tmp/airline.sock");
+            }
+            (argument == "--follow" ? options.followSocket : options.replicationSocket) = value;
+        } else if (argument == "--shards") {
+            std::size_t parsed = 0;
+            unsigned long count = 0;
+            try {
+                count = std::stoul(value, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed == 0 || parsed != value.size() || count == 0 || count > MAX_SHARDS) {
+                throw std::invalid_argument("--shards requires a number between 1 and " + std::to_string(MAX_SHARDS) + ".");
+            }
+            options.shardCount = count;
+        } else if (argument == "--compress-database") {
+            options.compressDatabase = true;
+        } else if (argument == "--archive-after") {
+            std::size_t parsed = 0;
+            int days = -1;
+            try {
+                days = std::stoi(value, &parsed);
+            } catch (const std::exception&) {
+                parsed = 0;
+            }
+            if (parsed == 0 || parsed != value.size() || days < 0 || days > MAX_ARCHIVE_HORIZON_DAYS) {
+                throw std::invalid_argument("--archive-after requires a number of days between 0 and " + std::to_string(MAX_ARCHIVE_HORIZON_DAYS) + ".");
+            }
+            options.archiveHorizonDays = days;
+        } else {
+            throw std::invalid_argument("Unknown command line argument: " + argument);
+        }
+    }
+
+    if (options.publishSnapshots && options.replicaMode) {
+        throw std::invalid_argument("--publish-snapshots and --replica cannot be combined.");
+    }
+    if (options.replicaMode && (!options.replicationSocket.empty() || !options.followSocket.empty())) {
+        throw std::invalid_argument("--replica cannot be combined with log shipping options.");
+    }
+    if (!options.replicationSocket.empty() && !options.followSocket.empty()) {
+        throw std::invalid_argument("--replication-socket and --follow cannot be combined.");
+    }
+    if (options.archiveHorizonDays >= 0 && (options.replicaMode || !options.replicationSocket.empty() || !options.followSocket.empty())) {
+        throw std::invalid_argument("--archive-after cannot be combined with --replica or log shipping options.");
+    }
+}
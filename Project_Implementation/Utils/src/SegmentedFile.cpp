@@ -0,0 +1,148 @@
+#include "../include/SegmentedFile.hpp"
+#include "../../Third_Party/json.hpp"
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+using JSON = nlohmann::json;
+
+/**
+ * @brief Tells whether a file holds a manifest rather than the data itself.
+ *
+ * Manifests are the only database files that are JSON objects; data files are arrays or
+ * block-compressed, so the first character that is not whitespace tells them apart.
+ */
+static bool isManifest(const std::string& filePath) {
+    std::ifstream input(filePath, std::ios::binary);
+    input >> std::ws;
+    return input.peek() == '{';
+}
+
+/**
+ * @brief Starts a save of a file in a number of segments.
+ *
+ * @param filePath The file to save.
+ * @param segmentCount The number of segments; at least 1.
+ */
+SegmentedFile::SegmentedFile(std::string filePath, std::size_t segmentCount)
+    : filePath(std::move(filePath)), segmentCount(segmentCount == 0 ? 1 : segmentCount), remainingSegments(this -> segmentCount) {
+    std::ostringstream stamp;
+    stamp << std::hex << std::chrono::system_clock::now().time_since_epoch().count();
+    generation = stamp.str();
+}
+
+/**
+ * @brief Returns the name of a segment file, or of the temporary file of a single-segment save.
+ */
+std::string SegmentedFile::getSegmentName(std::size_t segment) const {
+    const std::string fileName = std::filesystem::path(filePath).filename().string();
+    if (segmentCount == 1) {
+        return fileName + ".tmp";
+    }
+    return fileName + "." + generation + "." + std::to_string(segment);
+}
+
+/**
+ * @brief Writes one segment; the last segment to finish publishes the file.
+ *
+ * @param segment The index of the segment.
+ * @param write Writes the segment to the path it is given.
+ * @throws Any exception thrown by write, after the segment is accounted for, and any
+ *         error publishing the file.
+ */
+void SegmentedFile::writeSegment(std::size_t segment, const std::function<void(const std::string&)>& write) {
+    std::exception_ptr failure;
+    try {
+        write((std::filesystem::path(filePath).parent_path() / getSegmentName(segment)).string());
+    } catch (...) {
+        failed = true;
+        failure = std::current_exception();
+    }
+    if (remainingSegments.fetch_sub(1) == 1) {
+        if (failed) {
+            removeSegments();
+        }
+        else {
+            publish();
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+/**
+ * @brief Renames the new contents over the file, then removes the segments it no longer lists.
+ *
+ * @throws std::runtime_error If the manifest cannot be written.
+ * @throws std::filesystem::filesystem_error If the rename fails.
+ */
+void SegmentedFile::publish() {
+    const std::filesystem::path path(filePath);
+    const std::string fileName = path.filename().string();
+    std::set<std::string> segmentNames;
+    if (segmentCount > 1) {
+        JSON manifest{{"segments", JSON::array()}};
+        for (std::size_t segment = 0; segment < segmentCount; segment++) {
+            segmentNames.insert(getSegmentName(segment));
+            manifest["segments"].push_back(getSegmentName(segment));
+        }
+        std::ofstream output(filePath + ".tmp", std::ios::binary);
+        output << std::setw(4) << manifest << std::endl;
+        if (!output) {
+            throw std::runtime_error("Manifest of \"" + filePath + "\" could not be written.");
+        }
+    }
+    std::filesystem::rename(filePath + ".tmp", path);
+
+    // Segments of previous saves, and leftovers of interrupted ones, are no longer referenced
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(path.parent_path(), error)) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() > fileName.size() && name.compare(0, fileName.size() + 1, fileName + ".") == 0
+            && segmentNames.count(name) == 0) {
+            std::filesystem::remove(entry.path(), error);
+        }
+    }
+}
+
+/**
+ * @brief Removes the files written by a save that failed, leaving the published file as it was.
+ */
+void SegmentedFile::removeSegments() {
+    std::error_code error;
+    for (std::size_t segment = 0; segment < segmentCount; segment++) {
+        std::filesystem::remove(std::filesystem::path(filePath).parent_path() / getSegmentName(segment), error);
+    }
+}
+
+/**
+ * @brief Returns the files holding the data of a file, in order.
+ *
+ * @param filePath The file.
+ * @return std::vector<std::string> The segments listed by the file if it is a manifest;
+ *         otherwise the file itself.
+ * @throws std::runtime_error If the file is a manifest without a list of segments.
+ */
+std::vector<std::string> SegmentedFile::getSegmentPaths(const std::string& filePath) {
+    if (!isManifest(filePath)) {
+        return {filePath};
+    }
+    std::ifstream input(filePath, std::ios::binary);
+    JSON manifest;
+    input >> manifest;
+    if (!manifest.contains("segments") || !manifest.at("segments").is_array()) {
+        throw std::runtime_error("Manifest \"" + filePath + "\" does not list its segments.");
+    }
+    std::vector<std::string> segmentPaths;
+    for (const auto& segmentName : manifest.at("segments")) {
+        segmentPaths.push_back((std::filesystem::path(filePath).parent_path() / segmentName.get<std::string>()).string());
+    }
+    return segmentPaths;
+}
@@ -0,0 +1,163 @@
+#include "../include/ShardExecutor.hpp"
+#include <future>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Index of the shard owned by the current thread, or SIZE_MAX for non-worker threads.
+ *
+ * Shared by all executors; a process only ever runs a single one.
+ */
+static thread_local std::size_t currentShard = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Starts one worker thread per shard.
+ *
+ * @param shardCount Number of shards; must be at least 1.
+ * @throws std::invalid_argument If the shard count is zero.
+ */
+ShardExecutor::ShardExecutor(std::size_t shardCount) {
+    if (shardCount == 0) {
+        throw std::invalid_argument("Shard count must be at least 1.");
+    }
+    for (std::size_t shard = 0; shard < shardCount; shard++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t shard = 0; shard < shardCount; shard++) {
+        workers[shard] -> thread = std::thread(&ShardExecutor::workerLoop, this, shard);
+    }
+}
+
+/**
+ * @brief Appends a task to a shard's queue and wakes up its worker.
+ */
+void ShardExecutor::enqueue(std::size_t shard, std::function<void()> task) {
+    Worker& worker = *workers.at(shard);
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    worker.taskAvailable.notify_one();
+}
+
+/**
+ * @brief Worker thread: runs the shard's tasks in order until the executor stops.
+ */
+void ShardExecutor::workerLoop(std::size_t shard) {
+    currentShard = shard;
+    Worker& worker = *workers[shard];
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.taskAvailable.wait(lock, [&] { return worker.stopping || !worker.tasks.empty(); });
+            if (worker.tasks.empty()) {
+                return;
+            }
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+        }
+        task();
+    }
+}
+
+/**
+ * @brief Runs a task on a shard's worker and waits for it to finish.
+ *
+ * @param shard The shard to run on.
+ * @param task The task to run.
+ * @throws std::out_of_range If the shard does not exist.
+ * @throws Any exception thrown by the task.
+ */
+void ShardExecutor::run(std::size_t shard, const std::function<void()>& task) {
+    if (currentShard == shard) {
+        task();
+        return;
+    }
+    std::promise<void> done;
+    auto finished = done.get_future();
+    enqueue(shard, [&task, &done] {
+        try {
+            task();
+            done.set_value();
+        } catch (...) {
+            done.set_exception(std::current_exception());
+        }
+    });
+    finished.get();
+}
+
+/**
+ * @brief Tells whether the calling thread is a shard worker, i.e. runs inside a task.
+ *
+ * @return true on a worker thread; false on any other thread.
+ */
+bool ShardExecutor::isWorkerThread() {
+    return currentShard != std::numeric_limits<std::size_t>::max();
+}
+
+/**
+ * @brief Runs a task on every shard in parallel and waits for all of them.
+ *
+ * When called from a worker, that worker's shard is processed inline while the others run.
+ *
+ * @param task The task to run; it receives the index of the shard it runs on.
+ * @throws The first exception thrown by any of the tasks, after all of them finished.
+ */
+void ShardExecutor::runOnAll(const std::function<void(std::size_t)>& task) {
+    std::vector<std::promise<void>> done(workers.size());
+    std::vector<std::future<void>> finished;
+    for (std::size_t shard = 0; shard < workers.size(); shard++) {
+        finished.push_back(done[shard].get_future());
+        if (shard == currentShard) {
+            continue;
+        }
+        enqueue(shard, [&task, &done, shard] {
+            try {
+                task(shard);
+                done[shard].set_value();
+            } catch (...) {
+                done[shard].set_exception(std::current_exception());
+            }
+        });
+    }
+    std::exception_ptr failure;
+    if (currentShard < workers.size()) {
+        try {
+            task(currentShard);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        done[currentShard].set_value();
+    }
+    for (auto& future : finished) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!failure) {
+                failure = std::current_exception();
+            }
+        }
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+/**
+ * @brief Destructor. Lets every worker drain its queue, then joins the threads.
+ */
+ShardExecutor::~ShardExecutor() {
+    for (auto& worker : workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker -> mutex);
+            worker -> stopping = true;
+        }
+        worker -> taskAvailable.notify_one();
+    }
+    for (auto& worker : workers) {
+        if (worker -> thread.joinable()) {
+            worker -> thread.join();
+        }
+    }
+}
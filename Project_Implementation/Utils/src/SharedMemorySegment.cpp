@@ -0,0 +1,132 @@
+#include "../include/SharedMemorySegment.hpp"
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+/**
+ * @brief Creates (or replaces) a named shared memory segment and maps it read-write.
+ *
+ * Any stale segment with the same name is unlinked first so that readers never observe
+ * memory left behind by a previous, crashed publisher. The new segment is zero-filled.
+ *
+ * @param name The segment name (POSIX names start with a single '/').
+ * @param size The size of the segment in bytes. Must be greater than zero.
+ *
+ * @throws std::invalid_argument If the size is zero.
+ * @throws std::runtime_error If the segment cannot be created, sized or mapped.
+ */
+SharedMemorySegment::SharedMemorySegment(const std::string& name, std::size_t size)
+    : name(name), size(size), owner(true) {
+    if (size == 0) {
+        throw std::invalid_argument("Shared memory segment size must be greater than zero.");
+    }
+#ifdef _WIN32
+    throw std::runtime_error("Shared memory segments are not supported on this platform.");
+#else
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd == -1) {
+        throw std::runtime_error("Shared memory segment \"" + name + "\" could not be created: " + std::strerror(errno));
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) == -1) {
+        std::string reason = std::strerror(errno);
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Shared memory segment \"" + name + "\" could not be sized: " + reason);
+    }
+    address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        address = nullptr;
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Shared memory segment \"" + name + "\" could not be mapped.");
+    }
+#endif
+}
+
+/**
+ * @brief Opens an existing shared memory segment and maps it read-only.
+ *
+ * @param name The name of a segment previously created by a publishing process.
+ *
+ * @throws std::runtime_error If the segment does not exist or cannot be mapped.
+ */
+SharedMemorySegment::SharedMemorySegment(const std::string& name) : name(name), owner(false) {
+#ifdef _WIN32
+    throw std::runtime_error("Shared memory segments are not supported on this platform.");
+#else
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+        throw std::runtime_error("Shared memory segment \"" + name + "\" could not be opened: " + std::strerror(errno));
+    }
+    struct stat info;
+    if (fstat(fd, &info) == -1 || info.st_size <= 0) {
+        close(fd);
+        throw std::runtime_error("Shared memory segment \"" + name + "\" is empty or unreadable.");
+    }
+    size = static_cast<std::size_t>(info.st_size);
+    address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        address = nullptr;
+        throw std::runtime_error("Shared memory segment \"" + name + "\" could not be mapped.");
+    }
+#endif
+}
+
+/**
+ * @brief Move constructor. Transfers the mapping and ownership from another segment.
+ *
+ * @param other The segment to move from; it is left without a mapping.
+ */
+SharedMemorySegment::SharedMemorySegment(SharedMemorySegment&& other) noexcept
+    : name(std::move(other.name)), address(std::exchange(other.address, nullptr)),
+      size(std::exchange(other.size, 0)), owner(std::exchange(other.owner, false)) {}
+
+/**
+ * @brief Move assignment. Releases the current mapping before taking over another one.
+ *
+ * @param other The segment to move from; it is left without a mapping.
+ * @return Reference to this segment.
+ */
+SharedMemorySegment& SharedMemorySegment::operator=(SharedMemorySegment&& other) noexcept {
+    if (this != &other) {
+        release();
+        name = std::move(other.name);
+        address = std::exchange(other.address, nullptr);
+        size = std::exchange(other.size, 0);
+        owner = std::exchange(other.owner, false);
+    }
+    return *this;
+}
+
+/**
+ * @brief Unmaps the segment and, for the owner, unlinks its name.
+ */
+void SharedMemorySegment::release() {
+#ifndef _WIN32
+    if (address != nullptr) {
+        munmap(address, size);
+        address = nullptr;
+    }
+    if (owner) {
+        shm_unlink(name.c_str());
+        owner = false;
+    }
+#endif
+}
+
+/**
+ * @brief Destructor. Releases the mapping held by this segment.
+ */
+SharedMemorySegment::~SharedMemorySegment() {
+    release();
+}
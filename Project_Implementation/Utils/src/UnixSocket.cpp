@@ -0,0 +1,238 @@
+#include "../include/UnixSocket.hpp"
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+#if defined(MSG_NOSIGNAL)
+    static constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    static constexpr int SEND_FLAGS = 0;
+#endif
+
+#ifndef _WIN32
+/**
+ * @brief Fills a Unix socket address for the given path.
+ *
+ * @throws std::invalid_argument If the path does not fit into sockaddr_un.
+ */
+static sockaddr_un makeAddress(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path \"" + path + "\" is empty or too long.");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+#endif
+
+/**
+ * @brief Wraps an already open descriptor.
+ *
+ * @param descriptor The socket descriptor; ownership is taken over.
+ * @param boundPath The filesystem path to remove on release, empty for connected sockets.
+ */
+UnixSocket::UnixSocket(int descriptor, const std::string& boundPath)
+    : descriptor(descriptor), boundPath(boundPath) {}
+
+/**
+ * @brief Creates a listening socket bound to a filesystem path.
+ *
+ * A stale socket file left at the path by a previous process is removed first.
+ *
+ * @param path The filesystem path to bind to.
+ * @return UnixSocket The listening socket.
+ *
+ * @throws std::runtime_error If the socket cannot be created, bound or put into listening mode.
+ */
+UnixSocket UnixSocket::listenOn(const std::string& path) {
+#ifdef _WIN32
+    throw std::runtime_error("Unix domain sockets are not supported on this platform.");
+#else
+    sockaddr_un address = makeAddress(path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1) {
+        throw std::runtime_error(std::string("Socket could not be created: ") + std::strerror(errno));
+    }
+    unlink(path.c_str());
+    if (bind(fd, static_cast<const sockaddr*>(static_cast<const void*>(&address)), sizeof(address)) == -1 ||
+        listen(fd, 1) == -1) {
+        std::string reason = std::strerror(errno);
+        close(fd);
+        throw std::runtime_error("Socket \"" + path + "\" could not be bound: " + reason);
+    }
+    return UnixSocket(fd, path);
+#endif
+}
+
+/**
+ * @brief Connects to a listening socket.
+ *
+ * @param path The filesystem path the peer is listening on.
+ * @return UnixSocket The connected socket.
+ *
+ * @throws std::runtime_error If the socket cannot be created or the connection is refused.
+ */
+UnixSocket UnixSocket::connectTo(const std::string& path) {
+#ifdef _WIN32
+    throw std::runtime_error("Unix domain sockets are not supported on this platform.");
+#else
+    sockaddr_un address = makeAddress(path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1) {
+        throw std::runtime_error(std::string("Socket could not be created: ") + std::strerror(errno));
+    }
+    if (connect(fd, static_cast<const sockaddr*>(static_cast<const void*>(&address)), sizeof(address)) == -1) {
+        std::string reason = std::strerror(errno);
+        close(fd);
+        throw std::runtime_error("Socket \"" + path + "\" could not be connected: " + reason);
+    }
+    return UnixSocket(fd);
+#endif
+}
+
+/**
+ * @brief Move constructor. Transfers the descriptor from another socket.
+ *
+ * @param other The socket to move from; it is left closed.
+ */
+UnixSocket::UnixSocket(UnixSocket&& other) noexcept
+    : descriptor(std::exchange(other.descriptor, -1)), boundPath(std::move(other.boundPath)) {
+    other.boundPath.clear();
+}
+
+/**
+ * @brief Move assignment. Closes the current descriptor before taking over another one.
+ *
+ * @param other The socket to move from; it is left closed.
+ * @return Reference to this socket.
+ */
+UnixSocket& UnixSocket::operator=(UnixSocket&& other) noexcept {
+    if (this != &other) {
+        release();
+        descriptor = std::exchange(other.descriptor, -1);
+        boundPath = std::move(other.boundPath);
+        other.boundPath.clear();
+    }
+    return *this;
+}
+
+/**
+ * @brief Waits for and accepts an incoming connection on a listening socket.
+ *
+ * @param timeoutMillis Maximum time to wait, in milliseconds.
+ * @return std::optional<UnixSocket> The connected socket, or std::nullopt on timeout or error.
+ */
+std::optional<UnixSocket> UnixSocket::acceptConnection(int timeoutMillis) const {
+#ifndef _WIN32
+    pollfd request{descriptor, POLLIN, 0};
+    if (poll(&request, 1, timeoutMillis) <= 0) {
+        return std::nullopt;
+    }
+    int fd = accept(descriptor, nullptr, nullptr);
+    if (fd != -1) {
+        return UnixSocket(fd);
+    }
+#else
+    (void)timeoutMillis;
+#endif
+    return std::nullopt;
+}
+
+/**
+ * @brief Sends a whole buffer.
+ *
+ * @param data Pointer to the bytes to send.
+ * @param size Number of bytes to send.
+ * @return true if every byte was sent; false if the connection failed.
+ */
+bool UnixSocket::sendAll(const void* data, std::size_t size) const {
+#ifndef _WIN32
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t sent = send(descriptor, bytes, size, SEND_FLAGS);
+        if (sent == -1 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        bytes += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+#else
+    (void)data;
+    return size == 0;
+#endif
+}
+
+/**
+ * @brief Receives exactly the requested number of bytes.
+ *
+ * @param data Pointer to the buffer to fill.
+ * @param size Number of bytes to receive.
+ * @return true if the buffer was filled; false if the peer closed the connection or it failed.
+ */
+bool UnixSocket::receiveAll(void* data, std::size_t size) const {
+#ifndef _WIN32
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t received = recv(descriptor, bytes, size, 0);
+        if (received == -1 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+#else
+    (void)data;
+    return size == 0;
+#endif
+}
+
+/**
+ * @brief Shuts the connection down in both directions, waking up any blocked transfer.
+ */
+void UnixSocket::shutdownBoth() const {
+#ifndef _WIN32
+    if (descriptor != -1) {
+        shutdown(descriptor, SHUT_RDWR);
+    }
+#endif
+}
+
+/**
+ * @brief Closes the descriptor and removes the bound path, if any.
+ */
+void UnixSocket::release() {
+#ifndef _WIN32
+    if (descriptor != -1) {
+        close(descriptor);
+        descriptor = -1;
+    }
+    if (!boundPath.empty()) {
+        unlink(boundPath.c_str());
+        boundPath.clear();
+    }
+#endif
+}
+
+/**
+ * @brief Destructor. Closes the socket.
+ */
+UnixSocket::~UnixSocket() {
+    release();
+}
@@ -1,4 +1,10 @@
 #include "CLI/include/UserInterface.hpp"
+#include "CLI/include/ReplicaInterface.hpp"
+#include "CLI/include/FollowerInterface.hpp"
+#include "Repositories/include/FlightSnapshotPublisher.hpp"
+#include "Repositories/include/ReplicationPrimary.hpp"
+#include "Services/include/ArchiveService.hpp"
+#include "Utils/include/RuntimeOptions.hpp"
 
 
 #include <csignal>
@@ -25,7 +31,7 @@ void signalHandler(int signal) {
     cleanup();
     std::exit(0);
 }
-int main() {
+int main(int argc, char* argv[]) {
     // Register signal handler
     std::signal(SIGINT, signalHandler);
     std::signal(SIGTERM, signalHandler);
@@ -33,6 +39,35 @@ int main() {
         std::signal(SIGBREAK, signalHandler);
     #endif
     try {
+        RuntimeOptions::parse(argc, argv);
+
+        // Replicas only read published snapshots and never load or save the database
+        if (RuntimeOptions::isReplicaMode()) {
+            ReplicaInterface replica(RuntimeOptions::getSnapshotSegment());
+            replica.startInterface();
+            return 0;
+        }
+        // A follower only hands the repositories over to this thread once it is promoted
+        if (RuntimeOptions::isFollowerMode()) {
+            FollowerInterface followerInterface(RuntimeOptions::getFollowSocket());
+            if (!followerInterface.startInterface()) {
+                return 0;
+            }
+        }
+        // Departed flights leave the working set before anything else sees it
+        if (RuntimeOptions::isArchivingFlights()) {
+            std::size_t archived = ArchiveService::archiveDepartedFlights(RuntimeOptions::getArchiveHorizonDays());
+            if (archived > 0) {
+                std::cout << "Archived " << archived << " departed flight(s)." << std::endl;
+            }
+        }
+        if (RuntimeOptions::isReplicationPrimary()) {
+            ReplicationPrimary::getInstance() -> start(RuntimeOptions::getReplicationSocket());
+        }
+        if (RuntimeOptions::isPublishingSnapshots()) {
+            FlightSnapshotPublisher::getInstance() -> enable(RuntimeOptions::getSnapshotSegment());
+        }
+
         UserInterface ui;
         ui.startProgram();
     } catch (const std::exception& e) {